@@ -0,0 +1,225 @@
+/**
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ * |    @title          :   CM4F                                                                                                        |
+ * |    @file           :   CM4F.c                                                                                                      |
+ * |    @author         :   Abdelrahman Mohamed Salem                                                                                   |
+ * |    @origin_date    :   18/10/2026                                                                                                  |
+ * |    @version        :   1.0.0                                                                                                       |
+ * |    @tool_chain     :   GNU Tools for STM32                                                                                         |
+ * |    @compiler       :   GCC                                                                                                         |
+ * |    @C_standard     :   ISO C99 (-std=c99)                                                                                          |
+ * |    @target         :   stm32f407VGTX                                                                                               |
+ * |    @notes          :   None                                                                                                        |
+ * |    @license        :   MIT License                                                                                                 |
+ * |    @brief          :   this source file contains the implementation of the cortex-M4 core utilities (CM4F) like the                |
+ * |                        boot profiler based on DWT cycle counter.                                                                   |
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ * |    MIT License                                                                                                                     |
+ * |                                                                                                                                    |
+ * |    Copyright (c) - 2023 - Abdelrahman Mohamed Salem - All Rights Reserved                                                          |
+ * |                                                                                                                                    |
+ * |    Permission is hereby granted, free of charge, to any person obtaining a copy                                                    |
+ * |    of this software and associated documentation files (the "Software"), to deal                                                   |
+ * |    in the Software without restriction, including without limitation the rights                                                    |
+ * |    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                                                       |
+ * |    copies of the Software, and to permit persons to whom the Software is                                                           |
+ * |    furnished to do so, subject to the following conditions:                                                                        |
+ * |                                                                                                                                    |
+ * |    The above copyright notice and this permission notice shall be included in all                                                  |
+ * |    copies or substantial portions of the Software.                                                                                 |
+ * |                                                                                                                                    |
+ * |    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                                                      |
+ * |    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                                                        |
+ * |    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                                                     |
+ * |    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                                                          |
+ * |    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                                                   |
+ * |    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                                                   |
+ * |    SOFTWARE.                                                                                                                       |
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ * |    @history_change_list                                                                                                            |
+ * |    ====================                                                                                                            |
+ * |    Date            Version         Author                          Description                                                     |
+ * |    18/10/2026      1.0.0           Abdelrahman Mohamed Salem       Interface Created.                                              |
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ */
+
+/******************************************************************************
+ * Includes
+ *******************************************************************************/
+/**
+ * @reason: contains standard definitions for standard integers
+ */
+#include "../../lib/stdint.h"
+
+/**
+ * @reason: contains definition for NULL
+ */
+#include "../../lib/common.h"
+
+/**
+ * @reason: contains constants common values
+ */
+#include "../../lib/constants.h"
+
+/**
+ * @reason: contains useful functions that deals with bit level math
+ */
+#include "../../Lib/math_btt.h"
+
+/**
+ * @reason: contains the boot profiler configurations
+ */
+#include "CM4F_config.h"
+
+/**
+ * @reason: contains all the interface functions to be implemented
+ */
+#include "CM4F_header.h"
+
+/**
+ * @reason: contains all register addresses and bit definitions for the core registers
+ */
+#include "CM4F_reg.h"
+
+/**
+ * @reason: contains all private function declaration and global variables
+ */
+#include "CM4F_private.h"
+
+/******************************************************************************
+ * Module Preprocessor Constants
+ *******************************************************************************/
+
+/******************************************************************************
+ * Module Preprocessor Macros
+ *******************************************************************************/
+
+/******************************************************************************
+ * Module Typedefs
+ *******************************************************************************/
+
+/******************************************************************************
+ * Module Variable Definitions
+ *******************************************************************************/
+
+/******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/******************************************************************************
+ * Function Definitions
+ *******************************************************************************/
+
+/**
+ *
+ */
+HAL_CM4F_ErrStates_t HAL_CM4F_BootProfileStart(const uint32_t argConst_u32CoreClock)
+{
+    // local used variables
+    HAL_CM4F_ErrStates_t local_errState = HAL_CM4F_OK;
+
+    // check for errors
+    if (argConst_u32CoreClock == 0)
+    {
+        local_errState = HAL_CM4F_ERR_INVALID_PARAMS;
+    }
+    else
+    {
+        // do nothing
+    }
+
+    // main function
+    if (local_errState == HAL_CM4F_OK)
+    {
+        // DWT is powered by the trace enable bit, the counter starts from zero so the first stamp is the start of the record
+        LIB_MATH_BTT_SET_BIT(*global_pu32DEMCRreg_t, HAL_CM4F_DEMCR_TRCENA_POS);
+        global_pDWTReg_t->CYCCNT = 0;
+        LIB_MATH_BTT_SET_BIT(global_pDWTReg_t->CTRL, HAL_CM4F_DWT_CTRL_CYCCNTENA_POS);
+
+        global_CM4F_BootProfile_t.Count = 0;
+        global_CM4F_BootProfile_t.Magic = HAL_CM4F_BOOT_PROFILE_MAGIC;
+        local_errState = HAL_CM4F_BootProfileMark(HAL_CM4F_BOOT_STAGE_START, argConst_u32CoreClock);
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_CM4F_ErrStates_t HAL_CM4F_BootProfileMark(const uint8_t argConst_u8Stage, const uint32_t argConst_u32CoreClock)
+{
+    // local used variables
+    HAL_CM4F_ErrStates_t local_errState = HAL_CM4F_OK;
+    uint32_t local_u32Cycles = global_pDWTReg_t->CYCCNT;
+    uint32_t local_u32Count = global_CM4F_BootProfile_t.Count;
+
+    // check for errors
+    if (global_CM4F_BootProfile_t.Magic != HAL_CM4F_BOOT_PROFILE_MAGIC)
+    {
+        local_errState = HAL_CM4F_ERR_PROFILE_NOT_STARTED;
+    }
+    else if (local_u32Count >= HAL_CM4F_CFG_BOOT_PROFILE_MAX_STAMPS)
+    {
+        local_errState = HAL_CM4F_ERR_PROFILE_FULL;
+    }
+    else
+    {
+        // do nothing
+    }
+
+    // main function
+    if (local_errState == HAL_CM4F_OK)
+    {
+        // 0 means the core clock didn't change since the previous stamp so the record always holds the clock of every segment
+        global_CM4F_BootProfile_t.Stamps[local_u32Count].Cycles = local_u32Cycles;
+        global_CM4F_BootProfile_t.Stamps[local_u32Count].CoreClock = (argConst_u32CoreClock != 0 || local_u32Count == 0) ? argConst_u32CoreClock : global_CM4F_BootProfile_t.Stamps[local_u32Count - 1].CoreClock;
+        global_CM4F_BootProfile_t.Stamps[local_u32Count].Stage = argConst_u8Stage;
+        global_CM4F_BootProfile_t.Count = local_u32Count + 1;
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_CM4F_ErrStates_t HAL_CM4F_GetBootProfile(const HAL_CM4F_BootProfile_t **const arg_constppProfile)
+{
+    // local used variables
+    HAL_CM4F_ErrStates_t local_errState = HAL_CM4F_OK;
+
+    // check for errors
+    if (arg_constppProfile == NULL)
+    {
+        local_errState = HAL_CM4F_ERR_INVALID_PARAMS;
+    }
+    else if (global_CM4F_BootProfile_t.Magic != HAL_CM4F_BOOT_PROFILE_MAGIC)
+    {
+        local_errState = HAL_CM4F_ERR_PROFILE_NOT_STARTED;
+    }
+    else
+    {
+        // do nothing
+    }
+
+    // main function
+    if (local_errState == HAL_CM4F_OK)
+    {
+        *arg_constppProfile = &global_CM4F_BootProfile_t;
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
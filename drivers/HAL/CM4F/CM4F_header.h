@@ -60,6 +60,11 @@
  */
 #include "CM4F_reg.h"
 
+/**
+ * @reason: contains the boot profiler configurations
+ */
+#include "CM4F_config.h"
+
 /******************************************************************************
  * Preprocessor Constants
  *******************************************************************************/
@@ -110,7 +115,77 @@
  * <hr>
  */
 #define HAL_CM4F_BIT_BAND_ALIAS_ADDR(bitBandBaseAddr, byteOffset, bitNumber) \
-    ((bitBandBaseAddr) + (32 * byteOffset) + (bitNumber * 4))
+    ((bitBandBaseAddr) + (32 * (byteOffset)) + ((bitNumber) * 4))
+
+/**
+ *  \b Macro                        :       HAL_CM4F_PERIPH_BIT_BAND(regAddr, bitNumber)
+ *  \b Description                  :       this macro gives the alias word of one bit of a peripheral register as an lvalue so that:
+ *                                              ->  writing 0 or 1 to it clears or sets that bit only, the bus matrix performs the read-modify-write atomically so
+ *                                                  neither an ISR nor a DMA access can interleave and no masking is needed in code.
+ *                                              ->  reading it returns the bit value (0 or 1) directly with no shift or mask.
+ *                                          it can be used with any register in the peripheral bit-band region like GPIO data registers or RCC enable bits.
+ *  @param    regAddr               :       the address of the register which must lie inside 0x40000000 - 0x400FFFFF.
+ *  @param    bitNumber             :       the bit position (0-31) of the targeted bit inside the register.
+ *  \b PRE-CONDITION                :       make sure that the register lies inside peripheral bit-band region.
+ *  \b POST-CONDITION               :       None
+ *  @return                         :       the alias word (volatile uint32_t lvalue) of the needed bit.
+ *  @see                            :       HAL_CM4F_BIT_BAND_ALIAS_ADDR(bitBandBaseAddr, byteOffset, bitNumber)
+ *  @see                            :       HAL_CM4F_SRAM_BIT_BAND(varAddr, bitNumber)
+ *  @note                           :       estimated cost on cortex-M4 compared to the BSRR path when the address is constant:
+ *                                              ->  bit-band write: 1 STR from the core point of view but the bus performs a locked read then write (2 bus transfers).
+ *                                              ->  BSRR write: 1 STR and only 1 bus transfer, so BSRR stays the cheapest way to drive GPIO outputs.
+ *                                              ->  bit-band read: 1 LDR returning 0/1 against LDR + shift/AND for a normal register read.
+ *                                          bit-band is most useful for registers that have no set/reset register like RCC enable bits or ODR of a single pin.
+ *
+ *  \b Example:
+ * @code
+ * #include "CM4F_header.h"
+ * int main() {
+ * HAL_CM4F_PERIPH_BIT_BAND(0x40023830, 0) = 1;    // sets GPIOAEN bit of RCC_AHB1ENR with one store and no read-modify-write in code
+ * return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+#define HAL_CM4F_PERIPH_BIT_BAND(regAddr, bitNumber) \
+    (*(__io uint32_t *)HAL_CM4F_BIT_BAND_ALIAS_ADDR(HAL_CM4F_PERIPH_BIT_BAND_ALIAS_BASE_ADDR, ((uint32_t)(regAddr) - HAL_CM4F_PERIPH_BIT_BAND_BASE_ADDR), (bitNumber)))
+
+/**
+ *  \b Macro                        :       HAL_CM4F_SRAM_BIT_BAND(varAddr, bitNumber)
+ *  \b Description                  :       this macro gives the alias word of one bit of a variable in SRAM as an lvalue so that a flag shared between
+ *                                          main code and ISRs can be set, cleared or read with one store/load.
+ *  @param    varAddr               :       the address of the variable which must lie inside 0x20000000 - 0x200FFFFF.
+ *  @param    bitNumber             :       the bit position (0-31) of the targeted bit inside the variable.
+ *  \b PRE-CONDITION                :       make sure that the variable lies inside SRAM bit-band region (not CCM).
+ *  \b POST-CONDITION               :       None
+ *  @return                         :       the alias word (volatile uint32_t lvalue) of the needed bit.
+ *  @see                            :       HAL_CM4F_PERIPH_BIT_BAND(regAddr, bitNumber)
+ *
+ *  \b Example:
+ * @code
+ * #include "CM4F_header.h"
+ * uint32_t flags = 0;
+ * int main() {
+ * HAL_CM4F_SRAM_BIT_BAND(&flags, 3) = 1;    // flags = 8
+ * return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+#define HAL_CM4F_SRAM_BIT_BAND(varAddr, bitNumber) \
+    (*(__io uint32_t *)HAL_CM4F_BIT_BAND_ALIAS_ADDR(HAL_CM4F_SRAM_BIT_BAND_ALIAS_BASE_ADDR, ((uint32_t)(varAddr) - HAL_CM4F_SRAM_BIT_BAND_BASE_ADDR), (bitNumber)))
 
 /**
  *  \b Macro                        :       HAL_CM4F_WAIT_FOR_INTERRUPT()
@@ -173,10 +248,161 @@
 #define HAL_CM4F_WAIT_FOR_EVENT() \
     __asm__("WFE")
 
+/**
+ *  \b Macro                        :       HAL_CM4F_ENTER_CRITICAL(PRIMASK_VAR)
+ *  \b Description                  :       this macro is used to save the current value of PRIMASK into a variable then disable all configurable interrupts.
+ *  @param    PRIMASK_VAR           :       uint32_t variable that receives PRIMASK, it's passed to HAL_CM4F_EXIT_CRITICAL() later.
+ *  \b PRE-CONDITION                :       None.
+ *  \b POST-CONDITION               :       no interrupt with configurable priority can preempt the code until HAL_CM4F_EXIT_CRITICAL() is called.
+ *  @return                         :       None.
+ *  @see                            :       HAL_CM4F_EXIT_CRITICAL(PRIMASK_VAR)
+ *  @note:                          :       saving PRIMASK allows nesting critical sections, the inner exit doesn't enable interrupts disabled by the outer one.
+ *
+ *  \b Example:
+ * @code
+ * #include "CM4F_header.h"
+ * int main() {
+ * uint32_t local_u32Primask;
+ * HAL_CM4F_ENTER_CRITICAL(local_u32Primask);
+ * // read-modify-write shared with interrupts
+ * HAL_CM4F_EXIT_CRITICAL(local_u32Primask);
+ * return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+#define HAL_CM4F_ENTER_CRITICAL(PRIMASK_VAR) \
+    __asm__ volatile("MRS %0, PRIMASK\n\tCPSID i" : "=r"(PRIMASK_VAR) : : "memory")
+
+/**
+ *  \b Macro                        :       HAL_CM4F_EXIT_CRITICAL(PRIMASK_VAR)
+ *  \b Description                  :       this macro is used to restore PRIMASK saved by HAL_CM4F_ENTER_CRITICAL().
+ *  @param    PRIMASK_VAR           :       uint32_t variable filled by HAL_CM4F_ENTER_CRITICAL().
+ *  \b PRE-CONDITION                :       HAL_CM4F_ENTER_CRITICAL() is called with the same variable.
+ *  \b POST-CONDITION               :       interrupts are enabled again if they were enabled before entering the critical section.
+ *  @return                         :       None.
+ *  @see                            :       HAL_CM4F_ENTER_CRITICAL(PRIMASK_VAR)
+ *  @note:                          :       None.
+ *
+ *  \b Example:
+ * @code
+ * #include "CM4F_header.h"
+ * int main() {
+ * uint32_t local_u32Primask;
+ * HAL_CM4F_ENTER_CRITICAL(local_u32Primask);
+ * // read-modify-write shared with interrupts
+ * HAL_CM4F_EXIT_CRITICAL(local_u32Primask);
+ * return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+#define HAL_CM4F_EXIT_CRITICAL(PRIMASK_VAR) \
+    __asm__ volatile("MSR PRIMASK, %0" : : "r"(PRIMASK_VAR) : "memory")
+
+/**
+ *  \b Macro                        :       HAL_CM4F_BOOT_PROFILE_MARK(STAGE, CORE_CLOCK)
+ *  \b Description                  :       this macro is used by the drivers to timestamp the end of an init stage in the boot record, it calls
+ *                                          HAL_CM4F_BootProfileMark() when HAL_CM4F_CFG_BOOT_PROFILE_ENABLE is 1 and expands to nothing otherwise.
+ *  @param    STAGE                 :       the finished stage (refer to @HAL_CM4F_BootStage_t in "CM4F_header.h").
+ *  @param    CORE_CLOCK            :       core clock in HZ from this point on, 0 if the stage didn't change it.
+ *  \b PRE-CONDITION                :       None.
+ *  \b POST-CONDITION               :       a timestamp is added to the boot record if it's started and not full.
+ *  @return                         :       None.
+ *  @see                            :       HAL_CM4F_BootProfileMark(const uint8_t argConst_u8Stage, const uint32_t argConst_u32CoreClock)
+ *  @note:                          :       the return of HAL_CM4F_BootProfileMark() is ignored as profiling must never change the boot flow.
+ *
+ *  \b Example:
+ * @code
+ * #include "CM4F_header.h"
+ * int main() {
+ * HAL_CM4F_BOOT_PROFILE_MARK(HAL_CM4F_BOOT_STAGE_USER, 0); // end of the first application stage
+ * return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+#if HAL_CM4F_CFG_BOOT_PROFILE_ENABLE
+#define HAL_CM4F_BOOT_PROFILE_MARK(STAGE, CORE_CLOCK) \
+    ((void)HAL_CM4F_BootProfileMark((STAGE), (CORE_CLOCK)))
+#else
+#define HAL_CM4F_BOOT_PROFILE_MARK(STAGE, CORE_CLOCK)
+#endif
+
 /******************************************************************************
  * Typedefs
  *******************************************************************************/
 
+/**
+ * @enum: HAL_CM4F_ErrStates_t
+ * @brief: contains all possible errors that can result from dealing with the core utilities.
+ */
+typedef enum
+{
+    HAL_CM4F_OK,                      /**< it means everything has gone as intended so no errors*/
+    HAL_CM4F_ERR_INVALID_PARAMS,      /**< it means that the supplied parameters of the function are invalid*/
+    HAL_CM4F_ERR_PROFILE_NOT_STARTED, /**< it means that HAL_CM4F_BootProfileStart() wasn't called so there is no boot record*/
+    HAL_CM4F_ERR_PROFILE_FULL,        /**< it means that the boot record holds HAL_CM4F_CFG_BOOT_PROFILE_MAX_STAMPS timestamps (refer to "CM4F_config.h")*/
+} HAL_CM4F_ErrStates_t;
+
+/**
+ * @enum: HAL_CM4F_BootStage_t
+ * @brief: it holds the init stages timestamped in the boot record, the application can use HAL_CM4F_BOOT_STAGE_USER and the values after it for its own stages
+ */
+typedef enum
+{
+    HAL_CM4F_BOOT_STAGE_START,           /**< boot record is started (cycle counter is zero)*/
+    HAL_CM4F_BOOT_STAGE_HSE_READY,       /**< HSE is stable inside HAL_RCC_Init()*/
+    HAL_CM4F_BOOT_STAGE_PLL_LOCKED,      /**< main PLL and PLLI2S are locked inside HAL_RCC_Init()*/
+    HAL_CM4F_BOOT_STAGE_SYSCLK_SWITCHED, /**< system clock is switched to the configured source inside HAL_RCC_Init()*/
+    HAL_CM4F_BOOT_STAGE_RCC_INIT,        /**< HAL_RCC_Init() is finished*/
+    HAL_CM4F_BOOT_STAGE_FLASH_INIT,      /**< HAL_FLASH_Init() is finished*/
+    HAL_CM4F_BOOT_STAGE_PWR_INIT,        /**< HAL_PWR_Init() is finished*/
+    HAL_CM4F_BOOT_STAGE_GPIO_INIT,       /**< HAL_GPIO_Init() is finished*/
+    HAL_CM4F_BOOT_STAGE_USER,            /**< first stage that can be used by the application*/
+} HAL_CM4F_BootStage_t;
+
+/**
+ * @struct: HAL_CM4F_BootStamp_t
+ * @brief: one timestamp of the boot record, all members are words so that the record is decoded as an array of 32 bit values.
+ */
+typedef struct
+{
+    uint32_t Cycles;    /**< value of DWT cycle counter at the end of the stage*/
+    uint32_t CoreClock; /**< core clock in HZ from this stamp till the next one*/
+    uint32_t Stage;     /**< for possible values refer to @HAL_CM4F_BootStage_t in "CM4F_header.h"*/
+} HAL_CM4F_BootStamp_t;
+
+/**
+ * @struct: HAL_CM4F_BootProfile_t
+ * @brief: the boot record, it's laid out in RAM as: Magic, Count then Count stamps of 3 words each (Cycles, CoreClock, Stage).
+ *         stage n took (Stamps[n].Cycles - Stamps[n - 1].Cycles) / Stamps[n - 1].CoreClock seconds.
+ */
+typedef struct
+{
+    uint32_t Magic;                                                    /**< 0x544F4F42 ("BOOT") once the record is started*/
+    uint32_t Count;                                                    /**< number of valid stamps*/
+    HAL_CM4F_BootStamp_t Stamps[HAL_CM4F_CFG_BOOT_PROFILE_MAX_STAMPS]; /**< stamps in the order they were taken*/
+} HAL_CM4F_BootProfile_t;
+
 /******************************************************************************
  * Variables
  *******************************************************************************/
@@ -185,5 +411,111 @@
  * Function Prototypes
  *******************************************************************************/
 
+/**
+ *  \b function                             :       HAL_CM4F_ErrStates_t HAL_CM4F_BootProfileStart(const uint32_t argConst_u32CoreClock)
+ *  \b Description                          :       this functions is used to start the boot record, it enables DWT cycle counter from zero
+ *                                                  and adds the first timestamp (HAL_CM4F_BOOT_STAGE_START).
+ *  @param  argConst_u32CoreClock [IN]      :       this is input parameter which is the core clock in HZ when the function is called (16000000 after reset as the core runs from HSI)
+ *  @note                                   :       the cycle counter wraps every 2^32 cycles (25.5 seconds at 168 MHZ) so only the boot is meant to be measured,
+ *                                                  calling it again restarts the record.
+ *  \b PRE-CONDITION                        :       it's the first function called in main() and HAL_CM4F_CFG_BOOT_PROFILE_ENABLE is 1 in "CM4F_config.h" so the drivers add their stamps.
+ *  \b POST-CONDITION                       :       the record holds one timestamp and the drivers add a timestamp at the end of every init stage.
+ *  @return                                 :       it return one of error states indicating whether a failure or success happened (refer to @HAL_CM4F_ErrStates_t in "CM4F_header.h")
+ *  @see                                    :       HAL_CM4F_GetBootProfile(const HAL_CM4F_BootProfile_t **const arg_constppProfile)
+ *
+ *  \b Example:
+ * @code
+ * #include "CM4F_header.h"
+ * int main() {
+ * HAL_CM4F_BootProfileStart(16000000);
+ * HAL_FLASH_Init();
+ * HAL_RCC_Init();
+ * HAL_PWR_Init();
+ * HAL_GPIO_Init();
+ * return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_CM4F_ErrStates_t HAL_CM4F_BootProfileStart(const uint32_t argConst_u32CoreClock);
+
+/**
+ *  \b function                             :       HAL_CM4F_ErrStates_t HAL_CM4F_BootProfileMark(const uint8_t argConst_u8Stage, const uint32_t argConst_u32CoreClock)
+ *  \b Description                          :       this functions is used to add a timestamp to the boot record at the end of a stage.
+ *  @param  argConst_u8Stage [IN]           :       this is input parameter which is the finished stage (refer to @HAL_CM4F_BootStage_t in "CM4F_header.h")
+ *  @param  argConst_u32CoreClock [IN]      :       this is input parameter which is the core clock in HZ from this point on, 0 if the stage didn't change it
+ *  @note                                   :       drivers call it through HAL_CM4F_BOOT_PROFILE_MARK() so it costs nothing when profiling is disabled.
+ *  \b PRE-CONDITION                        :       HAL_CM4F_BootProfileStart() is called.
+ *  \b POST-CONDITION                       :       the record holds one more timestamp.
+ *  @return                                 :       it return one of error states indicating whether a failure or success happened (refer to @HAL_CM4F_ErrStates_t in "CM4F_header.h")
+ *  @see                                    :       HAL_CM4F_BootProfileStart(const uint32_t argConst_u32CoreClock)
+ *
+ *  \b Example:
+ * @code
+ * #include "CM4F_header.h"
+ * int main() {
+ * HAL_CM4F_BootProfileStart(16000000);
+ * // load application settings
+ * HAL_CM4F_ErrStates_t local_errState_t = HAL_CM4F_BootProfileMark(HAL_CM4F_BOOT_STAGE_USER, 0);
+ * return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_CM4F_ErrStates_t HAL_CM4F_BootProfileMark(const uint8_t argConst_u8Stage, const uint32_t argConst_u32CoreClock);
+
+/**
+ *  \b function                             :       HAL_CM4F_ErrStates_t HAL_CM4F_GetBootProfile(const HAL_CM4F_BootProfile_t **const arg_constppProfile)
+ *  \b Description                          :       this functions is used to get the boot record so that the application can print or send it.
+ *  @param  arg_constppProfile [OUT]        :       this is output parameter which points to the boot record (refer to @HAL_CM4F_BootProfile_t in "CM4F_header.h")
+ *  @note                                   :       a debugger can read the record without this function, e.g. with GDB:
+ *                                                  "dump binary value boot.bin global_CM4F_BootProfile_t" then the file is decoded on the host
+ *                                                  as little endian words: Magic, Count then (Cycles, CoreClock, Stage) for every stamp.
+ *  \b PRE-CONDITION                        :       HAL_CM4F_BootProfileStart() is called.
+ *  \b POST-CONDITION                       :       None.
+ *  @return                                 :       it return one of error states indicating whether a failure or success happened (refer to @HAL_CM4F_ErrStates_t in "CM4F_header.h")
+ *  @see                                    :       HAL_CM4F_BootProfileStart(const uint32_t argConst_u32CoreClock)
+ *
+ *  \b Example:
+ * @code
+ * #include "CM4F_header.h"
+ * int main() {
+ * const HAL_CM4F_BootProfile_t *local_pProfile_t = NULL;
+ * uint32_t local_u32Microseconds = 0;
+ * uint32_t local_u32Iterator = 0;
+ * if (HAL_CM4F_GetBootProfile(&local_pProfile_t) == HAL_CM4F_OK)
+ * {
+ *  for (local_u32Iterator = 1; local_u32Iterator < local_pProfile_t->Count; local_u32Iterator++)
+ *  {
+ *      // time spent in stage local_pProfile_t->Stamps[local_u32Iterator].Stage
+ *      local_u32Microseconds = (local_pProfile_t->Stamps[local_u32Iterator].Cycles - local_pProfile_t->Stamps[local_u32Iterator - 1].Cycles) /
+ *                              (local_pProfile_t->Stamps[local_u32Iterator - 1].CoreClock / 1000000);
+ *  }
+ * }
+ * return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_CM4F_ErrStates_t HAL_CM4F_GetBootProfile(const HAL_CM4F_BootProfile_t **const arg_constppProfile);
+
 /*** End of File **************************************************************/
 #endif /*CM4F_HEADER_H_*/
\ No newline at end of file
@@ -0,0 +1,91 @@
+/**
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ * |    @title          :   CM4F                                                                                                        |
+ * |    @file           :   CM4F_private.h                                                                                              |
+ * |    @author         :   Abdelrahman Mohamed Salem                                                                                   |
+ * |    @origin_date    :   18/10/2026                                                                                                  |
+ * |    @version        :   1.0.0                                                                                                       |
+ * |    @tool_chain     :   GNU Tools for STM32                                                                                         |
+ * |    @compiler       :   GCC                                                                                                         |
+ * |    @C_standard     :   ISO C99 (-std=c99)                                                                                          |
+ * |    @target         :   stm32f407VGTX                                                                                               |
+ * |    @notes          :   None                                                                                                        |
+ * |    @license        :   MIT License                                                                                                 |
+ * |    @brief          :   this header file contains private functions and variables for the cortex-M4 core utilities (CM4F)           |
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ * |    MIT License                                                                                                                     |
+ * |                                                                                                                                    |
+ * |    Copyright (c) - 2023 - Abdelrahman Mohamed Salem - All Rights Reserved                                                          |
+ * |                                                                                                                                    |
+ * |    Permission is hereby granted, free of charge, to any person obtaining a copy                                                    |
+ * |    of this software and associated documentation files (the "Software"), to deal                                                   |
+ * |    in the Software without restriction, including without limitation the rights                                                    |
+ * |    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                                                       |
+ * |    copies of the Software, and to permit persons to whom the Software is                                                           |
+ * |    furnished to do so, subject to the following conditions:                                                                        |
+ * |                                                                                                                                    |
+ * |    The above copyright notice and this permission notice shall be included in all                                                  |
+ * |    copies or substantial portions of the Software.                                                                                 |
+ * |                                                                                                                                    |
+ * |    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                                                      |
+ * |    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                                                        |
+ * |    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                                                     |
+ * |    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                                                          |
+ * |    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                                                   |
+ * |    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                                                   |
+ * |    SOFTWARE.                                                                                                                       |
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ * |    @history_change_list                                                                                                            |
+ * |    ====================                                                                                                            |
+ * |    Date            Version         Author                          Description                                                     |
+ * |    18/10/2026      1.0.0           Abdelrahman Mohamed Salem       Interface Created.                                              |
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ */
+
+#ifndef HAL_CM4F_PRIVATE_H_
+#define HAL_CM4F_PRIVATE_H_
+
+/******************************************************************************
+ * Includes
+ *******************************************************************************/
+
+/******************************************************************************
+ * Preprocessor Constants
+ *******************************************************************************/
+
+/**
+ * @brief: first word of a started boot record ("BOOT" in ASCII when read as bytes), marks are ignored till it's written
+ */
+#define HAL_CM4F_BOOT_PROFILE_MAGIC 0x544F4F42UL
+
+/******************************************************************************
+ * Configuration Constants
+ *******************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/******************************************************************************
+ * Tables
+ *******************************************************************************/
+
+/******************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/******************************************************************************
+ * Variables
+ *******************************************************************************/
+
+/**
+ * @brief: boot record filled by HAL_CM4F_BootProfileStart() and HAL_CM4F_BootProfileMark(), it's read by a debugger using its symbol name
+ */
+static HAL_CM4F_BootProfile_t global_CM4F_BootProfile_t;
+
+/******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/*** End of File **************************************************************/
+#endif /*HAL_CM4F_PRIVATE_H_*/
@@ -40,6 +40,7 @@
  * |    Date            Version         Author                          Description                                                     |
  * |    15/07/2023      1.0.0           Abdelrahman Mohamed Salem       file Created.                                                      |
  * |    14/08/2023      1.0.0           Abdelrahman Mohamed Salem       add SCB reg def.                                                |
+ * |    18/10/2026      1.0.0           Abdelrahman Mohamed Salem       add DWT reg def.                                                |
  * --------------------------------------------------------------------------------------------------------------------------------------
  */
 
@@ -79,11 +80,21 @@
 #define HAL_CM4F_SRAM2_BASE_ADDR 0x2001C000	   /**< base address of the sram2 memory, size = 16 KiloByte*/
 #define HAL_CM4F_CCM_SRAM_BASE_ADDR 0x10000000 /**< base address of the core coupled sram memory, size = 64 KiloByte*/
 
+/**
+ * @brief: these are the bit-band regions and their alias regions, each bit in the 1 MegaByte bit-band region is mapped to a word in the 32 MegaByte alias region
+ */
+#define HAL_CM4F_SRAM_BIT_BAND_BASE_ADDR 0x20000000			/**< boundary address = 0x2000 0000 - 0x200F FFFF (SRAM1 and SRAM2 lie inside)*/
+#define HAL_CM4F_SRAM_BIT_BAND_ALIAS_BASE_ADDR 0x22000000	/**< boundary address = 0x2200 0000 - 0x23FF FFFF*/
+#define HAL_CM4F_PERIPH_BIT_BAND_BASE_ADDR 0x40000000		/**< boundary address = 0x4000 0000 - 0x400F FFFF (APB1, APB2 and AHB1 peripherals lie inside)*/
+#define HAL_CM4F_PERIPH_BIT_BAND_ALIAS_BASE_ADDR 0x42000000 /**< boundary address = 0x4200 0000 - 0x43FF FFFF*/
+
 /**
  * @brief: contains peripheral base addresses
  */
 #define HAL_CM4F_SCB_BASE_ADDR 0xE000ED00	/**< The System control block (SCB) provides system implementation information, and system control. This includes configuration, control, and reporting of the system exceptions.*/
 #define HAL_CM4F_ACTLR_BASE_ADDR 0xE000E008 /**< Auxiliary control register (ACTLR). By default this register is set to provide optimum performance from the Cortex-M4 processor, and does not normally require modification. The ACTLR register provides disable bits for the following processor functions: 1. IT folding. 2. write buffer use for accesses to the default memory map. 3. interruption of multi-cycle instructions.*/
+#define HAL_CM4F_DWT_BASE_ADDR 0xE0001000	/**< Data watchpoint and trace unit (DWT). It provides the cycle counter (CYCCNT) which counts core clock cycles while it's enabled, it's used to timestamp code with one cycle resolution.*/
+#define HAL_CM4F_DEMCR_BASE_ADDR 0xE000EDFC /**< Debug exception and monitor control register (DEMCR). Its TRCENA bit has to be set before DWT can be used.*/
 
 /******************************************************************************
  * Bit Definitions for registers
@@ -300,6 +311,18 @@
 #define HAL_CM4F_ACTLR_DISDEFWBUF 1 /**< This bit only affects write buffers implemented in the Cortex-M4 processor. Disables write buffer use during default memory map accesses: This causes all BusFaults to be precise BusFaults but decreases performance because any store to memory must complete before the processor can execute the next instruction.*/
 #define HAL_CM4F_ACTLR_DISMCYCINT 0 /**< Disables interrupt of multi-cycle instructions. When set to 1, disables interruption of load multiple and store multiple instructions. This increases the interrupt latency of the processor because any LDM or STM must complete before the processor can stack the current state and enter the interrupt handler.*/
 
+/**
+ * @brief: represents bit position for Debug exception and monitor control register (DEMCR), Reset value: 0x0000 0000
+ */
+
+#define HAL_CM4F_DEMCR_TRCENA_POS 24 /**< Global enable for all DWT and ITM features. DWT registers can't be used while it's 0.*/
+
+/**
+ * @brief: represents bit position for DWT control register (DWT_CTRL), Reset value: 0x4000 0000
+ */
+
+#define HAL_CM4F_DWT_CTRL_CYCCNTENA_POS 0 /**< Enables CYCCNT. It counts up by one on every core clock cycle and wraps around to zero on overflow.*/
+
 /******************************************************************************
  *
  *******************************************************************************/
@@ -331,6 +354,21 @@ typedef struct
 	__io uint32_t AFSR;		 /**< Auxiliary fault status register (AFSR). Implementation defined. The AFSR contains additional system fault information. The bits map to the AUXFAULT input signals. This register is read, write to clear. This means that bits in the register read normally, but writing 1 to any bit clears that bit to 0. Each AFSR bit maps directly to an AUXFAULT input of the processor, and a single-cycle HIGH signal on the input sets the corresponding AFSR bit to one. It remains set to 1 until you write 1 to the bit to clear it to zero. When an AFSR bit is latched as one, an exception does not occur. Use an interrupt if an exception is required.*/
 } HAL_CM4F_SCBRegDef_t;
 
+/**
+ * @brief: registers of DWT (data watchpoint and trace unit) that contain its counters
+ */
+typedef struct
+{
+	__io uint32_t CTRL;		/**< Control register. It enables the counters and gives the number of comparators implemented.*/
+	__io uint32_t CYCCNT;	/**< Cycle count register. It counts the core clock cycles while CYCCNTENA in DWT_CTRL is set.*/
+	__io uint32_t CPICNT;	/**< CPI count register. It counts the additional cycles required to execute multi-cycle instructions.*/
+	__io uint32_t EXCCNT;	/**< Exception overhead count register. It counts the cycles spent in exception entry and return.*/
+	__io uint32_t SLEEPCNT; /**< Sleep count register. It counts the cycles spent in sleep mode.*/
+	__io uint32_t LSUCNT;	/**< LSU count register. It counts the additional cycles spent in load/store instructions.*/
+	__io uint32_t FOLDCNT;	/**< Folded-instruction count register. It counts the instructions that take zero cycles.*/
+	__io uint32_t PCSR;		/**< Program counter sample register. It holds a sample of the current program counter.*/
+} HAL_CM4F_DWTRegDef_t;
+
 /******************************************************************************
  * Variables
  *******************************************************************************/
@@ -340,6 +378,8 @@ typedef struct
  */
 static __io HAL_CM4F_SCBRegDef_t *global_pSCBReg_t = (HAL_CM4F_SCBRegDef_t *)HAL_CM4F_SCB_BASE_ADDR;
 static __io uint32_t *global_pu32ACTLRreg_t = (uint32_t *)HAL_CM4F_ACTLR_BASE_ADDR;
+static __io HAL_CM4F_DWTRegDef_t *global_pDWTReg_t = (HAL_CM4F_DWTRegDef_t *)HAL_CM4F_DWT_BASE_ADDR;
+static __io uint32_t *global_pu32DEMCRreg_t = (uint32_t *)HAL_CM4F_DEMCR_BASE_ADDR;
 
 /******************************************************************************
  * Function Prototypes
@@ -0,0 +1,320 @@
+/**
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ * |    @title          :   Direct Memory Access Controller                                                                             |
+ * |    @file           :   DMA.c                                                                                                       |
+ * |    @author         :   Abdelrahman Mohamed Salem                                                                                   |
+ * |    @origin_date    :   18/10/2026                                                                                                  |
+ * |    @version        :   1.0.0                                                                                                       |
+ * |    @tool_chain     :   GNU Tools for STM32                                                                                         |
+ * |    @compiler       :   GCC                                                                                                         |
+ * |    @C_standard     :   ISO C99 (-std=c99)                                                                                          |
+ * |    @target         :   stm32f407VGTX                                                                                               |
+ * |    @notes          :   None                                                                                                        |
+ * |    @license        :   MIT License                                                                                                 |
+ * |    @brief          :   this source file contains the implementation of the functions used to program the streams of the          |
+ * |                        Direct Memory Access Controller (DMA).                                                                      |
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ * |    MIT License                                                                                                                     |
+ * |                                                                                                                                    |
+ * |    Copyright (c) - 2023 - Abdelrahman Mohamed Salem - All Rights Reserved                                                          |
+ * |                                                                                                                                    |
+ * |    Permission is hereby granted, free of charge, to any person obtaining a copy                                                    |
+ * |    of this software and associated documentation files (the "Software"), to deal                                                   |
+ * |    in the Software without restriction, including without limitation the rights                                                    |
+ * |    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                                                       |
+ * |    copies of the Software, and to permit persons to whom the Software is                                                           |
+ * |    furnished to do so, subject to the following conditions:                                                                        |
+ * |                                                                                                                                    |
+ * |    The above copyright notice and this permission notice shall be included in all                                                  |
+ * |    copies or substantial portions of the Software.                                                                                 |
+ * |                                                                                                                                    |
+ * |    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                                                      |
+ * |    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                                                        |
+ * |    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                                                     |
+ * |    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                                                          |
+ * |    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                                                   |
+ * |    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                                                   |
+ * |    SOFTWARE.                                                                                                                       |
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ * |    @history_change_list                                                                                                            |
+ * |    ====================                                                                                                            |
+ * |    Date            Version         Author                          Description                                                     |
+ * |    18/10/2026      1.0.0           Abdelrahman Mohamed Salem       Interface Created.                                              |
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ */
+
+/******************************************************************************
+ * Includes
+ *******************************************************************************/
+/**
+ * @reason: contains standard definitions for standard integers
+ */
+#include "../../lib/stdint.h"
+
+/**
+ * @reason: contains definition for NULL
+ */
+#include "../../lib/common.h"
+
+/**
+ * @reason: contains constants common values
+ */
+#include "../../lib/constants.h"
+
+/**
+ * @reason: contains useful functions that deals with bit level math
+ */
+#include "../../Lib/math_btt.h"
+
+/**
+ * @reason: contains the streams channels, directions and priorities
+ */
+#include "DMA_config.h"
+
+/**
+ * @reason: contains all the interface functions to be implemented
+ */
+#include "DMA_header.h"
+
+/**
+ * @reason: contains all register addresses and bit definitions for DMA registers
+ */
+#include "DMA_reg.h"
+
+/**
+ * @reason: contains all private function declaration and global variables
+ */
+#include "DMA_private.h"
+
+/******************************************************************************
+ * Module Preprocessor Constants
+ *******************************************************************************/
+
+/******************************************************************************
+ * Module Preprocessor Macros
+ *******************************************************************************/
+
+/**
+ * @brief: returns the registers of the controller given its index (refer to @HAL_DMA_Controllers_t in "DMA_header.h")
+ */
+#define HAL_DMA_CONTROLLER_REG(CONTROLLER) (((CONTROLLER) == HAL_DMA_CONTROLLER_1) ? global_pDMA1Reg_t : global_pDMA2Reg_t)
+
+/******************************************************************************
+ * Module Typedefs
+ *******************************************************************************/
+
+/******************************************************************************
+ * Module Variable Definitions
+ *******************************************************************************/
+
+/******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/******************************************************************************
+ * Function Definitions
+ *******************************************************************************/
+
+/**
+ *
+ */
+HAL_DMA_ErrStates_t HAL_DMA_StreamStart(const uint8_t argConst_u8Controller, const uint8_t argConst_u8Stream, const HAL_DMA_TransferConfig_t *const argConst_pTransferConfig)
+{
+    // local used variables
+    HAL_DMA_ErrStates_t local_errState_t = HAL_DMA_OK;
+    __io HAL_DMA_RegDef_t *local_pDMAReg_t = NULL;
+    __io HAL_DMA_StreamRegDef_t *local_pStreamReg_t = NULL;
+    uint32_t local_u32StreamCR = 0;
+
+    // check for errors
+    if (argConst_u8Controller >= HAL_DMA_MAX_CONTROLLER || argConst_u8Stream >= HAL_DMA_MAX_STREAM || argConst_pTransferConfig == NULL)
+    {
+        local_errState_t = HAL_DMA_ERR_INVALID_PARAMS;
+    }
+    else if (argConst_pTransferConfig->ItemsCount == 0 || argConst_pTransferConfig->Channel >= HAL_DMA2_MAX_STREAMS_CHANNELS ||
+             argConst_pTransferConfig->Direction >= HAL_DMA_MAX_STREAM_DIR || argConst_pTransferConfig->Priority >= HAL_DMA_MAX_PRIORITY_LVL ||
+             argConst_pTransferConfig->DataSize >= HAL_DMA_MAX_DATA_SIZE || argConst_pTransferConfig->MemoryIncrement >= LIB_CONSTANTS_MAX_DRIVER_STATE ||
+             argConst_pTransferConfig->CircularMode >= LIB_CONSTANTS_MAX_DRIVER_STATE)
+    {
+        local_errState_t = HAL_DMA_ERR_INVALID_PARAMS;
+    }
+    else if (argConst_pTransferConfig->Direction == HAL_DMA_DIR_MEM_TO_MEM &&
+             (argConst_u8Controller != HAL_DMA_CONTROLLER_2 || argConst_pTransferConfig->CircularMode == LIB_CONSTANTS_ENABLED))
+    {
+        // only DMA2 can do memory to memory transfers and circular mode isn't allowed for them
+        local_errState_t = HAL_DMA_ERR_INVALID_PARAMS;
+    }
+    else if (((argConst_pTransferConfig->PeripheralAddress | argConst_pTransferConfig->MemoryAddress) & HAL_DMA_DATA_SIZE_ALIGN_MASK(argConst_pTransferConfig->DataSize)) != 0)
+    {
+        local_errState_t = HAL_DMA_ADDR_NOT_ALIGNED;
+    }
+
+    // main function
+    if (local_errState_t == HAL_DMA_OK)
+    {
+        local_pDMAReg_t = HAL_DMA_CONTROLLER_REG(argConst_u8Controller);
+        local_pStreamReg_t = &local_pDMAReg_t->Streams[argConst_u8Stream];
+
+        // disable the stream and wait until the hardware releases it as the configuration registers are protected while EN is set
+        LIB_MATH_BTT_CLR_BIT(local_pStreamReg_t->DMA_SxCR, HAL_DMA_SxCR_EN);
+        while (LIB_MATH_BTT_GET_BIT(local_pStreamReg_t->DMA_SxCR, HAL_DMA_SxCR_EN) == 1)
+        {
+        };
+
+        // clear all the flags of the stream otherwise the stream can't be enabled again
+        if (argConst_u8Stream < HAL_DMA_STREAM4)
+        {
+            local_pDMAReg_t->DMA_LIFCR = HAL_DMA_STREAM_FLAGS_MASK << HAL_DMA_STREAM_FLAGS_POS(argConst_u8Stream);
+        }
+        else
+        {
+            local_pDMAReg_t->DMA_HIFCR = HAL_DMA_STREAM_FLAGS_MASK << HAL_DMA_STREAM_FLAGS_POS(argConst_u8Stream);
+        }
+
+        local_pStreamReg_t->DMA_SxPAR = argConst_pTransferConfig->PeripheralAddress;
+        local_pStreamReg_t->DMA_SxM0AR = argConst_pTransferConfig->MemoryAddress;
+        local_pStreamReg_t->DMA_SxNDTR = argConst_pTransferConfig->ItemsCount;
+
+        // direct mode isn't allowed in memory to memory transfers
+        if (argConst_pTransferConfig->Direction == HAL_DMA_DIR_MEM_TO_MEM)
+        {
+            local_pStreamReg_t->DMA_SxFCR = (1UL << HAL_DMA_SxFCR_DMDIS) | (HAL_DMA_FIFO_THRESHOLD_FULL << HAL_DMA_SxFCR_FTH);
+        }
+        else
+        {
+            local_pStreamReg_t->DMA_SxFCR = 0;
+        }
+
+        // build the whole control register then write it once
+        local_u32StreamCR = ((uint32_t)argConst_pTransferConfig->Channel << HAL_DMA_SxCR_CHSEL) |
+                            ((uint32_t)argConst_pTransferConfig->Priority << HAL_DMA_SxCR_PL) |
+                            ((uint32_t)argConst_pTransferConfig->DataSize << HAL_DMA_SxCR_MSIZE) |
+                            ((uint32_t)argConst_pTransferConfig->DataSize << HAL_DMA_SxCR_PSIZE) |
+                            ((uint32_t)argConst_pTransferConfig->MemoryIncrement << HAL_DMA_SxCR_MINC) |
+                            ((uint32_t)argConst_pTransferConfig->CircularMode << HAL_DMA_SxCR_CIRC) |
+                            ((uint32_t)argConst_pTransferConfig->Direction << HAL_DMA_SxCR_DIR);
+
+        // in memory to memory transfers the source (peripheral port) address is incremented too
+        if (argConst_pTransferConfig->Direction == HAL_DMA_DIR_MEM_TO_MEM)
+        {
+            LIB_MATH_BTT_SET_BIT(local_u32StreamCR, HAL_DMA_SxCR_PINC);
+        }
+        else
+        {
+            // do nothing
+        }
+
+        local_pStreamReg_t->DMA_SxCR = local_u32StreamCR;
+        LIB_MATH_BTT_SET_BIT(local_pStreamReg_t->DMA_SxCR, HAL_DMA_SxCR_EN);
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState_t;
+}
+
+/**
+ *
+ */
+HAL_DMA_ErrStates_t HAL_DMA_StreamStop(const uint8_t argConst_u8Controller, const uint8_t argConst_u8Stream)
+{
+    // local used variables
+    HAL_DMA_ErrStates_t local_errState_t = HAL_DMA_OK;
+    __io HAL_DMA_StreamRegDef_t *local_pStreamReg_t = NULL;
+
+    // check for errors
+    if (argConst_u8Controller >= HAL_DMA_MAX_CONTROLLER || argConst_u8Stream >= HAL_DMA_MAX_STREAM)
+    {
+        local_errState_t = HAL_DMA_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState_t == HAL_DMA_OK)
+    {
+        local_pStreamReg_t = &HAL_DMA_CONTROLLER_REG(argConst_u8Controller)->Streams[argConst_u8Stream];
+        LIB_MATH_BTT_CLR_BIT(local_pStreamReg_t->DMA_SxCR, HAL_DMA_SxCR_EN);
+        while (LIB_MATH_BTT_GET_BIT(local_pStreamReg_t->DMA_SxCR, HAL_DMA_SxCR_EN) == 1)
+        {
+        };
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState_t;
+}
+
+/**
+ *
+ */
+HAL_DMA_ErrStates_t HAL_DMA_StreamGetRemaining(const uint8_t argConst_u8Controller, const uint8_t argConst_u8Stream, uint16_t *const arg_constpu16Remaining)
+{
+    // local used variables
+    HAL_DMA_ErrStates_t local_errState_t = HAL_DMA_OK;
+
+    // check for errors
+    if (argConst_u8Controller >= HAL_DMA_MAX_CONTROLLER || argConst_u8Stream >= HAL_DMA_MAX_STREAM || arg_constpu16Remaining == NULL)
+    {
+        local_errState_t = HAL_DMA_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState_t == HAL_DMA_OK)
+    {
+        *arg_constpu16Remaining = (uint16_t)HAL_DMA_CONTROLLER_REG(argConst_u8Controller)->Streams[argConst_u8Stream].DMA_SxNDTR;
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState_t;
+}
+
+/**
+ *
+ */
+HAL_DMA_ErrStates_t HAL_DMA_StreamReadFlags(const uint8_t argConst_u8Controller, const uint8_t argConst_u8Stream, uint8_t *const arg_constpu8Flags)
+{
+    // local used variables
+    HAL_DMA_ErrStates_t local_errState_t = HAL_DMA_OK;
+    __io HAL_DMA_RegDef_t *local_pDMAReg_t = NULL;
+    uint32_t local_u32Flags = 0;
+
+    // check for errors
+    if (argConst_u8Controller >= HAL_DMA_MAX_CONTROLLER || argConst_u8Stream >= HAL_DMA_MAX_STREAM || arg_constpu8Flags == NULL)
+    {
+        local_errState_t = HAL_DMA_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState_t == HAL_DMA_OK)
+    {
+        local_pDMAReg_t = HAL_DMA_CONTROLLER_REG(argConst_u8Controller);
+
+        // streams 0 to 3 are in the low registers and streams 4 to 7 in the high ones
+        if (argConst_u8Stream < HAL_DMA_STREAM4)
+        {
+            local_u32Flags = local_pDMAReg_t->DMA_LISR & (HAL_DMA_STREAM_FLAGS_MASK << HAL_DMA_STREAM_FLAGS_POS(argConst_u8Stream));
+            local_pDMAReg_t->DMA_LIFCR = local_u32Flags;
+        }
+        else
+        {
+            local_u32Flags = local_pDMAReg_t->DMA_HISR & (HAL_DMA_STREAM_FLAGS_MASK << HAL_DMA_STREAM_FLAGS_POS(argConst_u8Stream));
+            local_pDMAReg_t->DMA_HIFCR = local_u32Flags;
+        }
+
+        *arg_constpu8Flags = (uint8_t)(local_u32Flags >> HAL_DMA_STREAM_FLAGS_POS(argConst_u8Stream));
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState_t;
+}
+
+/*************** END OF FUNCTIONS ***************************************************************************/
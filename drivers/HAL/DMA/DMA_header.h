@@ -83,6 +83,76 @@ typedef enum
 
 } HAL_DMA_ErrStates_t;
 
+/**
+ * @enum: HAL_DMA_Controllers_t
+ * @brief: used to select one of the two DMA controllers.
+ */
+typedef enum
+{
+    HAL_DMA_CONTROLLER_1 = 0, /**< DMA1 controller (its peripheral port is connected to APB1 only)*/
+    HAL_DMA_CONTROLLER_2 = 1, /**< DMA2 controller (its peripheral port is connected to the bus matrix so it can reach AHB peripherals like GPIO)*/
+    HAL_DMA_MAX_CONTROLLER,   /**< this value shall never used by the user and it's only used by implementation code to verify input*/
+} HAL_DMA_Controllers_t;
+
+/**
+ * @enum: HAL_DMA_Streams_t
+ * @brief: used to select a stream of the DMA controller.
+ */
+typedef enum
+{
+    HAL_DMA_STREAM0 = 0, /**< stream 0 of the controller*/
+    HAL_DMA_STREAM1 = 1, /**< stream 1 of the controller*/
+    HAL_DMA_STREAM2 = 2, /**< stream 2 of the controller*/
+    HAL_DMA_STREAM3 = 3, /**< stream 3 of the controller*/
+    HAL_DMA_STREAM4 = 4, /**< stream 4 of the controller*/
+    HAL_DMA_STREAM5 = 5, /**< stream 5 of the controller*/
+    HAL_DMA_STREAM6 = 6, /**< stream 6 of the controller*/
+    HAL_DMA_STREAM7 = 7, /**< stream 7 of the controller*/
+    HAL_DMA_MAX_STREAM,  /**< this value shall never used by the user and it's only used by implementation code to verify input*/
+} HAL_DMA_Streams_t;
+
+/**
+ * @enum: HAL_DMA_DataSize_t
+ * @brief: used to select the size of the data item moved on every request (peripheral and memory sides use the same size).
+ */
+typedef enum
+{
+    HAL_DMA_DATA_SIZE_BYTE = 0,      /**< 8-bit data items*/
+    HAL_DMA_DATA_SIZE_HALF_WORD = 1, /**< 16-bit data items*/
+    HAL_DMA_DATA_SIZE_WORD = 2,      /**< 32-bit data items*/
+    HAL_DMA_MAX_DATA_SIZE,           /**< this value shall never used by the user and it's only used by implementation code to verify input*/
+} HAL_DMA_DataSize_t;
+
+/**
+ * @enum: HAL_DMA_StreamFlags_t
+ * @brief: flags of a stream as returned by HAL_DMA_StreamReadFlags(), they keep the order of the flags of stream 0 in DMA_LISR.
+ */
+typedef enum
+{
+    HAL_DMA_FLAG_FIFO_ERROR = 0x01,        /**< FIFO error (FEIF)*/
+    HAL_DMA_FLAG_DIRECT_MODE_ERROR = 0x04, /**< direct mode error (DMEIF)*/
+    HAL_DMA_FLAG_TRANSFER_ERROR = 0x08,    /**< transfer error (TEIF)*/
+    HAL_DMA_FLAG_HALF_TRANSFER = 0x10,     /**< half of the items are transferred (HTIF), set on every lap in circular mode*/
+    HAL_DMA_FLAG_TRANSFER_COMPLETE = 0x20, /**< all the items are transferred (TCIF), set on every wrap in circular mode*/
+} HAL_DMA_StreamFlags_t;
+
+/**
+ * @struct: HAL_DMA_TransferConfig_t
+ * @brief: contains everything needed to program one stream for a transfer.
+ */
+typedef struct
+{
+    uint32_t PeripheralAddress; /**< address of the peripheral register (source address in case of memory to memory)*/
+    uint32_t MemoryAddress;     /**< address of the memory buffer (destination address in case of memory to memory)*/
+    uint16_t ItemsCount;        /**< number of data items to transfer (1 up to 65535)*/
+    uint8_t Channel;            /**< for possible values refer to @HAL_DMA1_StreamsChannels_t and @HAL_DMA2_StreamsChannels_t in "DMA_config.h", used to select the request source of the stream*/
+    uint8_t Direction;          /**< for possible values refer to @HAL_DMA_StreamDirection_t in "DMA_config.h", used to select the direction of the transfer*/
+    uint8_t Priority;           /**< for possible values refer to @HAL_DMA_StreamPriorityLevel_t in "DMA_config.h", used to select the priority of the stream*/
+    uint8_t DataSize;           /**< for possible values refer to @HAL_DMA_DataSize_t in "DMA_header.h", used to select the size of every data item*/
+    uint8_t MemoryIncrement;    /**< for possible values refer to @LIB_CONSTANTS_DriverStates_t in "constants.h", used to increment the memory address after every item*/
+    uint8_t CircularMode;       /**< for possible values refer to @LIB_CONSTANTS_DriverStates_t in "constants.h", used to reload the stream automatically when it reaches the end of the buffer*/
+} HAL_DMA_TransferConfig_t;
+
 /******************************************************************************
  * Variables
  *******************************************************************************/
@@ -129,5 +199,148 @@ typedef enum
  */
 // HAL_DMA_ErrStates_t HAL_DMA_BootFrom(const uint8_t argConst_u8MemoryType);
 
+/**
+ *  \b function                                 :       HAL_DMA_StreamStart(const uint8_t argConst_u8Controller, const uint8_t argConst_u8Stream, const HAL_DMA_TransferConfig_t *const argConst_pTransferConfig)
+ *  \b Description                              :       this functions is used to program a stream with the given transfer and enable it.
+ *  @param  argConst_u8Controller [IN]          :       this is input parameter and for possible values refer to @HAL_DMA_Controllers_t in "DMA_header.h", used to select the DMA controller.
+ *  @param  argConst_u8Stream [IN]              :       this is input parameter and for possible values refer to @HAL_DMA_Streams_t in "DMA_header.h", used to select the stream.
+ *  @param  argConst_pTransferConfig [IN]       :       this is input parameter which holds the address of the transfer description (refer to @HAL_DMA_TransferConfig_t in "DMA_header.h").
+ *  @note                                       :       if the stream is already running it's disabled first and all its flags are cleared before programming,
+ *                                                  direct mode is used for peripheral transfers and the FIFO is used for memory to memory transfers (only DMA2 can do them).
+ *  \b PRE-CONDITION                            :       the clock of the DMA controller is enabled.
+ *  \b POST-CONDITION                           :       the stream is enabled and waits for requests from the selected channel.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_DMA_ErrStates_t in "DMA_header.h")
+ *  @see                                        :       HAL_DMA_StreamStop(const uint8_t argConst_u8Controller, const uint8_t argConst_u8Stream)
+ *
+ *  \b Example:
+ * @code
+ * #include "DMA_header.h"
+ * uint32_t buffer[64];
+ * int main() {
+ *  HAL_DMA_TransferConfig_t local_transfer_t = {
+ *      .PeripheralAddress = 0x40021018, .MemoryAddress = (uint32_t)buffer, .ItemsCount = 64,
+ *      .Channel = HAL_DMA2_STREAM5_CH6_TIM1_UP, .Direction = HAL_DMA_DIR_MEM_TO_PERI, .Priority = HAL_DMA_STREAM_PRIORITY_LVL_VERY_HIGH,
+ *      .DataSize = HAL_DMA_DATA_SIZE_WORD, .MemoryIncrement = LIB_CONSTANTS_ENABLED, .CircularMode = LIB_CONSTANTS_DISABLED};
+ *  HAL_DMA_ErrStates_t local_errState_t = HAL_DMA_StreamStart(HAL_DMA_CONTROLLER_2, HAL_DMA_STREAM5, &local_transfer_t);
+ *  if (local_errState_t != HAL_DMA_OK)
+ *  {
+ *      // if the function returned thus means it failed.
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_DMA_ErrStates_t HAL_DMA_StreamStart(const uint8_t argConst_u8Controller, const uint8_t argConst_u8Stream, const HAL_DMA_TransferConfig_t *const argConst_pTransferConfig);
+
+/**
+ *  \b function                                 :       HAL_DMA_StreamStop(const uint8_t argConst_u8Controller, const uint8_t argConst_u8Stream)
+ *  \b Description                              :       this functions is used to disable a stream and wait until the hardware releases it.
+ *  @param  argConst_u8Controller [IN]          :       this is input parameter and for possible values refer to @HAL_DMA_Controllers_t in "DMA_header.h", used to select the DMA controller.
+ *  @param  argConst_u8Stream [IN]              :       this is input parameter and for possible values refer to @HAL_DMA_Streams_t in "DMA_header.h", used to select the stream.
+ *  @note                                       :       the current item transfer is completed by the hardware before the stream is released.
+ *  \b PRE-CONDITION                            :       the clock of the DMA controller is enabled.
+ *  \b POST-CONDITION                           :       the stream is disabled.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_DMA_ErrStates_t in "DMA_header.h")
+ *  @see                                        :       HAL_DMA_StreamStart(const uint8_t argConst_u8Controller, const uint8_t argConst_u8Stream, const HAL_DMA_TransferConfig_t *const argConst_pTransferConfig)
+ *
+ *  \b Example:
+ * @code
+ * #include "DMA_header.h"
+ * int main() {
+ *  HAL_DMA_ErrStates_t local_errState_t = HAL_DMA_StreamStop(HAL_DMA_CONTROLLER_2, HAL_DMA_STREAM5);
+ *  if (local_errState_t != HAL_DMA_OK)
+ *  {
+ *      // if the function returned thus means it failed.
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_DMA_ErrStates_t HAL_DMA_StreamStop(const uint8_t argConst_u8Controller, const uint8_t argConst_u8Stream);
+
+/**
+ *  \b function                                 :       HAL_DMA_StreamGetRemaining(const uint8_t argConst_u8Controller, const uint8_t argConst_u8Stream, uint16_t *const arg_constpu16Remaining)
+ *  \b Description                              :       this functions is used to read how many data items are left before the stream reaches the end of its buffer.
+ *  @param  argConst_u8Controller [IN]          :       this is input parameter and for possible values refer to @HAL_DMA_Controllers_t in "DMA_header.h", used to select the DMA controller.
+ *  @param  argConst_u8Stream [IN]              :       this is input parameter and for possible values refer to @HAL_DMA_Streams_t in "DMA_header.h", used to select the stream.
+ *  @param  arg_constpu16Remaining [OUT]        :       this is output parameter which will hold the number of remaining items (DMA_SxNDTR).
+ *  @note                                       :       in circular mode (ItemsCount - remaining) is the index of the next item the stream will write or read.
+ *  \b PRE-CONDITION                            :       the clock of the DMA controller is enabled.
+ *  \b POST-CONDITION                           :       None.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_DMA_ErrStates_t in "DMA_header.h")
+ *  @see                                        :       HAL_DMA_StreamStart(const uint8_t argConst_u8Controller, const uint8_t argConst_u8Stream, const HAL_DMA_TransferConfig_t *const argConst_pTransferConfig)
+ *
+ *  \b Example:
+ * @code
+ * #include "DMA_header.h"
+ * int main() {
+ *  uint16_t local_u16Remaining = 0;
+ *  HAL_DMA_ErrStates_t local_errState_t = HAL_DMA_StreamGetRemaining(HAL_DMA_CONTROLLER_2, HAL_DMA_STREAM5, &local_u16Remaining);
+ *  if (local_errState_t != HAL_DMA_OK)
+ *  {
+ *      // if the function returned thus means it failed.
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_DMA_ErrStates_t HAL_DMA_StreamGetRemaining(const uint8_t argConst_u8Controller, const uint8_t argConst_u8Stream, uint16_t *const arg_constpu16Remaining);
+
+/**
+ *  \b function                                 :       HAL_DMA_StreamReadFlags(const uint8_t argConst_u8Controller, const uint8_t argConst_u8Stream, uint8_t *const arg_constpu8Flags)
+ *  \b Description                              :       this functions is used to read the flags of a stream then clear the flags that were read.
+ *  @param  argConst_u8Controller [IN]          :       this is input parameter and for possible values refer to @HAL_DMA_Controllers_t in "DMA_header.h", used to select the DMA controller.
+ *  @param  argConst_u8Stream [IN]              :       this is input parameter and for possible values refer to @HAL_DMA_Streams_t in "DMA_header.h", used to select the stream.
+ *  @param  arg_constpu8Flags [OUT]             :       this is output parameter which will hold the flags that were set, it's a mask of @HAL_DMA_StreamFlags_t in "DMA_header.h".
+ *  @note                                       :       only the flags that were read are cleared so a flag set by the hardware just after the read is kept for the next call.
+ *  \b PRE-CONDITION                            :       the clock of the DMA controller is enabled.
+ *  \b POST-CONDITION                           :       the returned flags are cleared.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_DMA_ErrStates_t in "DMA_header.h")
+ *  @see                                        :       HAL_DMA_StreamGetRemaining(const uint8_t argConst_u8Controller, const uint8_t argConst_u8Stream, uint16_t *const arg_constpu16Remaining)
+ *
+ *  \b Example:
+ * @code
+ * #include "DMA_header.h"
+ * int main() {
+ *  uint8_t local_u8Flags = 0;
+ *  HAL_DMA_ErrStates_t local_errState_t = HAL_DMA_StreamReadFlags(HAL_DMA_CONTROLLER_2, HAL_DMA_STREAM5, &local_u8Flags);
+ *  if (local_errState_t == HAL_DMA_OK && (local_u8Flags & HAL_DMA_FLAG_TRANSFER_COMPLETE))
+ *  {
+ *      // the stream wrapped around its buffer
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_DMA_ErrStates_t HAL_DMA_StreamReadFlags(const uint8_t argConst_u8Controller, const uint8_t argConst_u8Stream, uint8_t *const arg_constpu8Flags);
+
 /*** End of File **************************************************************/
 #endif /*HAL_DMA_HEADER_H_*/
\ No newline at end of file
@@ -0,0 +1,102 @@
+/**
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ * |    @title          :   Direct Memory Access Controller                                                                             |
+ * |    @file           :   DMA_private.h                                                                                               |
+ * |    @author         :   Abdelrahman Mohamed Salem                                                                                   |
+ * |    @origin_date    :   18/10/2026                                                                                                  |
+ * |    @version        :   1.0.0                                                                                                       |
+ * |    @tool_chain     :   GNU Tools for STM32                                                                                         |
+ * |    @compiler       :   GCC                                                                                                         |
+ * |    @C_standard     :   ISO C99 (-std=c99)                                                                                          |
+ * |    @target         :   stm32f407VGTX                                                                                               |
+ * |    @notes          :   None                                                                                                        |
+ * |    @license        :   MIT License                                                                                                 |
+ * |    @brief          :   this header file contains private functions and variables for the Direct Memory Access Controller (DMA)     |
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ * |    MIT License                                                                                                                     |
+ * |                                                                                                                                    |
+ * |    Copyright (c) - 2023 - Abdelrahman Mohamed Salem - All Rights Reserved                                                          |
+ * |                                                                                                                                    |
+ * |    Permission is hereby granted, free of charge, to any person obtaining a copy                                                    |
+ * |    of this software and associated documentation files (the "Software"), to deal                                                   |
+ * |    in the Software without restriction, including without limitation the rights                                                    |
+ * |    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                                                       |
+ * |    copies of the Software, and to permit persons to whom the Software is                                                           |
+ * |    furnished to do so, subject to the following conditions:                                                                        |
+ * |                                                                                                                                    |
+ * |    The above copyright notice and this permission notice shall be included in all                                                  |
+ * |    copies or substantial portions of the Software.                                                                                 |
+ * |                                                                                                                                    |
+ * |    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                                                      |
+ * |    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                                                        |
+ * |    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                                                     |
+ * |    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                                                          |
+ * |    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                                                   |
+ * |    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                                                   |
+ * |    SOFTWARE.                                                                                                                       |
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ * |    @history_change_list                                                                                                            |
+ * |    ====================                                                                                                            |
+ * |    Date            Version         Author                          Description                                                     |
+ * |    18/10/2026      1.0.0           Abdelrahman Mohamed Salem       Interface Created.                                              |
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ */
+
+#ifndef HAL_DMA_PRIVATE_H_
+#define HAL_DMA_PRIVATE_H_
+
+/******************************************************************************
+ * Includes
+ *******************************************************************************/
+
+/******************************************************************************
+ * Preprocessor Constants
+ *******************************************************************************/
+
+/**
+ * @brief: mask of all the interrupt flags of one stream (FEIF, DMEIF, TEIF, HTIF and TCIF) before shifting it to the stream position
+ */
+#define HAL_DMA_STREAM_FLAGS_MASK 0x3DUL
+
+/**
+ * @brief: FIFO threshold value (full FIFO) used when direct mode is disabled
+ */
+#define HAL_DMA_FIFO_THRESHOLD_FULL 3UL
+
+/******************************************************************************
+ * Configuration Constants
+ *******************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/**
+ * @brief: returns the position of the first flag of the stream inside DMA_LISR/DMA_HISR (and their clear registers),
+ *         streams 0 and 4 -> 0, streams 1 and 5 -> 6, streams 2 and 6 -> 16, streams 3 and 7 -> 22
+ */
+#define HAL_DMA_STREAM_FLAGS_POS(STREAM) ((((STREAM) & 1U) * 6U) + (((STREAM) & 2U) * 8U))
+
+/**
+ * @brief: returns mask of the low address bits that must be zero for an address to be aligned with the given data size
+ */
+#define HAL_DMA_DATA_SIZE_ALIGN_MASK(DATA_SIZE) ((1UL << (DATA_SIZE)) - 1UL)
+
+/******************************************************************************
+ * Tables
+ *******************************************************************************/
+
+/******************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/******************************************************************************
+ * Variables
+ *******************************************************************************/
+
+/******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/*** End of File **************************************************************/
+#endif /*HAL_DMA_PRIVATE_H_*/
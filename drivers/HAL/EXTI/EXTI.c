@@ -0,0 +1,456 @@
+/**
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ * |    @title          :   External Interrupt/Event Controller                                                                         |
+ * |    @file           :   EXTI.c                                                                                                      |
+ * |    @author         :   Abdelrahman Mohamed Salem                                                                                   |
+ * |    @origin_date    :   18/10/2026                                                                                                  |
+ * |    @version        :   1.0.0                                                                                                       |
+ * |    @tool_chain     :   GNU Tools for STM32                                                                                         |
+ * |    @compiler       :   GCC                                                                                                         |
+ * |    @C_standard     :   ISO C99 (-std=c99)                                                                                          |
+ * |    @target         :   stm32f407VGTX                                                                                               |
+ * |    @notes          :   None                                                                                                        |
+ * |    @license        :   MIT License                                                                                                 |
+ * |    @brief          :   this source file contains the implementation of the External Interrupt/Event Controller (EXTI) driver       |
+ * |                        and the interrupt handlers of the GPIO lines.                                                               |
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ * |    MIT License                                                                                                                     |
+ * |                                                                                                                                    |
+ * |    Copyright (c) - 2026 - Abdelrahman Mohamed Salem - All Rights Reserved                                                          |
+ * |                                                                                                                                    |
+ * |    Permission is hereby granted, free of charge, to any person obtaining a copy                                                    |
+ * |    of this software and associated documentation files (the "Software"), to deal                                                   |
+ * |    in the Software without restriction, including without limitation the rights                                                    |
+ * |    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                                                       |
+ * |    copies of the Software, and to permit persons to whom the Software is                                                           |
+ * |    furnished to do so, subject to the following conditions:                                                                        |
+ * |                                                                                                                                    |
+ * |    The above copyright notice and this permission notice shall be included in all                                                  |
+ * |    copies or substantial portions of the Software.                                                                                 |
+ * |                                                                                                                                    |
+ * |    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                                                      |
+ * |    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                                                        |
+ * |    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                                                     |
+ * |    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                                                          |
+ * |    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                                                   |
+ * |    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                                                   |
+ * |    SOFTWARE.                                                                                                                       |
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ * |    @history_change_list                                                                                                            |
+ * |    ====================                                                                                                            |
+ * |    Date            Version         Author                          Description                                                     |
+ * |    18/10/2026      1.0.0           Abdelrahman Mohamed Salem       Interface Created.                                              |
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ */
+
+/******************************************************************************
+ * Includes
+ *******************************************************************************/
+/**
+ * @reason: contains standard definitions for standard integers
+ */
+#include "../../lib/stdint.h"
+
+/**
+ * @reason: contains definition for NULL
+ */
+#include "../../lib/common.h"
+
+/**
+ * @reason: contains useful functions that deals with bit level math
+ */
+#include "../../Lib/math_btt.h"
+
+/**
+ * @reason: contains all initial user configurations for EXTI
+ */
+#include "EXTI_config.h"
+
+/**
+ * @reason: contains all the interface functions to be implemented
+ */
+#include "EXTI_header.h"
+
+/**
+ * @reason: contains all register addresses and bit definitions for EXTI registers
+ */
+#include "EXTI_reg.h"
+
+/**
+ * @reason: contains all private function declaration and global variables
+ */
+#include "EXTI_private.h"
+
+/**
+ * @reason: contains the function that connects a line to a port
+ */
+#include "../SYSCFG/SYSCFG_reg.h"
+
+/**
+ * @reason: contains the pins ownership registry used by the quadrature decoder
+ */
+#include "../GPIO/GPIO_header.h"
+
+/******************************************************************************
+ * Module Preprocessor Constants
+ *******************************************************************************/
+
+/******************************************************************************
+ * Module Preprocessor Macros
+ *******************************************************************************/
+
+/******************************************************************************
+ * Module Typedefs
+ *******************************************************************************/
+
+/******************************************************************************
+ * Module Variable Definitions
+ *******************************************************************************/
+
+/******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/******************************************************************************
+ * Function Definitions
+ *******************************************************************************/
+
+/**
+ *
+ */
+HAL_EXTI_ErrStates_t HAL_EXTI_LineConfig(const uint8_t argConst_u8Line, const uint8_t argConst_u8Port, const uint8_t argConst_u8Edges)
+{
+    // local used variables
+    HAL_EXTI_ErrStates_t local_errState_t = HAL_EXTI_OK;
+
+    // check for errors
+    if (argConst_u8Line >= HAL_EXTI_MAX_LINE || argConst_u8Port >= HAL_EXTI_MAX_PORT || argConst_u8Edges >= HAL_EXTI_MAX_EDGE)
+    {
+        local_errState_t = HAL_EXTI_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState_t == HAL_EXTI_OK)
+    {
+        // mask the line while it's being changed
+        LIB_MATH_BTT_CLR_BIT(global_pEXTIReg_t->EXTI_IMR, argConst_u8Line);
+
+        HAL_SYSCFG_voidAssignEXTILine(argConst_u8Line, argConst_u8Port);
+        LIB_MATH_BTT_ASSIGN_BIT(global_pEXTIReg_t->EXTI_RTSR, argConst_u8Line, LIB_MATH_BTT_GET_BIT(argConst_u8Edges, 0));
+        LIB_MATH_BTT_ASSIGN_BIT(global_pEXTIReg_t->EXTI_FTSR, argConst_u8Line, LIB_MATH_BTT_GET_BIT(argConst_u8Edges, 1));
+
+        if (argConst_u8Edges != HAL_EXTI_EDGE_NONE)
+        {
+            global_pEXTIReg_t->EXTI_PR = 1UL << argConst_u8Line;
+            LIB_MATH_BTT_SET_BIT(global_pEXTIReg_t->EXTI_IMR, argConst_u8Line);
+        }
+        else
+        {
+            // do nothing
+        }
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState_t;
+}
+
+/**
+ *
+ */
+HAL_EXTI_ErrStates_t HAL_EXTI_RegisterCallback(const uint8_t argConst_u8Line, const functionCallBack_t argConst_pFunctionCallBack)
+{
+    // local used variables
+    HAL_EXTI_ErrStates_t local_errState_t = HAL_EXTI_OK;
+
+    // check for errors
+    if (argConst_u8Line >= HAL_EXTI_MAX_LINE || argConst_pFunctionCallBack == NULL)
+    {
+        local_errState_t = HAL_EXTI_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState_t == HAL_EXTI_OK)
+    {
+        globalArr_EXTI_LinesCallBacks_t[argConst_u8Line] = argConst_pFunctionCallBack;
+        globalArr_EXTI_LinesDecoders_t[argConst_u8Line] = NULL;
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState_t;
+}
+
+/**
+ *
+ */
+HAL_EXTI_ErrStates_t HAL_EXTI_QuadratureInit(HAL_EXTI_Quadrature_t *const arg_constpDecoder)
+{
+    // local used variables
+    HAL_EXTI_ErrStates_t local_errState_t = HAL_EXTI_OK;
+    uint32_t local_u32Input = 0;
+
+    // check for errors
+    if (arg_constpDecoder == NULL)
+    {
+        local_errState_t = HAL_EXTI_ERR_INVALID_PARAMS;
+    }
+    else if (arg_constpDecoder->Port >= HAL_EXTI_MAX_PORT || arg_constpDecoder->PinA >= HAL_EXTI_MAX_LINE || arg_constpDecoder->PinB >= HAL_EXTI_MAX_LINE || arg_constpDecoder->PinA == arg_constpDecoder->PinB)
+    {
+        local_errState_t = HAL_EXTI_ERR_INVALID_PARAMS;
+    }
+    else
+    {
+        // a decoder started again gives back its pins first so they aren't seen as claimed by another driver
+        if (globalArr_EXTI_LinesDecoders_t[arg_constpDecoder->PinA] == arg_constpDecoder && arg_constpDecoder->ClaimedPins != 0)
+        {
+            HAL_GPIO_PinsRelease((uint16_t)(1U << arg_constpDecoder->Port), arg_constpDecoder->ClaimedPins);
+        }
+        else
+        {
+            // do nothing
+        }
+
+        if (HAL_GPIO_PinsAttach((uint16_t)(1U << arg_constpDecoder->Port), (uint16_t)((1U << arg_constpDecoder->PinA) | (1U << arg_constpDecoder->PinB)), &arg_constpDecoder->ClaimedPins) != HAL_GPIO_OK)
+        {
+            local_errState_t = HAL_EXTI_ERR_PINS_CLAIMED;
+        }
+        else
+        {
+            // do nothing
+        }
+    }
+
+    // main function
+    if (local_errState_t == HAL_EXTI_OK)
+    {
+        // mask both lines so no edge is served with a half initialized decoder
+        LIB_MATH_BTT_CLR_BIT(global_pEXTIReg_t->EXTI_IMR, arg_constpDecoder->PinA);
+        LIB_MATH_BTT_CLR_BIT(global_pEXTIReg_t->EXTI_IMR, arg_constpDecoder->PinB);
+
+        arg_constpDecoder->pInputRegister = HAL_EXTI_GPIO_IDR(arg_constpDecoder->Port);
+        local_u32Input = *arg_constpDecoder->pInputRegister;
+        arg_constpDecoder->State = (uint8_t)((LIB_MATH_BTT_GET_BIT(local_u32Input, arg_constpDecoder->PinA) << 1) | LIB_MATH_BTT_GET_BIT(local_u32Input, arg_constpDecoder->PinB));
+        arg_constpDecoder->Position = 0;
+        arg_constpDecoder->Errors = 0;
+        arg_constpDecoder->Velocity = 0;
+        arg_constpDecoder->LastPosition = 0;
+
+        globalArr_EXTI_LinesDecoders_t[arg_constpDecoder->PinA] = arg_constpDecoder;
+        globalArr_EXTI_LinesDecoders_t[arg_constpDecoder->PinB] = arg_constpDecoder;
+
+        HAL_EXTI_LineConfig(arg_constpDecoder->PinA, arg_constpDecoder->Port, HAL_EXTI_EDGE_BOTH);
+        HAL_EXTI_LineConfig(arg_constpDecoder->PinB, arg_constpDecoder->Port, HAL_EXTI_EDGE_BOTH);
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState_t;
+}
+
+/**
+ *
+ */
+HAL_EXTI_ErrStates_t HAL_EXTI_QuadratureStop(HAL_EXTI_Quadrature_t *const arg_constpDecoder)
+{
+    // local used variables
+    HAL_EXTI_ErrStates_t local_errState_t = HAL_EXTI_OK;
+
+    // check for errors
+    if (arg_constpDecoder == NULL)
+    {
+        local_errState_t = HAL_EXTI_ERR_INVALID_PARAMS;
+    }
+    else if (arg_constpDecoder->Port >= HAL_EXTI_MAX_PORT || arg_constpDecoder->PinA >= HAL_EXTI_MAX_LINE || arg_constpDecoder->PinB >= HAL_EXTI_MAX_LINE)
+    {
+        local_errState_t = HAL_EXTI_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState_t == HAL_EXTI_OK)
+    {
+        // a line whose callback replaced the decoder is left as it is
+        if (globalArr_EXTI_LinesDecoders_t[arg_constpDecoder->PinA] == arg_constpDecoder)
+        {
+            HAL_EXTI_LineConfig(arg_constpDecoder->PinA, arg_constpDecoder->Port, HAL_EXTI_EDGE_NONE);
+            globalArr_EXTI_LinesDecoders_t[arg_constpDecoder->PinA] = NULL;
+        }
+        else
+        {
+            // do nothing
+        }
+
+        if (globalArr_EXTI_LinesDecoders_t[arg_constpDecoder->PinB] == arg_constpDecoder)
+        {
+            HAL_EXTI_LineConfig(arg_constpDecoder->PinB, arg_constpDecoder->Port, HAL_EXTI_EDGE_NONE);
+            globalArr_EXTI_LinesDecoders_t[arg_constpDecoder->PinB] = NULL;
+        }
+        else
+        {
+            // do nothing
+        }
+
+        if (arg_constpDecoder->ClaimedPins != 0)
+        {
+            HAL_GPIO_PinsRelease((uint16_t)(1U << arg_constpDecoder->Port), arg_constpDecoder->ClaimedPins);
+            arg_constpDecoder->ClaimedPins = 0;
+        }
+        else
+        {
+            // do nothing
+        }
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState_t;
+}
+
+/**
+ *
+ */
+HAL_EXTI_ErrStates_t HAL_EXTI_QuadratureSample(HAL_EXTI_Quadrature_t *const arg_constpDecoder, int32_t *const arg_constps32Velocity)
+{
+    // local used variables
+    HAL_EXTI_ErrStates_t local_errState_t = HAL_EXTI_OK;
+    int32_t local_s32Position = 0;
+    int32_t local_s32Delta = 0;
+
+    // check for errors
+    if (arg_constpDecoder == NULL || arg_constps32Velocity == NULL)
+    {
+        local_errState_t = HAL_EXTI_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState_t == HAL_EXTI_OK)
+    {
+        local_s32Position = arg_constpDecoder->Position;
+        local_s32Delta = (int32_t)((uint32_t)local_s32Position - (uint32_t)arg_constpDecoder->LastPosition);
+        arg_constpDecoder->LastPosition = local_s32Position;
+
+        // first order low pass filter in 1/256 counts
+        arg_constpDecoder->Velocity += ((local_s32Delta * 256) - arg_constpDecoder->Velocity) >> HAL_EXTI_QUADRATURE_VELOCITY_FILTER_SHIFT;
+        *arg_constps32Velocity = arg_constpDecoder->Velocity;
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState_t;
+}
+
+/**
+ * @brief: used as a helpful function
+ */
+static void HAL_EXTI_QuadratureStep(HAL_EXTI_Quadrature_t *const arg_constpDecoder)
+{
+    // local used variables
+    uint32_t local_u32Input = *arg_constpDecoder->pInputRegister;
+    uint8_t local_u8State = (uint8_t)((((local_u32Input >> arg_constpDecoder->PinA) & 1UL) << 1) | ((local_u32Input >> arg_constpDecoder->PinB) & 1UL));
+    uint8_t local_u8Transition = (uint8_t)((arg_constpDecoder->State << 2) | local_u8State);
+
+    arg_constpDecoder->Position += globalConstArr_EXTI_QuadratureSteps_t[local_u8Transition];
+    arg_constpDecoder->Errors += (HAL_EXTI_QUADRATURE_INVALID_TRANSITIONS >> local_u8Transition) & 1UL;
+    arg_constpDecoder->State = local_u8State;
+}
+
+/**
+ * @brief: used as a helpful function
+ */
+static void HAL_EXTI_DispatchLines(const uint32_t argConst_u32LinesMask)
+{
+    // local used variables
+    uint32_t local_u32PendingLines = global_pEXTIReg_t->EXTI_PR & global_pEXTIReg_t->EXTI_IMR & argConst_u32LinesMask;
+    uint8_t local_u8Line = 0;
+
+    // clear all the lines that will be served with one write
+    global_pEXTIReg_t->EXTI_PR = local_u32PendingLines;
+
+    while (local_u32PendingLines != 0)
+    {
+        // count trailing zeros (RBIT + CLZ on cortex-M4) to reach the line directly
+        local_u8Line = (uint8_t)__builtin_ctz(local_u32PendingLines);
+        local_u32PendingLines &= local_u32PendingLines - 1;
+
+        if (globalArr_EXTI_LinesDecoders_t[local_u8Line] != NULL)
+        {
+            HAL_EXTI_QuadratureStep(globalArr_EXTI_LinesDecoders_t[local_u8Line]);
+        }
+        else if (globalArr_EXTI_LinesCallBacks_t[local_u8Line] != NULL)
+        {
+            globalArr_EXTI_LinesCallBacks_t[local_u8Line]();
+        }
+        else
+        {
+            // do nothing
+        }
+    }
+}
+
+/**
+ * @brief: interrupt handler for EXTI line 0
+ */
+void EXTI0_IRQHandler(void)
+{
+    HAL_EXTI_DispatchLines(1UL << HAL_EXTI_LINE0);
+}
+
+/**
+ * @brief: interrupt handler for EXTI line 1
+ */
+void EXTI1_IRQHandler(void)
+{
+    HAL_EXTI_DispatchLines(1UL << HAL_EXTI_LINE1);
+}
+
+/**
+ * @brief: interrupt handler for EXTI line 2
+ */
+void EXTI2_IRQHandler(void)
+{
+    HAL_EXTI_DispatchLines(1UL << HAL_EXTI_LINE2);
+}
+
+/**
+ * @brief: interrupt handler for EXTI line 3
+ */
+void EXTI3_IRQHandler(void)
+{
+    HAL_EXTI_DispatchLines(1UL << HAL_EXTI_LINE3);
+}
+
+/**
+ * @brief: interrupt handler for EXTI line 4
+ */
+void EXTI4_IRQHandler(void)
+{
+    HAL_EXTI_DispatchLines(1UL << HAL_EXTI_LINE4);
+}
+
+/**
+ * @brief: interrupt handler for EXTI lines from 5 to 9
+ */
+void EXTI9_5_IRQHandler(void)
+{
+    HAL_EXTI_DispatchLines(HAL_EXTI_LINES_9_5_MASK);
+}
+
+/**
+ * @brief: interrupt handler for EXTI lines from 10 to 15
+ */
+void EXTI15_10_IRQHandler(void)
+{
+    HAL_EXTI_DispatchLines(HAL_EXTI_LINES_15_10_MASK);
+}
+
+/*************** END OF FUNCTIONS ***************************************************************************/
@@ -0,0 +1,349 @@
+/**
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ * |    @title          :   External Interrupt/Event Controller                                                                         |
+ * |    @file           :   EXTI_header.h                                                                                               |
+ * |    @author         :   Abdelrahman Mohamed Salem                                                                                   |
+ * |    @origin_date    :   18/10/2026                                                                                                  |
+ * |    @version        :   1.0.0                                                                                                       |
+ * |    @tool_chain     :   GNU Tools for STM32                                                                                         |
+ * |    @compiler       :   GCC                                                                                                         |
+ * |    @C_standard     :   ISO C99 (-std=c99)                                                                                          |
+ * |    @target         :   stm32f407VGTX                                                                                               |
+ * |    @notes          :   None                                                                                                        |
+ * |    @license        :   MIT License                                                                                                 |
+ * |    @brief          :   this header file contains useful functions to interface with the External Interrupt/Event Controller (EXTI) |
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ * |    MIT License                                                                                                                     |
+ * |                                                                                                                                    |
+ * |    Copyright (c) - 2026 - Abdelrahman Mohamed Salem - All Rights Reserved                                                          |
+ * |                                                                                                                                    |
+ * |    Permission is hereby granted, free of charge, to any person obtaining a copy                                                    |
+ * |    of this software and associated documentation files (the "Software"), to deal                                                   |
+ * |    in the Software without restriction, including without limitation the rights                                                    |
+ * |    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                                                       |
+ * |    copies of the Software, and to permit persons to whom the Software is                                                           |
+ * |    furnished to do so, subject to the following conditions:                                                                        |
+ * |                                                                                                                                    |
+ * |    The above copyright notice and this permission notice shall be included in all                                                  |
+ * |    copies or substantial portions of the Software.                                                                                 |
+ * |                                                                                                                                    |
+ * |    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                                                      |
+ * |    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                                                        |
+ * |    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                                                     |
+ * |    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                                                          |
+ * |    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                                                   |
+ * |    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                                                   |
+ * |    SOFTWARE.                                                                                                                       |
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ * |    @history_change_list                                                                                                            |
+ * |    ====================                                                                                                            |
+ * |    Date            Version         Author                          Description                                                     |
+ * |    18/10/2026      1.0.0           Abdelrahman Mohamed Salem       Interface Created.                                              |
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ */
+
+#ifndef HAL_EXTI_HEADER_H_
+#define HAL_EXTI_HEADER_H_
+
+/******************************************************************************
+ * Includes
+ *******************************************************************************/
+
+/**
+ * @reason: contains standard integer definition
+ */
+#include "../../lib/stdint.h"
+
+/**
+ * @reason: contains definition of functionCallBack_t
+ */
+#include "../../lib/common.h"
+
+/******************************************************************************
+ * Preprocessor Constants
+ *******************************************************************************/
+
+/******************************************************************************
+ * Configuration Constants
+ *******************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/******************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/**
+ * @enum: HAL_EXTI_ErrStates_t
+ * @brief: contains all possible errors that can result from dealing with the EXTI.
+ */
+typedef enum
+{
+    HAL_EXTI_OK,                 /**< it means everything has gone as intended so no errors*/
+    HAL_EXTI_ERR_INVALID_PARAMS, /**< it means that the supplied parameters of the function are invalid*/
+    HAL_EXTI_ERR_PINS_CLAIMED,   /**< it means that one of the pins of a decoder is claimed by another driver (refer to HAL_GPIO_PinsAttach() in "GPIO_header.h")*/
+} HAL_EXTI_ErrStates_t;
+
+/**
+ * @enum: HAL_EXTI_Lines_t
+ * @brief: GPIO lines of the EXTI, line x is connected to pin x of the port selected for it.
+ */
+typedef enum
+{
+    HAL_EXTI_LINE0,    /**< EXTI line 0, served by EXTI0_IRQHandler*/
+    HAL_EXTI_LINE1,    /**< EXTI line 1, served by EXTI1_IRQHandler*/
+    HAL_EXTI_LINE2,    /**< EXTI line 2, served by EXTI2_IRQHandler*/
+    HAL_EXTI_LINE3,    /**< EXTI line 3, served by EXTI3_IRQHandler*/
+    HAL_EXTI_LINE4,    /**< EXTI line 4, served by EXTI4_IRQHandler*/
+    HAL_EXTI_LINE5,    /**< EXTI line 5, served by EXTI9_5_IRQHandler*/
+    HAL_EXTI_LINE6,    /**< EXTI line 6, served by EXTI9_5_IRQHandler*/
+    HAL_EXTI_LINE7,    /**< EXTI line 7, served by EXTI9_5_IRQHandler*/
+    HAL_EXTI_LINE8,    /**< EXTI line 8, served by EXTI9_5_IRQHandler*/
+    HAL_EXTI_LINE9,    /**< EXTI line 9, served by EXTI9_5_IRQHandler*/
+    HAL_EXTI_LINE10,   /**< EXTI line 10, served by EXTI15_10_IRQHandler*/
+    HAL_EXTI_LINE11,   /**< EXTI line 11, served by EXTI15_10_IRQHandler*/
+    HAL_EXTI_LINE12,   /**< EXTI line 12, served by EXTI15_10_IRQHandler*/
+    HAL_EXTI_LINE13,   /**< EXTI line 13, served by EXTI15_10_IRQHandler*/
+    HAL_EXTI_LINE14,   /**< EXTI line 14, served by EXTI15_10_IRQHandler*/
+    HAL_EXTI_LINE15,   /**< EXTI line 15, served by EXTI15_10_IRQHandler*/
+    HAL_EXTI_MAX_LINE, /**< that value should never be used and it's only used by the implementation code for verifying the input*/
+} HAL_EXTI_Lines_t;
+
+/**
+ * @enum: HAL_EXTI_Ports_t
+ * @brief: ports that can be connected to a GPIO line (the values are the ones expected by SYSCFG_EXTICR).
+ */
+typedef enum
+{
+    HAL_EXTI_PORTA,    /**< line x is connected to PAx*/
+    HAL_EXTI_PORTB,    /**< line x is connected to PBx*/
+    HAL_EXTI_PORTC,    /**< line x is connected to PCx*/
+    HAL_EXTI_PORTD,    /**< line x is connected to PDx*/
+    HAL_EXTI_PORTE,    /**< line x is connected to PEx*/
+    HAL_EXTI_PORTF,    /**< line x is connected to PFx*/
+    HAL_EXTI_PORTG,    /**< line x is connected to PGx*/
+    HAL_EXTI_PORTH,    /**< line x is connected to PHx*/
+    HAL_EXTI_PORTI,    /**< line x is connected to PIx*/
+    HAL_EXTI_MAX_PORT, /**< that value should never be used and it's only used by the implementation code for verifying the input*/
+} HAL_EXTI_Ports_t;
+
+/**
+ * @struct: HAL_EXTI_Quadrature_t
+ * @brief: holds a quadrature encoder decoded in software from the edges of its two channels, the first group of members is filled by the user and the rest is used by the implementation code.
+ */
+typedef struct
+{
+    uint8_t Port; /**< for possible values refer to @HAL_EXTI_Ports_t in "EXTI_header.h", port of both channels*/
+    uint8_t PinA; /**< for possible values refer to @HAL_EXTI_Lines_t in "EXTI_header.h", pin of channel A (leads channel B when moving forward)*/
+    uint8_t PinB; /**< for possible values refer to @HAL_EXTI_Lines_t in "EXTI_header.h", pin of channel B*/
+
+    __io int32_t Position;               /**< position in counts (4 counts per encoder cycle), updated from the interrupt*/
+    __io uint32_t Errors;                /**< number of transitions where both channels changed which means at least one edge was missed*/
+    int32_t Velocity;                    /**< filtered counts per sample period in 1/256 counts, updated by HAL_EXTI_QuadratureSample()*/
+    int32_t LastPosition;                /**< position at the last call of HAL_EXTI_QuadratureSample(), shall not be modified by the user*/
+    const __io uint32_t *pInputRegister; /**< input data register of the port, shall not be modified by the user*/
+    uint8_t State;                       /**< last (A << 1) | B state, shall not be modified by the user*/
+    uint16_t ClaimedPins;                /**< pins claimed by HAL_EXTI_QuadratureInit() and released by HAL_EXTI_QuadratureStop(), shall not be modified by the user*/
+} HAL_EXTI_Quadrature_t;
+/**
+ * @enum: HAL_EXTI_Edges_t
+ * @brief: edges that fire the interrupt of a line.
+ */
+typedef enum
+{
+    HAL_EXTI_EDGE_NONE = 0,    /**< line interrupt is disabled*/
+    HAL_EXTI_EDGE_RISING = 1,  /**< interrupt on rising edges only*/
+    HAL_EXTI_EDGE_FALLING = 2, /**< interrupt on falling edges only*/
+    HAL_EXTI_EDGE_BOTH = 3,    /**< interrupt on both edges*/
+    HAL_EXTI_MAX_EDGE,         /**< that value should never be used and it's only used by the implementation code for verifying the input*/
+} HAL_EXTI_Edges_t;
+
+/******************************************************************************
+ * Variables
+ *******************************************************************************/
+
+/******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/**
+ *  \b function                                 :       HAL_EXTI_LineConfig(const uint8_t argConst_u8Line, const uint8_t argConst_u8Port, const uint8_t argConst_u8Edges)
+ *  \b Description                              :       this functions is used to connect a GPIO line to a port, select its trigger edges and enable or disable its interrupt.
+ *  @param  argConst_u8Line [IN]                :       this is input parameter and for possible values refer to @HAL_EXTI_Lines_t in "EXTI_header.h", used to select the line (same as the pin number).
+ *  @param  argConst_u8Port [IN]                :       this is input parameter and for possible values refer to @HAL_EXTI_Ports_t in "EXTI_header.h", used to select which port drives the line.
+ *  @param  argConst_u8Edges [IN]               :       this is input parameter and for possible values refer to @HAL_EXTI_Edges_t in "EXTI_header.h", @HAL_EXTI_EDGE_NONE masks the line.
+ *  @note                                       :       any pending request of the line is cleared before the line is unmasked.
+ *  \b PRE-CONDITION                            :       SYSCFG clock is enabled, the pin is configured as input and the interrupt of the line is enabled in NVIC.
+ *  \b POST-CONDITION                           :       the callback of the line is called on every selected edge.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_EXTI_ErrStates_t in "EXTI_header.h")
+ *  @see                                        :       HAL_EXTI_RegisterCallback(const uint8_t argConst_u8Line, const functionCallBack_t argConst_pFunctionCallBack)
+ *
+ *  \b Example:
+ * @code
+ * #include "EXTI_header.h"
+ * int main() {
+ *  HAL_EXTI_ErrStates_t local_errState_t = HAL_EXTI_LineConfig(HAL_EXTI_LINE13, HAL_EXTI_PORTC, HAL_EXTI_EDGE_FALLING);
+ *  if (local_errState_t != HAL_EXTI_OK)
+ *  {
+ *      // if the function returned thus means it failed.
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_EXTI_ErrStates_t HAL_EXTI_LineConfig(const uint8_t argConst_u8Line, const uint8_t argConst_u8Port, const uint8_t argConst_u8Edges);
+
+/**
+ *  \b function                                 :       HAL_EXTI_RegisterCallback(const uint8_t argConst_u8Line, const functionCallBack_t argConst_pFunctionCallBack)
+ *  \b Description                              :       this functions is used to register the function to be called from the interrupt handler when the line fires.
+ *  @param  argConst_u8Line [IN]                :       this is input parameter and for possible values refer to @HAL_EXTI_Lines_t in "EXTI_header.h".
+ *  @param  argConst_pFunctionCallBack [IN]     :       this is input parameter which holds the address of the function to be called.
+ *  @note                                       :       lines sharing one vector (5 to 9 and 10 to 15) are demultiplexed by counting the trailing zeros of the pending lines
+ *                                                  so the cost of reaching a callback doesn't depend on the line number.
+ *  \b PRE-CONDITION                            :       None.
+ *  \b POST-CONDITION                           :       None.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_EXTI_ErrStates_t in "EXTI_header.h")
+ *  @see                                        :       HAL_EXTI_LineConfig(const uint8_t argConst_u8Line, const uint8_t argConst_u8Port, const uint8_t argConst_u8Edges)
+ *
+ *  \b Example:
+ * @code
+ * #include "EXTI_header.h"
+ * void buttonPressed(void)
+ * {
+ *  // called on every falling edge of PC13
+ * }
+ * int main() {
+ *  HAL_EXTI_RegisterCallback(HAL_EXTI_LINE13, buttonPressed);
+ *  HAL_EXTI_ErrStates_t local_errState_t = HAL_EXTI_LineConfig(HAL_EXTI_LINE13, HAL_EXTI_PORTC, HAL_EXTI_EDGE_FALLING);
+ *  if (local_errState_t != HAL_EXTI_OK)
+ *  {
+ *      // if the function returned thus means it failed.
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_EXTI_ErrStates_t HAL_EXTI_RegisterCallback(const uint8_t argConst_u8Line, const functionCallBack_t argConst_pFunctionCallBack);
+
+/**
+ *  \b function                                 :       HAL_EXTI_QuadratureInit(HAL_EXTI_Quadrature_t *const arg_constpDecoder)
+ *  \b Description                              :       this functions is used to start decoding a quadrature encoder from both edges of its two channels, every edge reads both channels
+ *                                                  from one snapshot of GPIOx_IDR and the move is taken from a 16 entries table indexed by the previous and current states.
+ *  @param  arg_constpDecoder [IN/OUT]          :       this is input/output parameter which holds the decoder (refer to @HAL_EXTI_Quadrature_t in "EXTI_header.h"), it shall stay alive while the lines are used.
+ *  @note                                       :       the decoder takes the place of any callback registered on both lines, registering a callback later on any of them detaches the decoder from that line,
+ *                                                  the interrupt work is one load, one table lookup and two additions so the edge rate is only limited by the interrupt latency.
+ *                                                  both pins are attached to the decoder (refer to HAL_GPIO_PinsAttach() in "GPIO_header.h") till HAL_EXTI_QuadratureStop() is called,
+ *                                                  @HAL_EXTI_ERR_PINS_CLAIMED is returned if one of them is claimed by another driver.
+ *  \b PRE-CONDITION                            :       SYSCFG clock is enabled, both pins are configured as inputs and the interrupts of both lines are enabled in NVIC.
+ *  \b POST-CONDITION                           :       Position follows the encoder.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_EXTI_ErrStates_t in "EXTI_header.h")
+ *  @see                                        :       HAL_EXTI_QuadratureSample(HAL_EXTI_Quadrature_t *const arg_constpDecoder, int32_t *const arg_constps32Velocity)
+ *
+ *  \b Example:
+ * @code
+ * #include "EXTI_header.h"
+ * HAL_EXTI_Quadrature_t global_encoder_t = {.Port = HAL_EXTI_PORTE, .PinA = HAL_EXTI_LINE2, .PinB = HAL_EXTI_LINE3};
+ * int main() {
+ *  HAL_EXTI_ErrStates_t local_errState_t = HAL_EXTI_QuadratureInit(&global_encoder_t);
+ *  if (local_errState_t != HAL_EXTI_OK)
+ *  {
+ *      // if the function returned thus means it failed.
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.1            </td><td> AMS      </td><td> encoder pins are claimed </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_EXTI_ErrStates_t HAL_EXTI_QuadratureInit(HAL_EXTI_Quadrature_t *const arg_constpDecoder);
+
+/**
+ *  \b function                                 :       HAL_EXTI_QuadratureStop(HAL_EXTI_Quadrature_t *const arg_constpDecoder)
+ *  \b Description                              :       this functions is used to stop decoding a quadrature encoder started by HAL_EXTI_QuadratureInit().
+ *  @param  arg_constpDecoder [IN/OUT]          :       this is input/output parameter which holds the decoder started by HAL_EXTI_QuadratureInit().
+ *  @note                                       :       the interrupts of both lines are masked, the decoder is detached from them and the pins it claimed are released, Position keeps its last value.
+ *  \b PRE-CONDITION                            :       HAL_EXTI_QuadratureInit() is called.
+ *  \b POST-CONDITION                           :       Position doesn't follow the encoder anymore.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_EXTI_ErrStates_t in "EXTI_header.h")
+ *  @see                                        :       HAL_EXTI_QuadratureInit(HAL_EXTI_Quadrature_t *const arg_constpDecoder)
+ *
+ *  \b Example:
+ * @code
+ * #include "EXTI_header.h"
+ * extern HAL_EXTI_Quadrature_t global_encoder_t;
+ * int main() {
+ *  HAL_EXTI_ErrStates_t local_errState_t = HAL_EXTI_QuadratureStop(&global_encoder_t);
+ *  if (local_errState_t != HAL_EXTI_OK)
+ *  {
+ *      // if the function returned thus means it failed.
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_EXTI_ErrStates_t HAL_EXTI_QuadratureStop(HAL_EXTI_Quadrature_t *const arg_constpDecoder);
+
+/**
+ *  \b function                                 :       HAL_EXTI_QuadratureSample(HAL_EXTI_Quadrature_t *const arg_constpDecoder, int32_t *const arg_constps32Velocity)
+ *  \b Description                              :       this functions is used to update the velocity estimate of the decoder from the counts moved since the last call.
+ *  @param  arg_constpDecoder [IN/OUT]          :       this is input/output parameter which holds the decoder started by HAL_EXTI_QuadratureInit().
+ *  @param  arg_constps32Velocity [OUT]         :       this is output parameter which will hold the filtered velocity in 1/256 counts per sample period.
+ *  @note                                       :       the velocity is filtered by HAL_EXTI_QUADRATURE_VELOCITY_FILTER_SHIFT in "EXTI_config.h",
+ *                                                  the position is read once (one aligned 32-bit load) so it's safe against the interrupt.
+ *  \b PRE-CONDITION                            :       it's called with a fixed period (from a timer interrupt for example).
+ *  \b POST-CONDITION                           :       None.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_EXTI_ErrStates_t in "EXTI_header.h")
+ *  @see                                        :       HAL_EXTI_QuadratureInit(HAL_EXTI_Quadrature_t *const arg_constpDecoder)
+ *
+ *  \b Example:
+ * @code
+ * #include "EXTI_header.h"
+ * extern HAL_EXTI_Quadrature_t global_encoder_t;
+ * void every1ms(void)
+ * {
+ *  int32_t local_s32Velocity = 0;
+ *  HAL_EXTI_QuadratureSample(&global_encoder_t, &local_s32Velocity);
+ *  // local_s32Velocity * 1000 / 256 is the speed in counts per second
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_EXTI_ErrStates_t HAL_EXTI_QuadratureSample(HAL_EXTI_Quadrature_t *const arg_constpDecoder, int32_t *const arg_constps32Velocity);
+
+/*** End of File **************************************************************/
+#endif /*HAL_EXTI_HEADER_H_*/
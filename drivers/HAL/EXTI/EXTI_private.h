@@ -0,0 +1,150 @@
+/**
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ * |    @title          :   External Interrupt/Event Controller                                                                         |
+ * |    @file           :   EXTI_private.h                                                                                              |
+ * |    @author         :   Abdelrahman Mohamed Salem                                                                                   |
+ * |    @origin_date    :   18/10/2026                                                                                                  |
+ * |    @version        :   1.0.0                                                                                                       |
+ * |    @tool_chain     :   GNU Tools for STM32                                                                                         |
+ * |    @compiler       :   GCC                                                                                                         |
+ * |    @C_standard     :   ISO C99 (-std=c99)                                                                                          |
+ * |    @target         :   stm32f407VGTX                                                                                               |
+ * |    @notes          :   None                                                                                                        |
+ * |    @license        :   MIT License                                                                                                 |
+ * |    @brief          :   this header file contains private functions and variables for the External Interrupt/Event Controller       |
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ * |    MIT License                                                                                                                     |
+ * |                                                                                                                                    |
+ * |    Copyright (c) - 2026 - Abdelrahman Mohamed Salem - All Rights Reserved                                                          |
+ * |                                                                                                                                    |
+ * |    Permission is hereby granted, free of charge, to any person obtaining a copy                                                    |
+ * |    of this software and associated documentation files (the "Software"), to deal                                                   |
+ * |    in the Software without restriction, including without limitation the rights                                                    |
+ * |    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                                                       |
+ * |    copies of the Software, and to permit persons to whom the Software is                                                           |
+ * |    furnished to do so, subject to the following conditions:                                                                        |
+ * |                                                                                                                                    |
+ * |    The above copyright notice and this permission notice shall be included in all                                                  |
+ * |    copies or substantial portions of the Software.                                                                                 |
+ * |                                                                                                                                    |
+ * |    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                                                      |
+ * |    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                                                        |
+ * |    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                                                     |
+ * |    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                                                          |
+ * |    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                                                   |
+ * |    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                                                   |
+ * |    SOFTWARE.                                                                                                                       |
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ * |    @history_change_list                                                                                                            |
+ * |    ====================                                                                                                            |
+ * |    Date            Version         Author                          Description                                                     |
+ * |    18/10/2026      1.0.0           Abdelrahman Mohamed Salem       Interface Created.                                              |
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ */
+
+#ifndef HAL_EXTI_PRIVATE_H_
+#define HAL_EXTI_PRIVATE_H_
+
+/******************************************************************************
+ * Includes
+ *******************************************************************************/
+
+/**
+ * @reason: contains definition of functionCallBack_t and NULL
+ */
+#include "../../lib/common.h"
+
+/**
+ * @reason: contains base address of AHB1 bus where GPIO ports live
+ */
+#include "../CM4F/CM4F_reg.h"
+
+/******************************************************************************
+ * Preprocessor Constants
+ *******************************************************************************/
+
+/**
+ * @brief: lines sharing one interrupt vector
+ */
+#define HAL_EXTI_LINES_9_5_MASK 0x000003E0UL   /**< lines 5 to 9 served by EXTI9_5_IRQHandler*/
+#define HAL_EXTI_LINES_15_10_MASK 0x0000FC00UL /**< lines 10 to 15 served by EXTI15_10_IRQHandler*/
+
+/**
+ * @brief: GPIO ports layout used to reach the input data register of a port without depending on the GPIO driver
+ */
+#define HAL_EXTI_GPIO_PORT_SIZE 0x00000400UL  /**< distance between two consecutive GPIO ports on AHB1*/
+#define HAL_EXTI_GPIO_IDR_OFFSET 0x00000010UL /**< offset of GPIOx_IDR inside the port*/
+
+/**
+ * @brief: transitions of the quadrature state machine where both channels changed (indexes 3, 6, 9 and 12), bit n is set if transition n is invalid
+ */
+#define HAL_EXTI_QUADRATURE_INVALID_TRANSITIONS 0x1248UL
+
+/******************************************************************************
+ * Configuration Constants
+ *******************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/**
+ * @brief: returns address of the input data register of the port (refer to @HAL_EXTI_Ports_t in "EXTI_header.h")
+ */
+#define HAL_EXTI_GPIO_IDR(PORT) ((const __io uint32_t *)(HAL_CM4F_AHB1_BASEADDR + ((uint32_t)(PORT) * HAL_EXTI_GPIO_PORT_SIZE) + HAL_EXTI_GPIO_IDR_OFFSET))
+
+/******************************************************************************
+ * Tables
+ *******************************************************************************/
+
+/**
+ * @brief: counts moved by every transition of the quadrature state machine indexed by (previous state << 2) | current state where state is (A << 1) | B,
+ *         forward sequence is 00 -> 10 -> 11 -> 01 -> 00, no change and invalid transitions (both channels changed) don't move
+ */
+static const int8_t globalConstArr_EXTI_QuadratureSteps_t[16] = {
+    0, -1, +1, 0,
+    +1, 0, 0, -1,
+    -1, 0, 0, +1,
+    0, +1, -1, 0};
+
+/******************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/******************************************************************************
+ * Variables
+ *******************************************************************************/
+
+/**
+ * @brief: Callback functions of every GPIO line indexed by the line number
+ */
+static functionCallBack_t globalArr_EXTI_LinesCallBacks_t[HAL_EXTI_MAX_LINE] = {
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL};
+
+/**
+ * @brief: quadrature decoders attached to every GPIO line indexed by the line number, a decoder is served instead of the callback of its lines
+ */
+static HAL_EXTI_Quadrature_t *globalArr_EXTI_LinesDecoders_t[HAL_EXTI_MAX_LINE] = {
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL};
+
+/******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+/**
+ * @brief: this function clears the pending lines inside the given mask and calls their callbacks, lowest line first
+ */
+static void HAL_EXTI_DispatchLines(const uint32_t argConst_u32LinesMask);
+
+/**
+ * @brief: this function moves the decoder position by the transition between its last state and the current state of its channels
+ */
+static void HAL_EXTI_QuadratureStep(HAL_EXTI_Quadrature_t *const arg_constpDecoder);
+
+/*** End of File **************************************************************/
+#endif /*HAL_EXTI_PRIVATE_H_*/
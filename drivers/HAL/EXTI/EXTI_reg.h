@@ -0,0 +1,112 @@
+/**
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ * |    @title          :   External Interrupt/Event Controller                                                                         |
+ * |    @file           :   EXTI_reg.h                                                                                                  |
+ * |    @author         :   Abdelrahman Mohamed Salem                                                                                   |
+ * |    @origin_date    :   18/10/2026                                                                                                  |
+ * |    @version        :   1.0.0                                                                                                       |
+ * |    @tool_chain     :   GNU Tools for STM32                                                                                         |
+ * |    @compiler       :   GCC                                                                                                         |
+ * |    @C_standard     :   ISO C99 (-std=c99)                                                                                          |
+ * |    @target         :   stm32f407VGTX                                                                                               |
+ * |    @notes          :   None                                                                                                        |
+ * |    @license        :   MIT License                                                                                                 |
+ * |    @brief          :   this file contains registers addresses and definitions structs that deals with EXTI registers               |
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ * |    MIT License                                                                                                                     |
+ * |                                                                                                                                    |
+ * |    Copyright (c) - 2026 - Abdelrahman Mohamed Salem - All Rights Reserved                                                          |
+ * |                                                                                                                                    |
+ * |    Permission is hereby granted, free of charge, to any person obtaining a copy                                                    |
+ * |    of this software and associated documentation files (the "Software"), to deal                                                   |
+ * |    in the Software without restriction, including without limitation the rights                                                    |
+ * |    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                                                       |
+ * |    copies of the Software, and to permit persons to whom the Software is                                                           |
+ * |    furnished to do so, subject to the following conditions:                                                                        |
+ * |                                                                                                                                    |
+ * |    The above copyright notice and this permission notice shall be included in all                                                  |
+ * |    copies or substantial portions of the Software.                                                                                 |
+ * |                                                                                                                                    |
+ * |    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                                                      |
+ * |    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                                                        |
+ * |    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                                                     |
+ * |    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                                                          |
+ * |    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                                                   |
+ * |    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                                                   |
+ * |    SOFTWARE.                                                                                                                       |
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ * |    @history_change_list                                                                                                            |
+ * |    ====================                                                                                                            |
+ * |    Date            Version         Author                          Description                                                     |
+ * |    18/10/2026      1.0.0           Abdelrahman Mohamed Salem       Interface Created.                                              |
+ * --------------------------------------------------------------------------------------------------------------------------------------
+ */
+
+#ifndef HAL_EXTI_REG_H_
+#define HAL_EXTI_REG_H_
+
+/******************************************************************************
+ * Includes
+ *******************************************************************************/
+/**
+ * @reason: contains standard definitions for the integer variables
+ */
+#include "../../lib/stdint.h"
+
+/**
+ * @reason: contains base addresses of APB2 bus
+ */
+#include "../CM4F/CM4F_reg.h"
+
+/**
+ * @reason: contains volatile keyword definition regarding selected compiler
+ */
+#include "../../lib/common.h"
+
+/******************************************************************************
+ * Preprocessor Constants
+ *******************************************************************************/
+
+/**
+ * @brief: this is the base address of EXTI registers used to configure the external interrupts/events lines
+ * @note: it will be referred to as @HAL_EXTI_BASE_ADDR
+ */
+#define HAL_EXTI_OFFSET 0x00003C00 /**< this is the offset of the EXTI register from APB2 bus base address*/
+
+/******************************************************************************
+ * Configuration Constants
+ *******************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/******************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/**
+ * @brief: this holds all registers used to configure EXTI, bit x of every register belongs to line x
+ */
+typedef struct
+{
+    __io uint32_t EXTI_IMR;   /**< Interrupt mask register. 0: interrupt request from line x is masked, 1: interrupt request from line x is not masked.*/
+    __io uint32_t EXTI_EMR;   /**< Event mask register. 0: event request from line x is masked, 1: event request from line x is not masked.*/
+    __io uint32_t EXTI_RTSR;  /**< Rising trigger selection register. 1: rising trigger enabled (for event and interrupt) for input line.*/
+    __io uint32_t EXTI_FTSR;  /**< Falling trigger selection register. 1: falling trigger enabled (for event and interrupt) for input line.*/
+    __io uint32_t EXTI_SWIER; /**< Software interrupt event register. Writing 1 sets the pending bit of the line if its interrupt is enabled.*/
+    __io uint32_t EXTI_PR;    /**< Pending register. This bit is set when the selected edge event arrives on the line, it's cleared by writing 1 to it.*/
+} HAL_EXTI_RegDef_t;
+
+static __io HAL_EXTI_RegDef_t *const global_pEXTIReg_t = ((HAL_EXTI_RegDef_t *)(HAL_CM4F_APB2_BASEADDR + HAL_EXTI_OFFSET)); /**< this is a pointer variable through which we will access our EXTI registers to configure them*/
+
+/******************************************************************************
+ * Variables
+ *******************************************************************************/
+
+/******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/*** End of File **************************************************************/
+#endif /*HAL_EXTI_REG_H_*/
@@ -86,6 +86,11 @@
  */
 #include "flash_private.h"
 
+/**
+ * @reason: timestamps the end of initialization in the boot record
+ */
+#include "../CM4F/CM4F_header.h"
+
 /******************************************************************************
  * Module Preprocessor Constants
  *******************************************************************************/
@@ -214,6 +219,8 @@ HAL_FLASH_ErrStates_t HAL_FLASH_Init()
         local_errState_t = HAL_FLASH_ERR_FLASH_BUSY ? HAL_FLASH_OK : local_errState_t;
     }
 
+    HAL_CM4F_BOOT_PROFILE_MARK(HAL_CM4F_BOOT_STAGE_FLASH_INIT, 0);
+
     return local_errState_t;
 }
 
@@ -780,6 +787,17 @@ HAL_FLASH_ErrStates_t HAL_FLASH_Config(const uint8_t argConst_u8Key, const uint8
             // do nothing
         }
     }
+    else if (argConst_u8Key == HAL_FLASH_CONFIG_KEY_WAIT_STATES)
+    {
+        if (argConst_u8Value >= HAL_FLASH_MAX_WAIT_STATE)
+        {
+            local_errState_t = HAL_FLASH_ERR_INVALID_PARAMS;
+        }
+        else
+        {
+            // do nothing
+        }
+    }
     else
     {
         // do nothing
@@ -792,6 +810,14 @@ HAL_FLASH_ErrStates_t HAL_FLASH_Config(const uint8_t argConst_u8Key, const uint8
         {
             global_u8BehaviorType = argConst_u8Value;
         }
+        else if (argConst_u8Key == HAL_FLASH_CONFIG_KEY_WAIT_STATES)
+        {
+            // the new latency is used only after it's read back from FLASH_ACR
+            LIB_MATH_BTT_ASSIGN_BITS(global_pFlashReg_t->FLASH_ACR, HAL_FLASH_ACR_LATENCY, argConst_u8Value, 3);
+            while (((global_pFlashReg_t->FLASH_ACR >> HAL_FLASH_ACR_LATENCY) & 0x7UL) != argConst_u8Value)
+            {
+            };
+        }
     }
 
     return local_errState_t;
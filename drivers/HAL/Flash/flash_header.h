@@ -285,6 +285,7 @@ typedef enum
 typedef enum
 {
     HAL_FLASH_CONFIG_KEY_OPERATION_TYPE = 0, /**< this indicates how the functions of embedded flash shall behave (whether interrupt-based or blocking-based), for connected values, refer to @HAL_FLASH_ConfigValOperationType_t in "flash_header.h"*/
+    HAL_FLASH_CONFIG_KEY_WAIT_STATES,        /**< this indicates the number of wait states used to read flash memory (it has to follow the CPU clock, refer to @HAL_FLASH_TABLE_WAIT_STATES), for connected values, refer to @HAL_FLASH_WaitStates_t in "flash_config.h"*/
     HAL_FLASH_MAX_CONFIG_KEY,                /**< that value should never be used and it's only used by the implementation code for verifying the input*/
 } HAL_FLASH_ConfigKeys_t;
 
@@ -85,6 +85,16 @@
  */
 #include "GPIO_private.h"
 
+/**
+ * @reason: contains the interface used to program DMA2 streams that move the waveforms
+ */
+#include "../DMA/DMA_header.h"
+
+/**
+ * @reason: contains the DMA2 streams channels map
+ */
+#include "../DMA/DMA_config.h"
+
 /******************************************************************************
  * Module Preprocessor Constants
  *******************************************************************************/
@@ -101,6 +111,52 @@
  * Module Variable Definitions
  *******************************************************************************/
 
+/**
+ * @brief: values of configuration registers of every port computed at compile time from the pins configurations in "GPIO_config.h"
+ */
+static const HAL_GPIO_PortImage_t globalConstArr_GPIO_PortsImages_t[HAL_GPIO_MAX_PORT_INDEX] = {
+    [HAL_GPIO_PORTA_INDEX] = HAL_GPIO_PORT_IMAGE(A),
+    [HAL_GPIO_PORTB_INDEX] = HAL_GPIO_PORT_IMAGE(B),
+    [HAL_GPIO_PORTC_INDEX] = HAL_GPIO_PORT_IMAGE(C),
+    [HAL_GPIO_PORTD_INDEX] = HAL_GPIO_PORT_IMAGE(D),
+    [HAL_GPIO_PORTE_INDEX] = HAL_GPIO_PORT_IMAGE(E),
+    [HAL_GPIO_PORTF_INDEX] = HAL_GPIO_PORT_IMAGE(F),
+    [HAL_GPIO_PORTG_INDEX] = HAL_GPIO_PORT_IMAGE(G),
+    [HAL_GPIO_PORTH_INDEX] = HAL_GPIO_PORT_IMAGE(H),
+    [HAL_GPIO_PORTI_INDEX] = HAL_GPIO_PORT_IMAGE(I),
+};
+
+/**
+ * @brief: DMA2 stream and channel serving every waveform trigger (refer to @HAL_GPIO_WaveformTriggers_t in "GPIO_header.h")
+ */
+static const HAL_GPIO_DmaTrigger_t globalConstArr_GPIO_WaveformTriggers_t[HAL_GPIO_MAX_WAVEFORM_TRIG] = {
+    [HAL_GPIO_WAVEFORM_TRIG_TIM1_UP] = {HAL_DMA_STREAM5, HAL_DMA2_STREAM5_CH6_TIM1_UP},
+    [HAL_GPIO_WAVEFORM_TRIG_TIM8_UP] = {HAL_DMA_STREAM1, HAL_DMA2_STREAM1_CH7_TIM8_UP},
+};
+
+/**
+ * @brief: DMA2 stream and channel serving the channel 1 compare request of the timer of every trigger, used to sample keypad columns
+ */
+static const HAL_GPIO_DmaTrigger_t globalConstArr_GPIO_CompareTriggers_t[HAL_GPIO_MAX_WAVEFORM_TRIG] = {
+    [HAL_GPIO_WAVEFORM_TRIG_TIM1_UP] = {HAL_DMA_STREAM3, HAL_DMA2_STREAM3_CH6_TIM1_CH1},
+    [HAL_GPIO_WAVEFORM_TRIG_TIM8_UP] = {HAL_DMA_STREAM2, HAL_DMA2_STREAM2_CH7_TIM8_CH1},
+};
+
+/**
+ * @brief: ownership bitmap of every port, bit n is set if pin n is owned by HAL_GPIO_Init() or claimed by a driver,
+ *         debug pins are owned from reset so they are never switched to analog even before HAL_GPIO_Init() is called
+ */
+static uint16_t globalArr_GPIO_OwnedPins_u16[HAL_GPIO_MAX_PORT_INDEX] = {
+    [HAL_GPIO_PORTA_INDEX] = HAL_GPIO_PORTA_DEBUG_PINS,
+    [HAL_GPIO_PORTB_INDEX] = HAL_GPIO_PORTB_DEBUG_PINS,
+};
+
+/**
+ * @brief: pins claimed by the waveform engine of every trigger and the index of their port, they are released by HAL_GPIO_WaveformStop()
+ */
+static uint16_t globalArr_GPIO_WaveformClaimedPins_u16[HAL_GPIO_MAX_WAVEFORM_TRIG] = {0};
+static uint8_t globalArr_GPIO_WaveformPortIndex_u8[HAL_GPIO_MAX_WAVEFORM_TRIG] = {0};
+
 /******************************************************************************
  * Function Prototypes
  *******************************************************************************/
@@ -114,100 +170,49 @@ HAL_GPIO_ErrStates_t HAL_GPIO_Init()
     // local used variables
     HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
     uint8_t local_u8Iterator1 = 0;
-    uint8_t local_u8Iterator2 = 0;
     uint32_t local_u32TempReg = 0;
-    uint32_t local_u32Temp2Reg = 0;
 
-    // check for errors
-    for (local_u8Iterator1 = 0; local_u8Iterator1 < HAL_GPIO_MAX_PORT_INDEX; local_u8Iterator1++)
+    // check for errors (fields ranges are checked at compile time when the port images are computed)
+    for (local_u8Iterator1 = 0; local_u8Iterator1 < HAL_GPIO_MAX_PORT_INDEX && local_errState == HAL_GPIO_OK; local_u8Iterator1++)
     {
-        for (local_u8Iterator2 = 0; local_u8Iterator2 < HAL_GPIO_MAX_PIN_INDEX; local_u8Iterator2++)
+        if (globalConstArr_GPIO_PortsImages_t[local_u8Iterator1].InvalidPins != 0)
         {
-            if (globalConstArr_GPIO_PinsConfig_t[local_u8Iterator1][local_u8Iterator2].LockEnable >= LIB_CONSTANTS_MAX_LOCK_STATE ||
-                globalConstArr_GPIO_PinsConfig_t[local_u8Iterator1][local_u8Iterator2].Mode >= HAL_GPIO_MAX_PIN_MODE ||
-                (globalConstArr_GPIO_PinsConfig_t[local_u8Iterator1][local_u8Iterator2].PINNumber && (globalConstArr_GPIO_PinsConfig_t[local_u8Iterator1][local_u8Iterator2].PINNumber & (globalConstArr_GPIO_PinsConfig_t[local_u8Iterator1][local_u8Iterator2].PINNumber - 1))) ||
-                (globalConstArr_GPIO_PinsConfig_t[local_u8Iterator1][local_u8Iterator2].GPIOName && (globalConstArr_GPIO_PinsConfig_t[local_u8Iterator1][local_u8Iterator2].GPIOName & (globalConstArr_GPIO_PinsConfig_t[local_u8Iterator1][local_u8Iterator2].GPIOName - 1))) ||
-                globalConstArr_GPIO_PinsConfig_t[local_u8Iterator1][local_u8Iterator2].OutputType >= HAL_GPIO_MAX_OUT_MODE ||
-                globalConstArr_GPIO_PinsConfig_t[local_u8Iterator1][local_u8Iterator2].OutputSpeed >= HAL_GPIO_MAX_OUT_SPEED ||
-                globalConstArr_GPIO_PinsConfig_t[local_u8Iterator1][local_u8Iterator2].PullUpDown >= HAL_GPIO_MAX_PULL_UP_DOWN)
-            {
-                local_errState = HAL_GPIO_ERR_INVALID_CONFIG;
-                goto label;
-            }
+            local_errState = HAL_GPIO_ERR_INVALID_CONFIG;
+        }
+        else
+        {
+            // do nothing
         }
     }
 
-label:
-
     // main function
     if (local_errState == HAL_GPIO_OK)
     {
-
         for (local_u8Iterator1 = 0; local_u8Iterator1 < HAL_GPIO_MAX_PORT_INDEX; local_u8Iterator1++)
         {
-            // Configre MODER
-            local_u32TempReg = global_pGPIOs[local_u8Iterator1]->GPIOx_MODER;
-            for (local_u8Iterator2 = 0; local_u8Iterator2 < HAL_GPIO_MAX_PIN_INDEX; local_u8Iterator2++)
-            {
-                LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, local_u8Iterator2 * 2, globalConstArr_GPIO_PinsConfig_t[local_u8Iterator1][local_u8Iterator2].Mode, 2);
-            }
-            global_pGPIOs[local_u8Iterator1]->GPIOx_MODER = local_u32TempReg;
-
-            // Configre OTYPER
-            local_u32TempReg = global_pGPIOs[local_u8Iterator1]->GPIOx_OTYPER;
-            for (local_u8Iterator2 = 0; local_u8Iterator2 < HAL_GPIO_MAX_PIN_INDEX; local_u8Iterator2++)
-            {
-                LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, local_u8Iterator2, globalConstArr_GPIO_PinsConfig_t[local_u8Iterator1][local_u8Iterator2].OutputType);
-            }
-            global_pGPIOs[local_u8Iterator1]->GPIOx_OTYPER = local_u32TempReg;
-
-            // Configre OSPEEDRR
-            local_u32TempReg = global_pGPIOs[local_u8Iterator1]->GPIOx_OSPEEDR;
-            for (local_u8Iterator2 = 0; local_u8Iterator2 < HAL_GPIO_MAX_PIN_INDEX; local_u8Iterator2++)
-            {
-                LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, local_u8Iterator2 * 2, globalConstArr_GPIO_PinsConfig_t[local_u8Iterator1][local_u8Iterator2].OutputSpeed, 2);
-            }
-            global_pGPIOs[local_u8Iterator1]->GPIOx_OSPEEDR = local_u32TempReg;
+            globalArr_GPIO_OwnedPins_u16[local_u8Iterator1] |= (uint16_t)globalConstArr_GPIO_PortsImages_t[local_u8Iterator1].UsedPins;
 
-            // Configre PUPDR
-            local_u32TempReg = global_pGPIOs[local_u8Iterator1]->GPIOx_PUPDR;
-            for (local_u8Iterator2 = 0; local_u8Iterator2 < HAL_GPIO_MAX_PIN_INDEX; local_u8Iterator2++)
-            {
-                LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, local_u8Iterator2 * 2, globalConstArr_GPIO_PinsConfig_t[local_u8Iterator1][local_u8Iterator2].PullUpDown, 2);
-            }
-            global_pGPIOs[local_u8Iterator1]->GPIOx_PUPDR = local_u32TempReg;
-
-            // Configre LCKR
-            local_u32TempReg = global_pGPIOs[local_u8Iterator1]->GPIOx_LCKR;
-            for (local_u8Iterator2 = 0; local_u8Iterator2 < HAL_GPIO_MAX_PIN_INDEX; local_u8Iterator2++)
-            {
-                LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, local_u8Iterator2, globalConstArr_GPIO_PinsConfig_t[local_u8Iterator1][local_u8Iterator2].LockEnable);
-            }
-            global_pGPIOs[local_u8Iterator1]->GPIOx_LCKR = local_u32TempReg;
-            if (local_u32TempReg != 0)
+            // ports with no used pins are left with their reset configuration
+            if (globalConstArr_GPIO_PortsImages_t[local_u8Iterator1].UsedPins != 0)
             {
-                LIB_MATH_BTT_SET_BIT(global_pGPIOs[local_u8Iterator1]->GPIOx_LCKR, HAL_GPIOx_LCKR_LCKK);
-                LIB_MATH_BTT_CLR_BIT(global_pGPIOs[local_u8Iterator1]->GPIOx_LCKR, HAL_GPIOx_LCKR_LCKK);
-                LIB_MATH_BTT_SET_BIT(global_pGPIOs[local_u8Iterator1]->GPIOx_LCKR, HAL_GPIOx_LCKR_LCKK);
-                local_u32TempReg = global_pGPIOs[local_u8Iterator1]->GPIOx_LCKR;
-            }
+                // one store per register, mode is written last so that the pin switches with its final type, speed, pull and alternate function
+                global_pGPIOs[local_u8Iterator1]->GPIOx_OTYPER = globalConstArr_GPIO_PortsImages_t[local_u8Iterator1].OTYPER;
+                global_pGPIOs[local_u8Iterator1]->GPIOx_OSPEEDR = globalConstArr_GPIO_PortsImages_t[local_u8Iterator1].OSPEEDR;
+                global_pGPIOs[local_u8Iterator1]->GPIOx_PUPDR = globalConstArr_GPIO_PortsImages_t[local_u8Iterator1].PUPDR;
+                global_pGPIOs[local_u8Iterator1]->GPIOx_AFRL = globalConstArr_GPIO_PortsImages_t[local_u8Iterator1].AFRL;
+                global_pGPIOs[local_u8Iterator1]->GPIOx_AFRH = globalConstArr_GPIO_PortsImages_t[local_u8Iterator1].AFRH;
+                global_pGPIOs[local_u8Iterator1]->GPIOx_MODER = globalConstArr_GPIO_PortsImages_t[local_u8Iterator1].MODER;
 
-            // Configre AFRL and AFRL
-            local_u32TempReg = global_pGPIOs[local_u8Iterator1]->GPIOx_AFRL;
-            local_u32Temp2Reg = global_pGPIOs[local_u8Iterator1]->GPIOx_AFRH;
-            for (local_u8Iterator2 = 0; local_u8Iterator2 < HAL_GPIO_MAX_PIN_INDEX; local_u8Iterator2++)
-            {
-                if (local_u8Iterator2 <= 7)
-                {
-                    LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, local_u8Iterator2 * 4, globalConstArr_GPIO_PinsConfig_t[local_u8Iterator1][local_u8Iterator2].AlternateFunction, 4);
-                }
-                else
+                // Configre LCKR using lock key write sequence (LCKK = 1, LCKK = 0, LCKK = 1 then read)
+                local_u32TempReg = globalConstArr_GPIO_PortsImages_t[local_u8Iterator1].LCKR;
+                if (local_u32TempReg != 0)
                 {
-                    LIB_MATH_BTT_ASSIGN_BITS(local_u32Temp2Reg, (local_u8Iterator2 - 8) * 4, globalConstArr_GPIO_PinsConfig_t[local_u8Iterator1][local_u8Iterator2].AlternateFunction, 4);
+                    global_pGPIOs[local_u8Iterator1]->GPIOx_LCKR = local_u32TempReg | (1UL << HAL_GPIOx_LCKR_LCKK);
+                    global_pGPIOs[local_u8Iterator1]->GPIOx_LCKR = local_u32TempReg;
+                    global_pGPIOs[local_u8Iterator1]->GPIOx_LCKR = local_u32TempReg | (1UL << HAL_GPIOx_LCKR_LCKK);
+                    local_u32TempReg = global_pGPIOs[local_u8Iterator1]->GPIOx_LCKR;
                 }
             }
-            global_pGPIOs[local_u8Iterator1]->GPIOx_AFRL = local_u32TempReg;
-            global_pGPIOs[local_u8Iterator1]->GPIOx_AFRH = local_u32Temp2Reg;
         }
     }
     else
@@ -215,6 +220,8 @@ label:
         // do nothing
     }
 
+    HAL_CM4F_BOOT_PROFILE_MARK(HAL_CM4F_BOOT_STAGE_GPIO_INIT, 0);
+
     return local_errState;
 }
 
@@ -226,6 +233,7 @@ HAL_GPIO_ErrStates_t HAL_GPIO_PinStateModify(uint16_t arg_u16GpioName, uint16_t
     // local used variables
     HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
     uint8_t local_u8BitMSBSetPos = 0;
+    uint32_t local_u32ODRSnapshot = 0;
 
     // check for errors
     if (arg_u16GpioName > HAL_GPIO_MAX_PORT || arg_u16GpioName == 0 || arg_u16PinNumber == 0 || argConst_u8Operation >= HAL_GPIO_MAX_PIN_OP)
@@ -252,7 +260,8 @@ HAL_GPIO_ErrStates_t HAL_GPIO_PinStateModify(uint16_t arg_u16GpioName, uint16_t
                 break;
 
             case HAL_GPIO_PIN_OP_TOGGLE:
-                global_pGPIOs[local_u8BitMSBSetPos]->GPIOx_ODR ^= arg_u16PinNumber;
+                local_u32ODRSnapshot = global_pGPIOs[local_u8BitMSBSetPos]->GPIOx_ODR;
+                global_pGPIOs[local_u8BitMSBSetPos]->GPIOx_BSRR = HAL_GPIO_TOGGLE_BSRR_VAL(local_u32ODRSnapshot, arg_u16PinNumber);
                 break;
 
             default:
@@ -283,10 +292,1283 @@ HAL_GPIO_ErrStates_t HAL_GPIO_PinStateRead(uint16_t arg_u16GpioName, uint16_t ar
     if (local_errState == HAL_GPIO_OK)
     {
         local_u8BitMSBSetPos = LIB_MATH_BTT_u8GetMSBSetPos(arg_u16GpioName);
-        *arg_constpu8State = LIB_MATH_BTT_GET_BIT(global_pGPIOs[local_u8BitMSBSetPos]->GPIOx_IDR, local_u8BitMSBSetPos);
+        *arg_constpu8State = ((global_pGPIOs[local_u8BitMSBSetPos]->GPIOx_IDR & arg_u16PinNumber) != 0) ? LIB_CONSTANTS_HIGH : LIB_CONSTANTS_LOW;
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_PortWrite(uint16_t arg_u16GpioName, const uint16_t argConst_u16SetPins, const uint16_t argConst_u16ResetPins)
+{
+    // local used variables
+    HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
+    uint8_t local_u8BitMSBSetPos = 0;
+    uint32_t local_u32BSRRVal = 0;
+
+    // check for errors
+    if (arg_u16GpioName >= HAL_GPIO_MAX_PORT || arg_u16GpioName == 0 || (argConst_u16SetPins | argConst_u16ResetPins) == 0 || (argConst_u16SetPins & argConst_u16ResetPins) != 0)
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState == HAL_GPIO_OK)
+    {
+        // set and reset halves are merged so that all pins change with only one bus write
+        local_u32BSRRVal = ((uint32_t)argConst_u16ResetPins << 16) | argConst_u16SetPins;
+
+        while (arg_u16GpioName != 0)
+        {
+            local_u8BitMSBSetPos = LIB_MATH_BTT_u8GetMSBSetPos(arg_u16GpioName);
+            LIB_MATH_BTT_CLR_BIT(arg_u16GpioName, local_u8BitMSBSetPos);
+
+            global_pGPIOs[local_u8BitMSBSetPos]->GPIOx_BSRR = local_u32BSRRVal;
+        }
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_PortToggle(uint16_t arg_u16GpioName, const uint16_t argConst_u16PinsMask)
+{
+    // local used variables
+    HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
+    uint8_t local_u8BitMSBSetPos = 0;
+    uint32_t local_u32ODRSnapshot = 0;
+
+    // check for errors
+    if (arg_u16GpioName >= HAL_GPIO_MAX_PORT || arg_u16GpioName == 0 || argConst_u16PinsMask == 0)
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState == HAL_GPIO_OK)
+    {
+        while (arg_u16GpioName != 0)
+        {
+            local_u8BitMSBSetPos = LIB_MATH_BTT_u8GetMSBSetPos(arg_u16GpioName);
+            LIB_MATH_BTT_CLR_BIT(arg_u16GpioName, local_u8BitMSBSetPos);
+
+            // one read of ODR followed by one write of BSRR, pins outside the mask are never written back
+            local_u32ODRSnapshot = global_pGPIOs[local_u8BitMSBSetPos]->GPIOx_ODR;
+            global_pGPIOs[local_u8BitMSBSetPos]->GPIOx_BSRR = HAL_GPIO_TOGGLE_BSRR_VAL(local_u32ODRSnapshot, argConst_u16PinsMask);
+        }
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_PortsSnapshot(uint16_t arg_u16GpioNames, const uint16_t *const argConst_pu16PinsMasks, uint16_t *const arg_constpu16Values)
+{
+    // local used variables
+    HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
+    __io HAL_GPIO_RegDef_t *local_pPortsRegs[HAL_GPIO_MAX_PORT_INDEX];
+    uint32_t local_u32PortsIDR[HAL_GPIO_MAX_PORT_INDEX];
+    uint8_t local_u8PortsCount = 0;
+    uint8_t local_u8Iterator = 0;
+
+    // check for errors
+    if (arg_u16GpioNames >= HAL_GPIO_MAX_PORT || arg_u16GpioNames == 0 || argConst_pu16PinsMasks == NULL || arg_constpu16Values == NULL)
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState == HAL_GPIO_OK)
+    {
+        // resolve the ports first so that nothing but loads is done between sampling two ports
+        for (local_u8Iterator = 0; local_u8Iterator < HAL_GPIO_MAX_PORT_INDEX; local_u8Iterator++)
+        {
+            if (LIB_MATH_BTT_GET_BIT(arg_u16GpioNames, local_u8Iterator))
+            {
+                local_pPortsRegs[local_u8PortsCount] = global_pGPIOs[local_u8Iterator];
+                local_u8PortsCount++;
+            }
+        }
+
+        // sample all ports back-to-back
+        for (local_u8Iterator = 0; local_u8Iterator < local_u8PortsCount; local_u8Iterator++)
+        {
+            local_u32PortsIDR[local_u8Iterator] = local_pPortsRegs[local_u8Iterator]->GPIOx_IDR;
+        }
+
+        for (local_u8Iterator = 0; local_u8Iterator < local_u8PortsCount; local_u8Iterator++)
+        {
+            arg_constpu16Values[local_u8Iterator] = (uint16_t)(local_u32PortsIDR[local_u8Iterator] & argConst_pu16PinsMasks[local_u8Iterator]);
+        }
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_BusRead(uint16_t arg_u16GpioName, const uint16_t argConst_u16BusPins, uint16_t *const arg_constpu16Value)
+{
+    // local used variables
+    HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
+    uint8_t local_u8BitMSBSetPos = 0;
+    uint8_t local_u8FirstPinPos = 0;
+
+    // check for errors (one port only and bus pins must be contiguous)
+    if (arg_u16GpioName >= HAL_GPIO_MAX_PORT || arg_u16GpioName == 0 || (arg_u16GpioName & (arg_u16GpioName - 1)) != 0 ||
+        argConst_u16BusPins == 0 || arg_constpu16Value == NULL)
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+    else
+    {
+        local_u8FirstPinPos = (uint8_t)__builtin_ctz(argConst_u16BusPins);
+        if (((((uint32_t)argConst_u16BusPins >> local_u8FirstPinPos) + 1) & ((uint32_t)argConst_u16BusPins >> local_u8FirstPinPos)) != 0)
+        {
+            local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+        }
+    }
+
+    // main function
+    if (local_errState == HAL_GPIO_OK)
+    {
+        local_u8BitMSBSetPos = LIB_MATH_BTT_u8GetMSBSetPos(arg_u16GpioName);
+        *arg_constpu16Value = (uint16_t)((global_pGPIOs[local_u8BitMSBSetPos]->GPIOx_IDR & argConst_u16BusPins) >> local_u8FirstPinPos);
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_WaveformEncode(const uint16_t argConst_u16PinsMask, const uint16_t *const argConst_pu16Samples, const uint16_t argConst_u16SamplesCount, uint32_t *const arg_constpu32BSRRWords)
+{
+    // local used variables
+    HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
+    uint16_t local_u16Iterator = 0;
+
+    // check for errors
+    if (argConst_u16PinsMask == 0 || argConst_pu16Samples == NULL || arg_constpu32BSRRWords == NULL)
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState == HAL_GPIO_OK)
+    {
+        for (local_u16Iterator = 0; local_u16Iterator < argConst_u16SamplesCount; local_u16Iterator++)
+        {
+            arg_constpu32BSRRWords[local_u16Iterator] = ((uint32_t)(argConst_u16PinsMask & (uint16_t)~argConst_pu16Samples[local_u16Iterator]) << 16) |
+                                                        (uint32_t)(argConst_u16PinsMask & argConst_pu16Samples[local_u16Iterator]);
+        }
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_WaveformEncodeBits(const uint16_t argConst_u16PinsMask, const uint8_t *const argConst_pu8Bits, const uint16_t argConst_u16BitsCount, const HAL_GPIO_WaveformSymbols_t *const argConst_pSymbols, uint32_t *const arg_constpu32BSRRWords)
+{
+    // local used variables
+    HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
+    uint16_t local_u16BitIterator = 0;
+    uint8_t local_u8SlotIterator = 0;
+    uint16_t local_u16Symbol = 0;
+    uint32_t local_u32WordIndex = 0;
+
+    // check for errors
+    if (argConst_u16PinsMask == 0 || argConst_pu8Bits == NULL || argConst_pSymbols == NULL || arg_constpu32BSRRWords == NULL ||
+        argConst_pSymbols->SlotsPerBit == 0 || argConst_pSymbols->SlotsPerBit > HAL_GPIO_MAX_WAVEFORM_SLOTS)
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState == HAL_GPIO_OK)
+    {
+        for (local_u16BitIterator = 0; local_u16BitIterator < argConst_u16BitsCount; local_u16BitIterator++)
+        {
+            // bits are sent MSB first inside every byte
+            if (LIB_MATH_BTT_GET_BIT(argConst_pu8Bits[local_u16BitIterator >> 3], 7 - (local_u16BitIterator & 7)))
+            {
+                local_u16Symbol = argConst_pSymbols->Symbol1;
+            }
+            else
+            {
+                local_u16Symbol = argConst_pSymbols->Symbol0;
+            }
+
+            for (local_u8SlotIterator = 0; local_u8SlotIterator < argConst_pSymbols->SlotsPerBit; local_u8SlotIterator++)
+            {
+                if (LIB_MATH_BTT_GET_BIT(local_u16Symbol, local_u8SlotIterator))
+                {
+                    arg_constpu32BSRRWords[local_u32WordIndex] = (uint32_t)argConst_u16PinsMask;
+                }
+                else
+                {
+                    arg_constpu32BSRRWords[local_u32WordIndex] = (uint32_t)argConst_u16PinsMask << 16;
+                }
+                local_u32WordIndex++;
+            }
+        }
+    }
+    else
+    {
+        // do nothing
     }
 
     return local_errState;
 }
 
+/**
+ *
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_WaveformStart(uint16_t arg_u16GpioName, const uint32_t *const argConst_pu32BSRRWords, const uint16_t argConst_u16WordsCount, const uint8_t argConst_u8Trigger, const uint8_t argConst_u8CircularMode)
+{
+    // local used variables
+    HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
+    HAL_DMA_TransferConfig_t local_transfer_t;
+    uint16_t local_u16DrivenPins = 0;
+    uint16_t local_u16Iterator = 0;
+
+    // check for errors (one port only)
+    if (arg_u16GpioName >= HAL_GPIO_MAX_PORT || arg_u16GpioName == 0 || (arg_u16GpioName & (arg_u16GpioName - 1)) != 0 ||
+        argConst_pu32BSRRWords == NULL || argConst_u16WordsCount == 0 || argConst_u8Trigger >= HAL_GPIO_MAX_WAVEFORM_TRIG ||
+        argConst_u8CircularMode >= LIB_CONSTANTS_MAX_DRIVER_STATE)
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+    else
+    {
+        // the pins driven by the waveform are the ones set or reset by any of its words
+        for (local_u16Iterator = 0; local_u16Iterator < argConst_u16WordsCount; local_u16Iterator++)
+        {
+            local_u16DrivenPins |= (uint16_t)(argConst_pu32BSRRWords[local_u16Iterator] | (argConst_pu32BSRRWords[local_u16Iterator] >> 16));
+        }
+
+        // pins left claimed by a waveform that wasn't stopped are given back as the stream is restarted
+        if (globalArr_GPIO_WaveformClaimedPins_u16[argConst_u8Trigger] != 0)
+        {
+            HAL_GPIO_PinsRelease((uint16_t)(1U << globalArr_GPIO_WaveformPortIndex_u8[argConst_u8Trigger]), globalArr_GPIO_WaveformClaimedPins_u16[argConst_u8Trigger]);
+            globalArr_GPIO_WaveformClaimedPins_u16[argConst_u8Trigger] = 0;
+        }
+        else
+        {
+            // do nothing
+        }
+
+        local_errState = HAL_GPIO_PinsAttach(arg_u16GpioName, local_u16DrivenPins, &globalArr_GPIO_WaveformClaimedPins_u16[argConst_u8Trigger]);
+        globalArr_GPIO_WaveformPortIndex_u8[argConst_u8Trigger] = LIB_MATH_BTT_u8GetMSBSetPos(arg_u16GpioName);
+    }
+
+    // main function
+    if (local_errState == HAL_GPIO_OK)
+    {
+        local_transfer_t.PeripheralAddress = (uint32_t)&global_pGPIOs[LIB_MATH_BTT_u8GetMSBSetPos(arg_u16GpioName)]->GPIOx_BSRR;
+        local_transfer_t.MemoryAddress = (uint32_t)argConst_pu32BSRRWords;
+        local_transfer_t.ItemsCount = argConst_u16WordsCount;
+        local_transfer_t.Channel = globalConstArr_GPIO_WaveformTriggers_t[argConst_u8Trigger].Channel;
+        local_transfer_t.Direction = HAL_DMA_DIR_MEM_TO_PERI;
+        local_transfer_t.Priority = HAL_DMA_STREAM_PRIORITY_LVL_VERY_HIGH;
+        local_transfer_t.DataSize = HAL_DMA_DATA_SIZE_WORD;
+        local_transfer_t.MemoryIncrement = LIB_CONSTANTS_ENABLED;
+        local_transfer_t.CircularMode = argConst_u8CircularMode;
+
+        if (HAL_DMA_StreamStart(HAL_DMA_CONTROLLER_2, globalConstArr_GPIO_WaveformTriggers_t[argConst_u8Trigger].Stream, &local_transfer_t) != HAL_DMA_OK)
+        {
+            HAL_GPIO_WaveformStop(argConst_u8Trigger);
+            local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+        }
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_WaveformStop(const uint8_t argConst_u8Trigger)
+{
+    // local used variables
+    HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
+
+    // check for errors
+    if (argConst_u8Trigger >= HAL_GPIO_MAX_WAVEFORM_TRIG)
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState == HAL_GPIO_OK)
+    {
+        HAL_DMA_StreamStop(HAL_DMA_CONTROLLER_2, globalConstArr_GPIO_WaveformTriggers_t[argConst_u8Trigger].Stream);
+
+        if (globalArr_GPIO_WaveformClaimedPins_u16[argConst_u8Trigger] != 0)
+        {
+            HAL_GPIO_PinsRelease((uint16_t)(1U << globalArr_GPIO_WaveformPortIndex_u8[argConst_u8Trigger]), globalArr_GPIO_WaveformClaimedPins_u16[argConst_u8Trigger]);
+            globalArr_GPIO_WaveformClaimedPins_u16[argConst_u8Trigger] = 0;
+        }
+        else
+        {
+            // do nothing
+        }
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_WaveformGetRemaining(const uint8_t argConst_u8Trigger, uint16_t *const arg_constpu16Remaining)
+{
+    // local used variables
+    HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
+
+    // check for errors
+    if (argConst_u8Trigger >= HAL_GPIO_MAX_WAVEFORM_TRIG || arg_constpu16Remaining == NULL)
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState == HAL_GPIO_OK)
+    {
+        HAL_DMA_StreamGetRemaining(HAL_DMA_CONTROLLER_2, globalConstArr_GPIO_WaveformTriggers_t[argConst_u8Trigger].Stream, arg_constpu16Remaining);
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_CaptureStart(uint16_t arg_u16GpioName, HAL_GPIO_Capture_t *const arg_constpCapture)
+{
+    // local used variables
+    HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
+    HAL_DMA_TransferConfig_t local_transfer_t;
+
+    // check for errors (one port only)
+    if (arg_u16GpioName >= HAL_GPIO_MAX_PORT || arg_u16GpioName == 0 || (arg_u16GpioName & (arg_u16GpioName - 1)) != 0 || arg_constpCapture == NULL)
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+    else if (arg_constpCapture->Buffer == NULL || arg_constpCapture->BufferSize == 0 || arg_constpCapture->PostTriggerSamples >= arg_constpCapture->BufferSize ||
+             arg_constpCapture->Trigger >= HAL_GPIO_MAX_WAVEFORM_TRIG)
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+    else
+    {
+        arg_constpCapture->PortIndex = LIB_MATH_BTT_u8GetMSBSetPos(arg_u16GpioName);
+        local_errState = HAL_GPIO_PinsAttach(arg_u16GpioName, arg_constpCapture->PinsMask | arg_constpCapture->PatternMask, &arg_constpCapture->ClaimedPins);
+    }
+
+    // main function
+    if (local_errState == HAL_GPIO_OK)
+    {
+        arg_constpCapture->State = HAL_GPIO_CAPTURE_ARMED;
+        arg_constpCapture->ReadIndex = 0;
+        arg_constpCapture->TriggerIndex = 0;
+        arg_constpCapture->SamplesSinceTrigger = 0;
+        arg_constpCapture->SamplesCount = 0;
+        arg_constpCapture->StopIndex = 0;
+
+        // sample only the low half word of GPIOx_IDR as the high half is reserved
+        local_transfer_t.PeripheralAddress = (uint32_t)&global_pGPIOs[LIB_MATH_BTT_u8GetMSBSetPos(arg_u16GpioName)]->GPIOx_IDR;
+        local_transfer_t.MemoryAddress = (uint32_t)arg_constpCapture->Buffer;
+        local_transfer_t.ItemsCount = arg_constpCapture->BufferSize;
+        local_transfer_t.Channel = globalConstArr_GPIO_WaveformTriggers_t[arg_constpCapture->Trigger].Channel;
+        local_transfer_t.Direction = HAL_DMA_DIR_PERI_TO_MEM;
+        local_transfer_t.Priority = HAL_DMA_STREAM_PRIORITY_LVL_VERY_HIGH;
+        local_transfer_t.DataSize = HAL_DMA_DATA_SIZE_HALF_WORD;
+        local_transfer_t.MemoryIncrement = LIB_CONSTANTS_ENABLED;
+        local_transfer_t.CircularMode = LIB_CONSTANTS_ENABLED;
+
+        if (HAL_DMA_StreamStart(HAL_DMA_CONTROLLER_2, globalConstArr_GPIO_WaveformTriggers_t[arg_constpCapture->Trigger].Stream, &local_transfer_t) != HAL_DMA_OK)
+        {
+            arg_constpCapture->State = HAL_GPIO_CAPTURE_IDLE;
+            HAL_GPIO_CaptureReleasePins(arg_constpCapture);
+            local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+        }
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_CaptureProcess(HAL_GPIO_Capture_t *const arg_constpCapture, uint8_t *const arg_constpu8State)
+{
+    // local used variables
+    HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
+    uint16_t local_u16Remaining = 0;
+    uint16_t local_u16WriteIndex = 0;
+    uint16_t local_u16Sample = 0;
+    uint8_t local_u8Flags = 0;
+    uint32_t local_u32ValidSamples = 0;
+
+    // check for errors
+    if (arg_constpCapture == NULL || arg_constpu8State == NULL || arg_constpCapture->State >= HAL_GPIO_MAX_CAPTURE_STATE)
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState == HAL_GPIO_OK && (arg_constpCapture->State == HAL_GPIO_CAPTURE_ARMED || arg_constpCapture->State == HAL_GPIO_CAPTURE_TRIGGERED))
+    {
+        // the stream writes at index (BufferSize - DMA_SxNDTR), NDTR is reloaded with BufferSize on every wrap
+        HAL_DMA_StreamGetRemaining(HAL_DMA_CONTROLLER_2, globalConstArr_GPIO_WaveformTriggers_t[arg_constpCapture->Trigger].Stream, &local_u16Remaining);
+        local_u16WriteIndex = (uint16_t)((arg_constpCapture->BufferSize - local_u16Remaining) % arg_constpCapture->BufferSize);
+
+        // flags are read after the index so a boundary crossed in between is seen now and is never counted twice,
+        // with at most half a buffer between calls only one of the two boundaries can be crossed so both flags mean that the writer lapped the search
+        HAL_DMA_StreamReadFlags(HAL_DMA_CONTROLLER_2, globalConstArr_GPIO_WaveformTriggers_t[arg_constpCapture->Trigger].Stream, &local_u8Flags);
+        if ((local_u8Flags & HAL_DMA_FLAG_HALF_TRANSFER) && (local_u8Flags & HAL_DMA_FLAG_TRANSFER_COMPLETE))
+        {
+            HAL_DMA_StreamStop(HAL_DMA_CONTROLLER_2, globalConstArr_GPIO_WaveformTriggers_t[arg_constpCapture->Trigger].Stream);
+            arg_constpCapture->State = HAL_GPIO_CAPTURE_IDLE;
+            local_errState = HAL_GPIO_ERR_CAPTURE_OVERRUN;
+        }
+        else
+        {
+            // do nothing
+        }
+
+        while (local_errState == HAL_GPIO_OK && arg_constpCapture->ReadIndex != local_u16WriteIndex && arg_constpCapture->State != HAL_GPIO_CAPTURE_DONE)
+        {
+            local_u16Sample = arg_constpCapture->Buffer[arg_constpCapture->ReadIndex];
+
+            if (arg_constpCapture->State == HAL_GPIO_CAPTURE_TRIGGERED)
+            {
+                arg_constpCapture->SamplesSinceTrigger++;
+            }
+            else if (arg_constpCapture->SamplesCount >= (arg_constpCapture->BufferSize - arg_constpCapture->PostTriggerSamples) &&
+                     (local_u16Sample & arg_constpCapture->PatternMask) == (arg_constpCapture->PatternValue & arg_constpCapture->PatternMask))
+            {
+                arg_constpCapture->State = HAL_GPIO_CAPTURE_TRIGGERED;
+                arg_constpCapture->TriggerIndex = arg_constpCapture->ReadIndex;
+            }
+            else
+            {
+                // do nothing
+            }
+
+            if (arg_constpCapture->SamplesCount < arg_constpCapture->BufferSize)
+            {
+                arg_constpCapture->SamplesCount++;
+            }
+            arg_constpCapture->ReadIndex = (uint16_t)((arg_constpCapture->ReadIndex + 1) % arg_constpCapture->BufferSize);
+
+            if (arg_constpCapture->State == HAL_GPIO_CAPTURE_TRIGGERED && arg_constpCapture->SamplesSinceTrigger >= arg_constpCapture->PostTriggerSamples)
+            {
+                HAL_DMA_StreamStop(HAL_DMA_CONTROLLER_2, globalConstArr_GPIO_WaveformTriggers_t[arg_constpCapture->Trigger].Stream);
+                HAL_DMA_StreamGetRemaining(HAL_DMA_CONTROLLER_2, globalConstArr_GPIO_WaveformTriggers_t[arg_constpCapture->Trigger].Stream, &local_u16Remaining);
+                arg_constpCapture->StopIndex = (uint16_t)((arg_constpCapture->BufferSize - local_u16Remaining) % arg_constpCapture->BufferSize);
+                HAL_DMA_StreamReadFlags(HAL_DMA_CONTROLLER_2, globalConstArr_GPIO_WaveformTriggers_t[arg_constpCapture->Trigger].Stream, &local_u8Flags);
+
+                // samples recorded after the last searched one overwrite the oldest ones, the record is lost if they reached the trigger sample
+                local_u32ValidSamples = (uint32_t)arg_constpCapture->SamplesSinceTrigger +
+                                        (((uint32_t)arg_constpCapture->StopIndex + arg_constpCapture->BufferSize - arg_constpCapture->ReadIndex) % arg_constpCapture->BufferSize);
+                if (local_u32ValidSamples >= arg_constpCapture->BufferSize ||
+                    ((local_u8Flags & HAL_DMA_FLAG_HALF_TRANSFER) && (local_u8Flags & HAL_DMA_FLAG_TRANSFER_COMPLETE)))
+                {
+                    arg_constpCapture->State = HAL_GPIO_CAPTURE_IDLE;
+                    local_errState = HAL_GPIO_ERR_CAPTURE_OVERRUN;
+                }
+                else
+                {
+                    local_u32ValidSamples = (uint32_t)arg_constpCapture->SamplesCount +
+                                            (((uint32_t)arg_constpCapture->StopIndex + arg_constpCapture->BufferSize - arg_constpCapture->ReadIndex) % arg_constpCapture->BufferSize);
+                    if (local_u32ValidSamples > arg_constpCapture->BufferSize)
+                    {
+                        local_u32ValidSamples = arg_constpCapture->BufferSize;
+                    }
+                    arg_constpCapture->SamplesCount = (uint16_t)local_u32ValidSamples;
+                    arg_constpCapture->State = HAL_GPIO_CAPTURE_DONE;
+                }
+            }
+        }
+    }
+    else
+    {
+        // do nothing
+    }
+
+    if (local_errState == HAL_GPIO_OK || local_errState == HAL_GPIO_ERR_CAPTURE_OVERRUN)
+    {
+        *arg_constpu8State = arg_constpCapture->State;
+    }
+
+    // the stream is stopped in both done and overrun cases so the sampled pins are given back
+    if (local_errState == HAL_GPIO_ERR_CAPTURE_OVERRUN || (local_errState == HAL_GPIO_OK && arg_constpCapture->State == HAL_GPIO_CAPTURE_DONE))
+    {
+        HAL_GPIO_CaptureReleasePins(arg_constpCapture);
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_CaptureUnroll(const HAL_GPIO_Capture_t *const argConst_pCapture, uint16_t *const arg_constpu16Samples, uint16_t *const arg_constpu16SamplesCount, uint16_t *const arg_constpu16TriggerPos)
+{
+    // local used variables
+    HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
+    uint16_t local_u16OldestIndex = 0;
+    uint16_t local_u16Iterator = 0;
+
+    // check for errors
+    if (argConst_pCapture == NULL || arg_constpu16Samples == NULL || arg_constpu16SamplesCount == NULL || arg_constpu16TriggerPos == NULL ||
+        argConst_pCapture->State != HAL_GPIO_CAPTURE_DONE || arg_constpu16Samples == argConst_pCapture->Buffer)
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState == HAL_GPIO_OK)
+    {
+        local_u16OldestIndex = (uint16_t)((argConst_pCapture->StopIndex + argConst_pCapture->BufferSize - argConst_pCapture->SamplesCount) % argConst_pCapture->BufferSize);
+
+        for (local_u16Iterator = 0; local_u16Iterator < argConst_pCapture->SamplesCount; local_u16Iterator++)
+        {
+            arg_constpu16Samples[local_u16Iterator] = argConst_pCapture->Buffer[(local_u16OldestIndex + local_u16Iterator) % argConst_pCapture->BufferSize];
+        }
+
+        *arg_constpu16SamplesCount = argConst_pCapture->SamplesCount;
+        *arg_constpu16TriggerPos = (uint16_t)((argConst_pCapture->TriggerIndex + argConst_pCapture->BufferSize - local_u16OldestIndex) % argConst_pCapture->BufferSize);
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_DebounceInit(uint16_t arg_u16GpioName, const uint16_t argConst_u16PinsMask, const uint16_t argConst_u16ActiveLowPins, HAL_GPIO_Debouncer_t *const arg_constpDebouncer)
+{
+    // local used variables
+    HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
+
+    // check for errors (one port only)
+    if (arg_u16GpioName >= HAL_GPIO_MAX_PORT || arg_u16GpioName == 0 || (arg_u16GpioName & (arg_u16GpioName - 1)) != 0 ||
+        argConst_u16PinsMask == 0 || arg_constpDebouncer == NULL)
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState == HAL_GPIO_OK)
+    {
+        arg_constpDebouncer->PortIndex = LIB_MATH_BTT_u8GetMSBSetPos(arg_u16GpioName);
+        arg_constpDebouncer->PinsMask = argConst_u16PinsMask;
+        arg_constpDebouncer->ActiveLowPins = argConst_u16ActiveLowPins & argConst_u16PinsMask;
+        arg_constpDebouncer->State = (uint16_t)((global_pGPIOs[arg_constpDebouncer->PortIndex]->GPIOx_IDR ^ arg_constpDebouncer->ActiveLowPins) & argConst_u16PinsMask);
+
+        // counters start at 3 and count down so a pin flips on the 4th differing sample
+        arg_constpDebouncer->CounterBit0 = 0xFFFF;
+        arg_constpDebouncer->CounterBit1 = 0xFFFF;
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_DebounceTick(HAL_GPIO_Debouncer_t *const arg_constpDebouncer, uint16_t *const arg_constpu16Pressed, uint16_t *const arg_constpu16Released)
+{
+    // local used variables
+    HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
+    uint16_t local_u16Changed = 0;
+
+    // check for errors
+    if (arg_constpDebouncer == NULL || arg_constpu16Pressed == NULL || arg_constpu16Released == NULL || arg_constpDebouncer->PortIndex >= HAL_GPIO_MAX_PORT_INDEX)
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState == HAL_GPIO_OK)
+    {
+        // pins whose sample differs from the debounced state
+        local_u16Changed = (uint16_t)(((global_pGPIOs[arg_constpDebouncer->PortIndex]->GPIOx_IDR ^ arg_constpDebouncer->ActiveLowPins) ^ arg_constpDebouncer->State) & arg_constpDebouncer->PinsMask);
+
+        // decrement the counters of the changed pins and reload the counters of the others to 3
+        arg_constpDebouncer->CounterBit0 = (uint16_t)~(arg_constpDebouncer->CounterBit0 & local_u16Changed);
+        arg_constpDebouncer->CounterBit1 = (uint16_t)(arg_constpDebouncer->CounterBit0 ^ (arg_constpDebouncer->CounterBit1 & local_u16Changed));
+
+        // pins whose counters rolled over are the ones that changed for 4 samples in a row
+        local_u16Changed &= arg_constpDebouncer->CounterBit0 & arg_constpDebouncer->CounterBit1;
+        arg_constpDebouncer->State ^= local_u16Changed;
+
+        *arg_constpu16Pressed = local_u16Changed & arg_constpDebouncer->State;
+        *arg_constpu16Released = local_u16Changed & (uint16_t)~arg_constpDebouncer->State;
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_PortReconfigure(uint16_t arg_u16GpioName, const HAL_GPIO_PinChange_t *const argConst_pChanges, const uint8_t argConst_u8ChangesCount)
+{
+    // local used variables
+    HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
+    __io HAL_GPIO_RegDef_t *local_pPortReg = NULL;
+    uint16_t local_u16ChangedPins = 0;
+    uint16_t local_u16LockedPins = 0;
+    uint32_t local_u32ModerInMask = 0, local_u32ModerInVal = 0;
+    uint32_t local_u32ModerOutMask = 0, local_u32ModerOutVal = 0;
+    uint32_t local_u32OtyperMask = 0, local_u32OtyperVal = 0;
+    uint32_t local_u32OspeedrMask = 0, local_u32OspeedrVal = 0;
+    uint32_t local_u32PupdrMask = 0, local_u32PupdrVal = 0;
+    uint32_t local_u32AfrlMask = 0, local_u32AfrlVal = 0;
+    uint32_t local_u32AfrhMask = 0, local_u32AfrhVal = 0;
+    uint32_t local_u32Primask = 0;
+    uint8_t local_u8ChangeIterator = 0;
+    uint8_t local_u8PinIterator = 0;
+    const HAL_GPIO_PinChange_t *local_pChange = NULL;
+
+    // check for errors (one port only)
+    if (arg_u16GpioName >= HAL_GPIO_MAX_PORT || arg_u16GpioName == 0 || (arg_u16GpioName & (arg_u16GpioName - 1)) != 0 ||
+        argConst_pChanges == NULL || argConst_u8ChangesCount == 0)
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+
+    // merge the whole batch into (mask, value) pairs of every register
+    for (local_u8ChangeIterator = 0; local_errState == HAL_GPIO_OK && local_u8ChangeIterator < argConst_u8ChangesCount; local_u8ChangeIterator++)
+    {
+        local_pChange = &argConst_pChanges[local_u8ChangeIterator];
+        if (local_pChange->Pins == 0 || local_pChange->Mode >= HAL_GPIO_MAX_PIN_MODE || local_pChange->OutputType >= HAL_GPIO_MAX_OUT_MODE ||
+            local_pChange->OutputSpeed >= HAL_GPIO_MAX_OUT_SPEED || local_pChange->PullUpDown >= HAL_GPIO_MAX_PULL_UP_DOWN ||
+            local_pChange->AlternateFunction >= HAL_GPIO_MAX_ALTERNATE_FUNC)
+        {
+            local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+            continue;
+        }
+
+        local_u16ChangedPins |= local_pChange->Pins;
+        for (local_u8PinIterator = 0; local_u8PinIterator < HAL_GPIO_MAX_PIN_INDEX; local_u8PinIterator++)
+        {
+            if (LIB_MATH_BTT_GET_BIT(local_pChange->Pins, local_u8PinIterator))
+            {
+                if (local_pChange->Mode == HAL_GPIO_PIN_MODE_INPUT || local_pChange->Mode == HAL_GPIO_PIN_MODE_ANALOG)
+                {
+                    local_u32ModerInMask |= 3UL << (local_u8PinIterator * 2);
+                    local_u32ModerInVal |= (uint32_t)local_pChange->Mode << (local_u8PinIterator * 2);
+                }
+                else
+                {
+                    local_u32ModerOutMask |= 3UL << (local_u8PinIterator * 2);
+                    local_u32ModerOutVal |= (uint32_t)local_pChange->Mode << (local_u8PinIterator * 2);
+                }
+
+                local_u32OtyperMask |= 1UL << local_u8PinIterator;
+                local_u32OtyperVal |= (uint32_t)local_pChange->OutputType << local_u8PinIterator;
+                local_u32OspeedrMask |= 3UL << (local_u8PinIterator * 2);
+                local_u32OspeedrVal |= (uint32_t)local_pChange->OutputSpeed << (local_u8PinIterator * 2);
+                local_u32PupdrMask |= 3UL << (local_u8PinIterator * 2);
+                local_u32PupdrVal |= (uint32_t)local_pChange->PullUpDown << (local_u8PinIterator * 2);
+
+                if (local_u8PinIterator < 8)
+                {
+                    local_u32AfrlMask |= 0xFUL << (local_u8PinIterator * 4);
+                    local_u32AfrlVal |= (uint32_t)local_pChange->AlternateFunction << (local_u8PinIterator * 4);
+                }
+                else
+                {
+                    local_u32AfrhMask |= 0xFUL << ((local_u8PinIterator - 8) * 4);
+                    local_u32AfrhVal |= (uint32_t)local_pChange->AlternateFunction << ((local_u8PinIterator - 8) * 4);
+                }
+            }
+        }
+    }
+
+    // only the owner of the pins reconfigures them (HAL_GPIO_Init() configuration or a driver that claimed them)
+    if (local_errState == HAL_GPIO_OK && (local_u16ChangedPins & (uint16_t)~globalArr_GPIO_OwnedPins_u16[LIB_MATH_BTT_u8GetMSBSetPos(arg_u16GpioName)]) != 0)
+    {
+        local_errState = HAL_GPIO_ERR_PINS_NOT_OWNED;
+    }
+    else
+    {
+        // do nothing
+    }
+
+    // main function
+    if (local_errState == HAL_GPIO_OK)
+    {
+        local_pPortReg = global_pGPIOs[LIB_MATH_BTT_u8GetMSBSetPos(arg_u16GpioName)];
+
+        HAL_CM4F_ENTER_CRITICAL(local_u32Primask);
+
+        // lock bits are only effective after the lock key sequence sets LCKK
+        if (LIB_MATH_BTT_GET_BIT(local_pPortReg->GPIOx_LCKR, HAL_GPIOx_LCKR_LCKK))
+        {
+            local_u16LockedPins = (uint16_t)local_pPortReg->GPIOx_LCKR;
+        }
+
+        if ((local_u16ChangedPins & local_u16LockedPins) != 0)
+        {
+            local_errState = HAL_GPIO_ERR_PIN_LOCKED;
+        }
+        else
+        {
+            if (local_u32ModerInMask != 0)
+            {
+                local_pPortReg->GPIOx_MODER = (local_pPortReg->GPIOx_MODER & ~local_u32ModerInMask) | local_u32ModerInVal;
+            }
+            local_pPortReg->GPIOx_OTYPER = (local_pPortReg->GPIOx_OTYPER & ~local_u32OtyperMask) | local_u32OtyperVal;
+            local_pPortReg->GPIOx_OSPEEDR = (local_pPortReg->GPIOx_OSPEEDR & ~local_u32OspeedrMask) | local_u32OspeedrVal;
+            local_pPortReg->GPIOx_PUPDR = (local_pPortReg->GPIOx_PUPDR & ~local_u32PupdrMask) | local_u32PupdrVal;
+            if (local_u32AfrlMask != 0)
+            {
+                local_pPortReg->GPIOx_AFRL = (local_pPortReg->GPIOx_AFRL & ~local_u32AfrlMask) | local_u32AfrlVal;
+            }
+            if (local_u32AfrhMask != 0)
+            {
+                local_pPortReg->GPIOx_AFRH = (local_pPortReg->GPIOx_AFRH & ~local_u32AfrhMask) | local_u32AfrhVal;
+            }
+            if (local_u32ModerOutMask != 0)
+            {
+                local_pPortReg->GPIOx_MODER = (local_pPortReg->GPIOx_MODER & ~local_u32ModerOutMask) | local_u32ModerOutVal;
+            }
+        }
+
+        HAL_CM4F_EXIT_CRITICAL(local_u32Primask);
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_KeypadStart(HAL_GPIO_Keypad_t *const arg_constpKeypad)
+{
+    // local used variables
+    HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
+    HAL_DMA_TransferConfig_t local_transfer_t;
+    uint16_t local_u16RowPin = 0;
+    uint16_t local_u16RemainingRows = 0;
+    uint8_t local_u8Row = 0;
+
+    // check for errors (one port for rows and one port for columns)
+    if (arg_constpKeypad == NULL)
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+    else if (arg_constpKeypad->RowsPort >= HAL_GPIO_MAX_PORT || arg_constpKeypad->RowsPort == 0 || (arg_constpKeypad->RowsPort & (arg_constpKeypad->RowsPort - 1)) != 0 ||
+             arg_constpKeypad->ColumnsPort >= HAL_GPIO_MAX_PORT || arg_constpKeypad->ColumnsPort == 0 || (arg_constpKeypad->ColumnsPort & (arg_constpKeypad->ColumnsPort - 1)) != 0 ||
+             arg_constpKeypad->RowsPins == 0 || arg_constpKeypad->ColumnsPins == 0 || arg_constpKeypad->Trigger >= HAL_GPIO_MAX_WAVEFORM_TRIG ||
+             (arg_constpKeypad->RowsPort == arg_constpKeypad->ColumnsPort && (arg_constpKeypad->RowsPins & arg_constpKeypad->ColumnsPins) != 0))
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+    else
+    {
+        // count the rows
+        arg_constpKeypad->RowsCount = 0;
+        for (local_u16RemainingRows = arg_constpKeypad->RowsPins; local_u16RemainingRows != 0; local_u16RemainingRows &= local_u16RemainingRows - 1)
+        {
+            arg_constpKeypad->RowsCount++;
+        }
+
+        if (arg_constpKeypad->RowsCount > HAL_GPIO_KEYPAD_MAX_ROWS)
+        {
+            local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+        }
+        else
+        {
+            arg_constpKeypad->ColumnsClaimedPins = 0;
+            local_errState = HAL_GPIO_PinsAttach(arg_constpKeypad->RowsPort, arg_constpKeypad->RowsPins, &arg_constpKeypad->RowsClaimedPins);
+        }
+
+        if (local_errState == HAL_GPIO_OK)
+        {
+            local_errState = HAL_GPIO_PinsAttach(arg_constpKeypad->ColumnsPort, arg_constpKeypad->ColumnsPins, &arg_constpKeypad->ColumnsClaimedPins);
+        }
+        else
+        {
+            // do nothing
+        }
+
+        if (local_errState != HAL_GPIO_OK)
+        {
+            HAL_GPIO_KeypadReleasePins(arg_constpKeypad);
+        }
+        else
+        {
+            // do nothing
+        }
+    }
+
+    // main function
+    if (local_errState == HAL_GPIO_OK)
+    {
+        // row n is driven low while the other rows are released, in up counting the channel 1 compare of a period comes before its update event
+        // so the update at the end of period n selects row (n + 1) and its strobe is kept at index n
+        local_u16RemainingRows = arg_constpKeypad->RowsPins;
+        for (local_u8Row = 0; local_u8Row < arg_constpKeypad->RowsCount; local_u8Row++)
+        {
+            local_u16RowPin = local_u16RemainingRows & (uint16_t)(~local_u16RemainingRows + 1);
+            local_u16RemainingRows &= (uint16_t)~local_u16RowPin;
+
+            arg_constpKeypad->RowsStrobes[(local_u8Row + arg_constpKeypad->RowsCount - 1) % arg_constpKeypad->RowsCount] =
+                ((uint32_t)local_u16RowPin << 16) | (uint32_t)(arg_constpKeypad->RowsPins & (uint16_t)~local_u16RowPin);
+            arg_constpKeypad->ColumnsSamples[local_u8Row] = arg_constpKeypad->ColumnsPins;
+            arg_constpKeypad->KeysState[local_u8Row] = 0;
+        }
+
+        // row 0 is selected by the CPU so it's already driven when the first compare of period 0 samples the columns into index 0
+        global_pGPIOs[LIB_MATH_BTT_u8GetMSBSetPos(arg_constpKeypad->RowsPort)]->GPIOx_BSRR = arg_constpKeypad->RowsStrobes[arg_constpKeypad->RowsCount - 1];
+
+        local_transfer_t.PeripheralAddress = (uint32_t)&global_pGPIOs[LIB_MATH_BTT_u8GetMSBSetPos(arg_constpKeypad->ColumnsPort)]->GPIOx_IDR;
+        local_transfer_t.MemoryAddress = (uint32_t)arg_constpKeypad->ColumnsSamples;
+        local_transfer_t.ItemsCount = arg_constpKeypad->RowsCount;
+        local_transfer_t.Channel = globalConstArr_GPIO_CompareTriggers_t[arg_constpKeypad->Trigger].Channel;
+        local_transfer_t.Direction = HAL_DMA_DIR_PERI_TO_MEM;
+        local_transfer_t.Priority = HAL_DMA_STREAM_PRIORITY_LVL_HIGH;
+        local_transfer_t.DataSize = HAL_DMA_DATA_SIZE_HALF_WORD;
+        local_transfer_t.MemoryIncrement = LIB_CONSTANTS_ENABLED;
+        local_transfer_t.CircularMode = LIB_CONSTANTS_ENABLED;
+        if (HAL_DMA_StreamStart(HAL_DMA_CONTROLLER_2, globalConstArr_GPIO_CompareTriggers_t[arg_constpKeypad->Trigger].Stream, &local_transfer_t) != HAL_DMA_OK)
+        {
+            HAL_GPIO_KeypadReleasePins(arg_constpKeypad);
+            local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+        }
+
+        if (local_errState == HAL_GPIO_OK)
+        {
+            local_transfer_t.PeripheralAddress = (uint32_t)&global_pGPIOs[LIB_MATH_BTT_u8GetMSBSetPos(arg_constpKeypad->RowsPort)]->GPIOx_BSRR;
+            local_transfer_t.MemoryAddress = (uint32_t)arg_constpKeypad->RowsStrobes;
+            local_transfer_t.Channel = globalConstArr_GPIO_WaveformTriggers_t[arg_constpKeypad->Trigger].Channel;
+            local_transfer_t.Direction = HAL_DMA_DIR_MEM_TO_PERI;
+            local_transfer_t.DataSize = HAL_DMA_DATA_SIZE_WORD;
+            if (HAL_DMA_StreamStart(HAL_DMA_CONTROLLER_2, globalConstArr_GPIO_WaveformTriggers_t[arg_constpKeypad->Trigger].Stream, &local_transfer_t) != HAL_DMA_OK)
+            {
+                HAL_DMA_StreamStop(HAL_DMA_CONTROLLER_2, globalConstArr_GPIO_CompareTriggers_t[arg_constpKeypad->Trigger].Stream);
+                HAL_GPIO_KeypadReleasePins(arg_constpKeypad);
+                local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+            }
+        }
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_KeypadStop(HAL_GPIO_Keypad_t *const arg_constpKeypad)
+{
+    // local used variables
+    HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
+
+    // check for errors
+    if (arg_constpKeypad == NULL || arg_constpKeypad->Trigger >= HAL_GPIO_MAX_WAVEFORM_TRIG ||
+        arg_constpKeypad->RowsPort >= HAL_GPIO_MAX_PORT || arg_constpKeypad->RowsPort == 0 || (arg_constpKeypad->RowsPort & (arg_constpKeypad->RowsPort - 1)) != 0 ||
+        arg_constpKeypad->ColumnsPort >= HAL_GPIO_MAX_PORT || arg_constpKeypad->ColumnsPort == 0 || (arg_constpKeypad->ColumnsPort & (arg_constpKeypad->ColumnsPort - 1)) != 0)
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState == HAL_GPIO_OK)
+    {
+        HAL_DMA_StreamStop(HAL_DMA_CONTROLLER_2, globalConstArr_GPIO_WaveformTriggers_t[arg_constpKeypad->Trigger].Stream);
+        HAL_DMA_StreamStop(HAL_DMA_CONTROLLER_2, globalConstArr_GPIO_CompareTriggers_t[arg_constpKeypad->Trigger].Stream);
+        HAL_GPIO_KeypadReleasePins(arg_constpKeypad);
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_KeypadProcess(HAL_GPIO_Keypad_t *const arg_constpKeypad, HAL_GPIO_KeyEvent_t *const arg_constpEvents, const uint8_t argConst_u8MaxEvents, uint8_t *const arg_constpu8EventsCount)
+{
+    // local used variables
+    HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
+    uint16_t local_u16Pressed = 0;
+    uint16_t local_u16Changed = 0;
+    uint8_t local_u8Row = 0;
+    uint8_t local_u8Column = 0;
+    uint8_t local_u8EventsCount = 0;
+
+    // check for errors
+    if (arg_constpKeypad == NULL || arg_constpEvents == NULL || arg_constpu8EventsCount == NULL || arg_constpKeypad->RowsCount > HAL_GPIO_KEYPAD_MAX_ROWS)
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState == HAL_GPIO_OK)
+    {
+        for (local_u8Row = 0; local_u8Row < arg_constpKeypad->RowsCount && local_u8EventsCount < argConst_u8MaxEvents; local_u8Row++)
+        {
+            // a pressed key pulls its column low while its row is selected
+            local_u16Pressed = (uint16_t)~arg_constpKeypad->ColumnsSamples[local_u8Row] & arg_constpKeypad->ColumnsPins;
+            local_u16Changed = local_u16Pressed ^ arg_constpKeypad->KeysState[local_u8Row];
+
+            while (local_u16Changed != 0 && local_u8EventsCount < argConst_u8MaxEvents)
+            {
+                local_u8Column = (uint8_t)__builtin_ctz(local_u16Changed);
+                local_u16Changed &= local_u16Changed - 1;
+
+                arg_constpEvents[local_u8EventsCount].Key = (uint8_t)((local_u8Row << 4) | local_u8Column);
+                arg_constpEvents[local_u8EventsCount].State = LIB_MATH_BTT_GET_BIT(local_u16Pressed, local_u8Column) ? LIB_CONSTANTS_HIGH : LIB_CONSTANTS_LOW;
+                local_u8EventsCount++;
+
+                LIB_MATH_BTT_ASSIGN_BIT(arg_constpKeypad->KeysState[local_u8Row], local_u8Column, LIB_MATH_BTT_GET_BIT(local_u16Pressed, local_u8Column));
+            }
+        }
+
+        *arg_constpu8EventsCount = local_u8EventsCount;
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_PinsClaim(uint16_t arg_u16GpioName, const uint16_t argConst_u16PinsMask)
+{
+    // local used variables
+    HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
+    uint32_t local_u32Primask = 0;
+    uint8_t local_u8PortIndex = 0;
+
+    // check for errors (one port only)
+    if (arg_u16GpioName >= HAL_GPIO_MAX_PORT || arg_u16GpioName == 0 || (arg_u16GpioName & (arg_u16GpioName - 1)) != 0 || argConst_u16PinsMask == 0)
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState == HAL_GPIO_OK)
+    {
+        local_u8PortIndex = LIB_MATH_BTT_u8GetMSBSetPos(arg_u16GpioName);
+
+        // test and set must not be split by a claim from an interrupt
+        HAL_CM4F_ENTER_CRITICAL(local_u32Primask);
+        if ((globalArr_GPIO_OwnedPins_u16[local_u8PortIndex] & argConst_u16PinsMask) != 0)
+        {
+            local_errState = HAL_GPIO_ERR_PINS_CLAIMED;
+        }
+        else
+        {
+            globalArr_GPIO_OwnedPins_u16[local_u8PortIndex] |= argConst_u16PinsMask;
+        }
+        HAL_CM4F_EXIT_CRITICAL(local_u32Primask);
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_PinsAttach(uint16_t arg_u16GpioName, const uint16_t argConst_u16PinsMask, uint16_t *const arg_constpu16ClaimedPins)
+{
+    // local used variables
+    HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
+    uint32_t local_u32Primask = 0;
+    uint16_t local_u16ConfiguredPins = 0;
+    uint8_t local_u8PortIndex = 0;
+
+    // check for errors (one port only)
+    if (arg_u16GpioName >= HAL_GPIO_MAX_PORT || arg_u16GpioName == 0 || (arg_u16GpioName & (arg_u16GpioName - 1)) != 0 || arg_constpu16ClaimedPins == NULL)
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState == HAL_GPIO_OK)
+    {
+        local_u8PortIndex = LIB_MATH_BTT_u8GetMSBSetPos(arg_u16GpioName);
+        local_u16ConfiguredPins = (uint16_t)globalConstArr_GPIO_PortsImages_t[local_u8PortIndex].UsedPins;
+
+        // pins configured in "GPIO_config.h" are used as they are, the free ones are claimed and the ones claimed by another driver are refused
+        HAL_CM4F_ENTER_CRITICAL(local_u32Primask);
+        if ((argConst_u16PinsMask & globalArr_GPIO_OwnedPins_u16[local_u8PortIndex] & (uint16_t)~local_u16ConfiguredPins) != 0)
+        {
+            *arg_constpu16ClaimedPins = 0;
+            local_errState = HAL_GPIO_ERR_PINS_CLAIMED;
+        }
+        else
+        {
+            *arg_constpu16ClaimedPins = argConst_u16PinsMask & (uint16_t)~(globalArr_GPIO_OwnedPins_u16[local_u8PortIndex] | local_u16ConfiguredPins);
+            globalArr_GPIO_OwnedPins_u16[local_u8PortIndex] |= *arg_constpu16ClaimedPins;
+        }
+        HAL_CM4F_EXIT_CRITICAL(local_u32Primask);
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_PinsRelease(uint16_t arg_u16GpioName, const uint16_t argConst_u16PinsMask)
+{
+    // local used variables
+    HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
+    uint32_t local_u32Primask = 0;
+    uint8_t local_u8PortIndex = 0;
+
+    // check for errors (one port only)
+    if (arg_u16GpioName >= HAL_GPIO_MAX_PORT || arg_u16GpioName == 0 || (arg_u16GpioName & (arg_u16GpioName - 1)) != 0 || argConst_u16PinsMask == 0)
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState == HAL_GPIO_OK)
+    {
+        local_u8PortIndex = LIB_MATH_BTT_u8GetMSBSetPos(arg_u16GpioName);
+
+        HAL_CM4F_ENTER_CRITICAL(local_u32Primask);
+        if ((globalArr_GPIO_OwnedPins_u16[local_u8PortIndex] & argConst_u16PinsMask) != argConst_u16PinsMask)
+        {
+            local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+        }
+        else
+        {
+            globalArr_GPIO_OwnedPins_u16[local_u8PortIndex] &= (uint16_t)~argConst_u16PinsMask;
+        }
+        HAL_CM4F_EXIT_CRITICAL(local_u32Primask);
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_GetUnusedPins(uint16_t arg_u16GpioName, uint16_t *const arg_constpu16UnusedPins)
+{
+    // local used variables
+    HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
+
+    // check for errors (one port only)
+    if (arg_u16GpioName >= HAL_GPIO_MAX_PORT || arg_u16GpioName == 0 || (arg_u16GpioName & (arg_u16GpioName - 1)) != 0 || arg_constpu16UnusedPins == NULL)
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState == HAL_GPIO_OK)
+    {
+        *arg_constpu16UnusedPins = (uint16_t)~globalArr_GPIO_OwnedPins_u16[LIB_MATH_BTT_u8GetMSBSetPos(arg_u16GpioName)];
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_UnusedPinsToAnalog(uint16_t arg_u16GpioNames)
+{
+    // local used variables
+    HAL_GPIO_ErrStates_t local_errState = HAL_GPIO_OK;
+    __io HAL_GPIO_RegDef_t *local_pPortReg = NULL;
+    uint32_t local_u32PinsFieldsMask = 0;
+    uint32_t local_u32Primask = 0;
+    uint16_t local_u16Port = 0;
+    uint16_t local_u16UnusedPins = 0;
+    uint16_t local_u16LockedPins = 0;
+    uint8_t local_u8PinIterator = 0;
+
+    // check for errors
+    if (arg_u16GpioNames >= HAL_GPIO_MAX_PORT || arg_u16GpioNames == 0)
+    {
+        local_errState = HAL_GPIO_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    while (local_errState == HAL_GPIO_OK && arg_u16GpioNames != 0)
+    {
+        local_u16Port = arg_u16GpioNames & (uint16_t)(~arg_u16GpioNames + 1);
+        arg_u16GpioNames &= (uint16_t)~local_u16Port;
+
+        local_pPortReg = global_pGPIOs[LIB_MATH_BTT_u8GetMSBSetPos(local_u16Port)];
+
+        // the unused pins are read inside the critical section so a pin claimed from an interrupt is never switched
+        HAL_CM4F_ENTER_CRITICAL(local_u32Primask);
+        local_u16UnusedPins = (uint16_t)~globalArr_GPIO_OwnedPins_u16[LIB_MATH_BTT_u8GetMSBSetPos(local_u16Port)];
+        local_u16LockedPins = 0;
+        if (LIB_MATH_BTT_GET_BIT(local_pPortReg->GPIOx_LCKR, HAL_GPIOx_LCKR_LCKK))
+        {
+            local_u16LockedPins = (uint16_t)local_pPortReg->GPIOx_LCKR;
+        }
+
+        if ((local_u16UnusedPins & local_u16LockedPins) != 0)
+        {
+            local_errState = HAL_GPIO_ERR_PIN_LOCKED;
+        }
+        else
+        {
+            // analog mode is 0b11 in MODER and no pull is 0b00 in PUPDR
+            local_u32PinsFieldsMask = 0;
+            for (local_u8PinIterator = 0; local_u8PinIterator < HAL_GPIO_MAX_PIN_INDEX; local_u8PinIterator++)
+            {
+                if (LIB_MATH_BTT_GET_BIT(local_u16UnusedPins, local_u8PinIterator))
+                {
+                    local_u32PinsFieldsMask |= 3UL << (local_u8PinIterator * 2);
+                }
+            }
+            local_pPortReg->GPIOx_MODER |= local_u32PinsFieldsMask;
+            local_pPortReg->GPIOx_PUPDR &= ~local_u32PinsFieldsMask;
+        }
+        HAL_CM4F_EXIT_CRITICAL(local_u32Primask);
+    }
+
+    return local_errState;
+}
+
+/**
+ * @brief: used as a helpful function
+ */
+static void HAL_GPIO_CaptureReleasePins(HAL_GPIO_Capture_t *const arg_constpCapture)
+{
+    if (arg_constpCapture->ClaimedPins != 0)
+    {
+        HAL_GPIO_PinsRelease((uint16_t)(1U << arg_constpCapture->PortIndex), arg_constpCapture->ClaimedPins);
+        arg_constpCapture->ClaimedPins = 0;
+    }
+    else
+    {
+        // do nothing
+    }
+}
+
+/**
+ * @brief: used as a helpful function
+ */
+static void HAL_GPIO_KeypadReleasePins(HAL_GPIO_Keypad_t *const arg_constpKeypad)
+{
+    if (arg_constpKeypad->RowsClaimedPins != 0)
+    {
+        HAL_GPIO_PinsRelease(arg_constpKeypad->RowsPort, arg_constpKeypad->RowsClaimedPins);
+        arg_constpKeypad->RowsClaimedPins = 0;
+    }
+    else
+    {
+        // do nothing
+    }
+
+    if (arg_constpKeypad->ColumnsClaimedPins != 0)
+    {
+        HAL_GPIO_PinsRelease(arg_constpKeypad->ColumnsPort, arg_constpKeypad->ColumnsClaimedPins);
+        arg_constpKeypad->ColumnsClaimedPins = 0;
+    }
+    else
+    {
+        // do nothing
+    }
+}
+
 /*************** END OF FUNCTIONS ***************************************************************************/
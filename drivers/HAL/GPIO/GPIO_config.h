@@ -77,10 +77,198 @@
  * Configuration Constants
  *******************************************************************************/
 
+/**
+ * @user_todo: the user must edit these configurations.
+ * @brief: it configures mode, type, speed, pull-up/pull-down, locking and alternate-function of all GPIO pins, each pin is either configured using
+ *         HAL_GPIO_PIN_CONFIG(Mode, OutputType, OutputSpeed, PullUpDown, LockEnable, AlternateFunction) or left as HAL_GPIO_PIN_NOT_USED so that it keeps
+ *         its reset configuration (debug pins PA13, PA14, PA15, PB3 and PB4 keep working), a port with no used pins isn't touched at all by HAL_GPIO_Init().
+ * @note: these are macros (not a table) so that the registers values of every port are computed by the compiler, refer to @HAL_GPIO_PIN_CONFIG in "GPIO_config.h".
+ */
+// configure pins of GPIO A
+#define HAL_GPIO_PA0_CONFIG HAL_GPIO_PIN_CONFIG(HAL_GPIO_PIN_MODE_OUTPUT, HAL_GPIO_OUT_MODE_PUSH_PULL, HAL_GPIO_OUT_SPEED_VERY_HIGH, HAL_GPIO_NO_PULL_UP_DOWN, LIB_CONSTANTS_UNLOCKED, HAL_GPIOA_PIN0_EVENTOUT)
+#define HAL_GPIO_PA1_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PA2_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PA3_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PA4_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PA5_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PA6_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PA7_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PA8_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PA9_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PA10_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PA11_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PA12_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PA13_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PA14_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PA15_CONFIG HAL_GPIO_PIN_NOT_USED
+
+// configure pins of GPIO B
+#define HAL_GPIO_PB0_CONFIG HAL_GPIO_PIN_CONFIG(HAL_GPIO_PIN_MODE_OUTPUT, HAL_GPIO_OUT_MODE_PUSH_PULL, HAL_GPIO_OUT_SPEED_VERY_HIGH, HAL_GPIO_NO_PULL_UP_DOWN, LIB_CONSTANTS_UNLOCKED, HAL_GPIOB_PIN0_EVENTOUT)
+#define HAL_GPIO_PB1_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PB2_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PB3_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PB4_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PB5_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PB6_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PB7_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PB8_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PB9_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PB10_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PB11_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PB12_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PB13_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PB14_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PB15_CONFIG HAL_GPIO_PIN_NOT_USED
+
+// configure pins of GPIO C
+#define HAL_GPIO_PC0_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PC1_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PC2_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PC3_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PC4_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PC5_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PC6_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PC7_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PC8_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PC9_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PC10_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PC11_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PC12_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PC13_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PC14_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PC15_CONFIG HAL_GPIO_PIN_NOT_USED
+
+// configure pins of GPIO D
+#define HAL_GPIO_PD0_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PD1_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PD2_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PD3_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PD4_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PD5_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PD6_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PD7_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PD8_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PD9_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PD10_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PD11_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PD12_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PD13_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PD14_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PD15_CONFIG HAL_GPIO_PIN_NOT_USED
+
+// configure pins of GPIO E
+#define HAL_GPIO_PE0_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PE1_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PE2_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PE3_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PE4_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PE5_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PE6_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PE7_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PE8_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PE9_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PE10_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PE11_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PE12_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PE13_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PE14_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PE15_CONFIG HAL_GPIO_PIN_NOT_USED
+
+// configure pins of GPIO F
+#define HAL_GPIO_PF0_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PF1_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PF2_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PF3_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PF4_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PF5_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PF6_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PF7_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PF8_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PF9_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PF10_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PF11_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PF12_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PF13_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PF14_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PF15_CONFIG HAL_GPIO_PIN_NOT_USED
+
+// configure pins of GPIO G
+#define HAL_GPIO_PG0_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PG1_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PG2_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PG3_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PG4_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PG5_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PG6_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PG7_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PG8_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PG9_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PG10_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PG11_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PG12_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PG13_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PG14_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PG15_CONFIG HAL_GPIO_PIN_NOT_USED
+
+// configure pins of GPIO H
+#define HAL_GPIO_PH0_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PH1_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PH2_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PH3_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PH4_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PH5_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PH6_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PH7_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PH8_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PH9_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PH10_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PH11_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PH12_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PH13_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PH14_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PH15_CONFIG HAL_GPIO_PIN_NOT_USED
+
+// configure pins of GPIO I
+#define HAL_GPIO_PI0_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PI1_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PI2_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PI3_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PI4_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PI5_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PI6_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PI7_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PI8_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PI9_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PI10_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PI11_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PI12_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PI13_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PI14_CONFIG HAL_GPIO_PIN_NOT_USED
+#define HAL_GPIO_PI15_CONFIG HAL_GPIO_PIN_NOT_USED
+
 /******************************************************************************
  * Macros
  *******************************************************************************/
 
+/**
+ * @ref: HAL_GPIO_PIN_CONFIG
+ * @brief: used to configure a pin in the configuration constants above, it produces a tuple of (Used, Mode, OutputType, OutputSpeed, PullUpDown, LockEnable, AlternateFunction) where:
+ *         Mode                 ->  for possible values refer to @HAL_GPIO_PinMode_t in "GPIO_config.h".
+ *         OutputType           ->  for possible values refer to @HAL_GPIO_OutputType_t in "GPIO_config.h".
+ *         OutputSpeed          ->  for possible values refer to @HAL_GPIO_OutputSpeed_t in "GPIO_config.h", refer to @HAL_GPIO_PIN_SPEED in "GPIO_config.h" to know the electric characteristics of each speed.
+ *         PullUpDown           ->  for possible values refer to @HAL_GPIO_PullUpDown_t in "GPIO_config.h".
+ *         LockEnable           ->  for possible values refer to @LIB_CONSTANTS_LockStates_t in "constants.h".
+ *         AlternateFunction    ->  depending on which port pin you are dealing with, refer to its corresponding alternate functions so for example, if the pin belongs to port I then refer to @HAL_GPIOI_AlternateFunctions_t in "GPIO_config.h".
+ */
+#define HAL_GPIO_PIN_CONFIG(MODE, OUTPUT_TYPE, OUTPUT_SPEED, PULL_UP_DOWN, LOCK_ENABLE, ALTERNATE_FUNC) \
+    (1, MODE, OUTPUT_TYPE, OUTPUT_SPEED, PULL_UP_DOWN, LOCK_ENABLE, ALTERNATE_FUNC)
+
+/**
+ * @brief: used to leave a pin with its reset configuration
+ */
+#define HAL_GPIO_PIN_NOT_USED \
+    (0, 0, 0, 0, 0, 0, 0)
+
 /******************************************************************************
  * Tables
  *******************************************************************************/
@@ -1110,1803 +1298,15 @@ typedef enum
 typedef enum
 {
     HAL_GPIO_NO_PULL_UP_DOWN = 0, /**< No pull-up, pull-down resistors are enabled. */
-    HAL_GPIO_PULL_UP = 0,         /**< Pull-up resistor is enabled. */
-    HAL_GPIO_PULL_DOWN = 0,       /**< Pull-down resistor is enabled. */
+    HAL_GPIO_PULL_UP = 1,         /**< Pull-up resistor is enabled. */
+    HAL_GPIO_PULL_DOWN = 2,       /**< Pull-down resistor is enabled. */
     HAL_GPIO_MAX_PULL_UP_DOWN,    /**< this value shall never used by the user and it's only used by implementation code to verify input*/
 } HAL_GPIO_PullUpDown_t;
 
-/**
- * @struct: HAL_GPIO_PinConfig_t
- * @brief: used to configure a specific pin on a GPIO
- */
-typedef struct
-{
-    uint16_t GPIOName;         /**< for possible values refer to @HAL_GPIO_Ports_t in "GPIO_header.h", it represents the name of the GPIO port*/
-    uint16_t PINNumber;        /**< for possible values refer to @HAL_GPIO_Pins_t in "GPIO_header.h", it represents the numbre of the GPIO pin*/
-    uint8_t Mode;              /**< for possible values refer to @HAL_GPIO_PinMode_t in "GPIO_config.h", used to Configure the mode of the pin.*/
-    uint8_t OutputType;        /**< for possible values refer to @HAL_GPIO_OutputType_t in "GPIO_config.h", used to configure which method used to derive ouptut pin*/
-    uint8_t OutputSpeed;       /**< for possible values refer to @HAL_GPIO_OutputSpeed_t in "GPIO_config.h", used to configure the speed of gpio pin in case it was output, refer to @HAL_GPIO_PIN_SPEED in "GPIO_config.h" to know the electric characteristics of each speed */
-    uint8_t PullUpDown;        /**< for possible values refer to @HAL_GPIO_PullUpDown_t in "GPIO_config.h", used to enable/disable pull-up/pull-down resistors of a pin*/
-    uint8_t LockEnable;        /**< for possible values refer to @LIB_CONSTANTS_LockStates_t in "constants.h", used to lock configuration for such pin so that it can't be changed unless after a reset*/
-    uint8_t AlternateFunction; /**< depending on which port pin you are dealling with, refer to its corresponding avaialbe alternate functions so for example, if the pin belong to port I then refer to  @HAL_GPIOI_AlternateFunctions_t in "GPIO_config.h", if ihe pin belongs to PORT A then refer to @HAL_GPIOA_AlternateFunctions_t in "GPIO_config.h" and so on, used to assign a specific functionlity to a pin so that a pin can be configured to be USART2 RX and so on.*/
-} HAL_GPIO_PinConfig_t;
-
 /******************************************************************************
  * Variables
  *******************************************************************************/
 
-/**
- * @user_todo: the user must edit this array.
- * @brief: it configures mode, speed, type, pull-up/pull-down, mode. alternate-function and locking of all GPIO pins
- */
-const HAL_GPIO_PinConfig_t globalConstArr_GPIO_PinsConfig_t[][HAL_GPIO_MAX_PIN_INDEX] = {
-
-    // configure pins of GPIO A
-    [HAL_GPIO_PORTA_INDEX] = {
-
-        // PA0
-        [HAL_GPIO_PIN0_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTA,
-            .PINNumber = HAL_GPIO_PIN0,
-            .Mode = HAL_GPIO_PIN_MODE_OUTPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_VERY_HIGH,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOA_PIN0_EVENTOUT,
-        },
-
-        // PA1
-        [HAL_GPIO_PIN1_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTA,
-            .PINNumber = HAL_GPIO_PIN1,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOA_PIN1_EVENTOUT,
-        },
-
-        // PA2
-        [HAL_GPIO_PIN2_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTA,
-            .PINNumber = HAL_GPIO_PIN2,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOA_PIN2_EVENTOUT,
-        },
-
-        // PA3
-        [HAL_GPIO_PIN3_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTA,
-            .PINNumber = HAL_GPIO_PIN3,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOA_PIN3_EVENTOUT,
-        },
-
-        // PA4
-        [HAL_GPIO_PIN4_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTA,
-            .PINNumber = HAL_GPIO_PIN4,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOA_PIN4_EVENTOUT,
-        },
-
-        // PA5
-        [HAL_GPIO_PIN5_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTA,
-            .PINNumber = HAL_GPIO_PIN5,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOA_PIN5_EVENTOUT,
-        },
-
-        // PA6
-        [HAL_GPIO_PIN6_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTA,
-            .PINNumber = HAL_GPIO_PIN6,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOA_PIN6_EVENTOUT,
-        },
-
-        // PA7
-        [HAL_GPIO_PIN7_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTA,
-            .PINNumber = HAL_GPIO_PIN7,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOA_PIN7_EVENTOUT,
-        },
-
-        // PA8
-        [HAL_GPIO_PIN8_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTA,
-            .PINNumber = HAL_GPIO_PIN8,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOA_PIN8_EVENTOUT,
-        },
-
-        // PA9
-        [HAL_GPIO_PIN9_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTA,
-            .PINNumber = HAL_GPIO_PIN9,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOA_PIN9_EVENTOUT,
-        },
-
-        // PA10
-        [HAL_GPIO_PIN10_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTA,
-            .PINNumber = HAL_GPIO_PIN10,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOA_PIN10_EVENTOUT,
-        },
-
-        // PA11
-        [HAL_GPIO_PIN11_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTA,
-            .PINNumber = HAL_GPIO_PIN11,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOA_PIN11_EVENTOUT,
-        },
-
-        // PA12
-        [HAL_GPIO_PIN12_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTA,
-            .PINNumber = HAL_GPIO_PIN12,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOA_PIN12_EVENTOUT,
-        },
-
-        // PA13
-        [HAL_GPIO_PIN13_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTA,
-            .PINNumber = HAL_GPIO_PIN13,
-            .Mode = HAL_GPIO_PIN_MODE_ALTERNATE_FUNC,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_VERY_HIGH,
-            .PullUpDown = HAL_GPIO_PULL_UP,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOA_PIN13_JTMS_SWDIO,
-        },
-
-        // PA14
-        [HAL_GPIO_PIN14_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTA,
-            .PINNumber = HAL_GPIO_PIN14,
-            .Mode = HAL_GPIO_PIN_MODE_ALTERNATE_FUNC,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_PULL_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOA_PIN14_JTCK_SWCLK,
-        },
-
-        // PA15
-        [HAL_GPIO_PIN15_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTA,
-            .PINNumber = HAL_GPIO_PIN15,
-            .Mode = HAL_GPIO_PIN_MODE_ALTERNATE_FUNC,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_PULL_UP,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOA_PIN15_JTDI,
-        },
-    },
-
-    // configure pins of GPIO B
-    [HAL_GPIO_PORTB_INDEX] = {
-
-        // PB0
-        [HAL_GPIO_PIN0_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTB,
-            .PINNumber = HAL_GPIO_PIN0,
-            .Mode = HAL_GPIO_PIN_MODE_OUTPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_VERY_HIGH,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOB_PIN0_EVENTOUT,
-        },
-
-        // PB1
-        [HAL_GPIO_PIN1_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTB,
-            .PINNumber = HAL_GPIO_PIN1,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOB_PIN1_EVENTOUT,
-        },
-
-        // PB2
-        [HAL_GPIO_PIN2_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTB,
-            .PINNumber = HAL_GPIO_PIN2,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOB_PIN2_EVENTOUT,
-        },
-
-        // PB3
-        [HAL_GPIO_PIN3_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTB,
-            .PINNumber = HAL_GPIO_PIN3,
-            .Mode = HAL_GPIO_PIN_MODE_ALTERNATE_FUNC,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_VERY_HIGH,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOB_PIN3_JTDO,
-        },
-
-        // PB4
-        [HAL_GPIO_PIN4_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTB,
-            .PINNumber = HAL_GPIO_PIN4,
-            .Mode = HAL_GPIO_PIN_MODE_ALTERNATE_FUNC,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_PULL_UP,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOB_PIN4_NJTRST,
-        },
-
-        // PB5
-        [HAL_GPIO_PIN5_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTB,
-            .PINNumber = HAL_GPIO_PIN5,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOB_PIN5_EVENTOUT,
-        },
-
-        // PB6
-        [HAL_GPIO_PIN6_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTB,
-            .PINNumber = HAL_GPIO_PIN6,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOB_PIN6_EVENTOUT,
-        },
-
-        // PB7
-        [HAL_GPIO_PIN7_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTB,
-            .PINNumber = HAL_GPIO_PIN7,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOB_PIN7_EVENTOUT,
-        },
-
-        // PB8
-        [HAL_GPIO_PIN8_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTB,
-            .PINNumber = HAL_GPIO_PIN8,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOB_PIN8_EVENTOUT,
-        },
-
-        // PB9
-        [HAL_GPIO_PIN9_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTB,
-            .PINNumber = HAL_GPIO_PIN9,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOB_PIN9_EVENTOUT,
-        },
-
-        // PB10
-        [HAL_GPIO_PIN10_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTB,
-            .PINNumber = HAL_GPIO_PIN10,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOB_PIN10_EVENTOUT,
-        },
-
-        // PB11
-        [HAL_GPIO_PIN11_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTB,
-            .PINNumber = HAL_GPIO_PIN11,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOB_PIN11_EVENTOUT,
-        },
-
-        // PB12
-        [HAL_GPIO_PIN12_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTB,
-            .PINNumber = HAL_GPIO_PIN12,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOB_PIN12_EVENTOUT,
-        },
-
-        // PB13
-        [HAL_GPIO_PIN13_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTB,
-            .PINNumber = HAL_GPIO_PIN13,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOB_PIN13_EVENTOUT,
-        },
-
-        // PB14
-        [HAL_GPIO_PIN14_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTB,
-            .PINNumber = HAL_GPIO_PIN14,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOB_PIN14_EVENTOUT,
-        },
-
-        // PB15
-        [HAL_GPIO_PIN15_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTB,
-            .PINNumber = HAL_GPIO_PIN15,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOB_PIN15_EVENTOUT,
-        },
-    },
-
-    // configure pins of GPIO C
-    [HAL_GPIO_PORTC_INDEX] = {
-
-        // PC0
-        [HAL_GPIO_PIN0_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTC,
-            .PINNumber = HAL_GPIO_PIN0,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOC_PIN0_EVENTOUT,
-        },
-
-        // PC1
-        [HAL_GPIO_PIN1_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTC,
-            .PINNumber = HAL_GPIO_PIN1,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOC_PIN1_EVENTOUT,
-        },
-
-        // PC2
-        [HAL_GPIO_PIN2_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTC,
-            .PINNumber = HAL_GPIO_PIN2,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOC_PIN2_EVENTOUT,
-        },
-
-        // PC3
-        [HAL_GPIO_PIN3_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTC,
-            .PINNumber = HAL_GPIO_PIN3,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOC_PIN3_EVENTOUT,
-        },
-
-        // PC4
-        [HAL_GPIO_PIN4_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTC,
-            .PINNumber = HAL_GPIO_PIN4,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOC_PIN4_EVENTOUT,
-        },
-
-        // PC5
-        [HAL_GPIO_PIN5_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTC,
-            .PINNumber = HAL_GPIO_PIN5,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOC_PIN5_EVENTOUT,
-        },
-
-        // PC6
-        [HAL_GPIO_PIN6_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTC,
-            .PINNumber = HAL_GPIO_PIN6,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOC_PIN6_EVENTOUT,
-        },
-
-        // PC7
-        [HAL_GPIO_PIN7_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTC,
-            .PINNumber = HAL_GPIO_PIN7,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOC_PIN7_EVENTOUT,
-        },
-
-        // PC8
-        [HAL_GPIO_PIN8_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTC,
-            .PINNumber = HAL_GPIO_PIN8,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOC_PIN8_EVENTOUT,
-        },
-
-        // PC9
-        [HAL_GPIO_PIN9_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTC,
-            .PINNumber = HAL_GPIO_PIN9,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOC_PIN9_EVENTOUT,
-        },
-
-        // PC10
-        [HAL_GPIO_PIN10_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTC,
-            .PINNumber = HAL_GPIO_PIN10,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOC_PIN10_EVENTOUT,
-        },
-
-        // PC11
-        [HAL_GPIO_PIN11_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTC,
-            .PINNumber = HAL_GPIO_PIN11,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOC_PIN11_EVENTOUT,
-        },
-
-        // PC12
-        [HAL_GPIO_PIN12_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTC,
-            .PINNumber = HAL_GPIO_PIN12,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOC_PIN12_EVENTOUT,
-        },
-
-        // PC13
-        [HAL_GPIO_PIN13_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTC,
-            .PINNumber = HAL_GPIO_PIN13,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOC_PIN13_EVENTOUT,
-        },
-
-        // PC14
-        [HAL_GPIO_PIN14_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTC,
-            .PINNumber = HAL_GPIO_PIN14,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOC_PIN14_EVENTOUT,
-        },
-
-        // PC15
-        [HAL_GPIO_PIN15_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTC,
-            .PINNumber = HAL_GPIO_PIN15,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOC_PIN15_EVENTOUT,
-        },
-    },
-
-    // configure pins of GPIO D
-    [HAL_GPIO_PORTD_INDEX] = {
-
-        // PD0
-        [HAL_GPIO_PIN0_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTD,
-            .PINNumber = HAL_GPIO_PIN0,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOD_PIN0_EVENTOUT,
-        },
-
-        // PD1
-        [HAL_GPIO_PIN1_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTD,
-            .PINNumber = HAL_GPIO_PIN1,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOD_PIN1_EVENTOUT,
-        },
-
-        // PD2
-        [HAL_GPIO_PIN2_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTD,
-            .PINNumber = HAL_GPIO_PIN2,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOD_PIN2_EVENTOUT,
-        },
-
-        // PD3
-        [HAL_GPIO_PIN3_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTD,
-            .PINNumber = HAL_GPIO_PIN3,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOD_PIN3_EVENTOUT,
-        },
-
-        // PD4
-        [HAL_GPIO_PIN4_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTD,
-            .PINNumber = HAL_GPIO_PIN4,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOD_PIN4_EVENTOUT,
-        },
-
-        // PD5
-        [HAL_GPIO_PIN5_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTD,
-            .PINNumber = HAL_GPIO_PIN5,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOD_PIN5_EVENTOUT,
-        },
-
-        // PD6
-        [HAL_GPIO_PIN6_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTD,
-            .PINNumber = HAL_GPIO_PIN6,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOD_PIN6_EVENTOUT,
-        },
-
-        // PD7
-        [HAL_GPIO_PIN7_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTD,
-            .PINNumber = HAL_GPIO_PIN7,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOD_PIN7_EVENTOUT,
-        },
-
-        // PD8
-        [HAL_GPIO_PIN8_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTD,
-            .PINNumber = HAL_GPIO_PIN8,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOD_PIN8_EVENTOUT,
-        },
-
-        // PD9
-        [HAL_GPIO_PIN9_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTD,
-            .PINNumber = HAL_GPIO_PIN9,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOD_PIN9_EVENTOUT,
-        },
-
-        // PD10
-        [HAL_GPIO_PIN10_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTD,
-            .PINNumber = HAL_GPIO_PIN10,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOD_PIN10_EVENTOUT,
-        },
-
-        // PD11
-        [HAL_GPIO_PIN11_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTD,
-            .PINNumber = HAL_GPIO_PIN11,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOD_PIN11_EVENTOUT,
-        },
-
-        // PD12
-        [HAL_GPIO_PIN12_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTD,
-            .PINNumber = HAL_GPIO_PIN12,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOD_PIN12_EVENTOUT,
-        },
-
-        // PD13
-        [HAL_GPIO_PIN13_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTD,
-            .PINNumber = HAL_GPIO_PIN13,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOD_PIN13_EVENTOUT,
-        },
-
-        // PD14
-        [HAL_GPIO_PIN14_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTD,
-            .PINNumber = HAL_GPIO_PIN14,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOD_PIN14_EVENTOUT,
-        },
-
-        // PD15
-        [HAL_GPIO_PIN15_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTD,
-            .PINNumber = HAL_GPIO_PIN15,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOD_PIN15_EVENTOUT,
-        },
-    },
-
-    // configure pins of GPIO E
-    [HAL_GPIO_PORTE_INDEX] = {
-
-        // PE0
-        [HAL_GPIO_PIN0_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTE,
-            .PINNumber = HAL_GPIO_PIN0,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOE_PIN0_EVENTOUT,
-        },
-
-        // PE1
-        [HAL_GPIO_PIN1_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTE,
-            .PINNumber = HAL_GPIO_PIN1,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOE_PIN1_EVENTOUT,
-        },
-
-        // PE2
-        [HAL_GPIO_PIN2_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTE,
-            .PINNumber = HAL_GPIO_PIN2,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOE_PIN2_EVENTOUT,
-        },
-
-        // PE3
-        [HAL_GPIO_PIN3_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTE,
-            .PINNumber = HAL_GPIO_PIN3,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOE_PIN3_EVENTOUT,
-        },
-
-        // PE4
-        [HAL_GPIO_PIN4_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTE,
-            .PINNumber = HAL_GPIO_PIN4,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOE_PIN4_EVENTOUT,
-        },
-
-        // PE5
-        [HAL_GPIO_PIN5_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTE,
-            .PINNumber = HAL_GPIO_PIN5,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOE_PIN5_EVENTOUT,
-        },
-
-        // PE6
-        [HAL_GPIO_PIN6_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTE,
-            .PINNumber = HAL_GPIO_PIN6,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOE_PIN6_EVENTOUT,
-        },
-
-        // PE7
-        [HAL_GPIO_PIN7_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTE,
-            .PINNumber = HAL_GPIO_PIN7,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOE_PIN7_EVENTOUT,
-        },
-
-        // PE8
-        [HAL_GPIO_PIN8_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTE,
-            .PINNumber = HAL_GPIO_PIN8,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOE_PIN8_EVENTOUT,
-        },
-
-        // PE9
-        [HAL_GPIO_PIN9_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTE,
-            .PINNumber = HAL_GPIO_PIN9,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOE_PIN9_EVENTOUT,
-        },
-
-        // PE10
-        [HAL_GPIO_PIN10_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTE,
-            .PINNumber = HAL_GPIO_PIN10,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOE_PIN10_EVENTOUT,
-        },
-
-        // PE11
-        [HAL_GPIO_PIN11_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTE,
-            .PINNumber = HAL_GPIO_PIN11,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOE_PIN11_EVENTOUT,
-        },
-
-        // PE12
-        [HAL_GPIO_PIN12_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTE,
-            .PINNumber = HAL_GPIO_PIN12,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOE_PIN12_EVENTOUT,
-        },
-
-        // PE13
-        [HAL_GPIO_PIN13_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTE,
-            .PINNumber = HAL_GPIO_PIN13,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOE_PIN13_EVENTOUT,
-        },
-
-        // PE14
-        [HAL_GPIO_PIN14_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTE,
-            .PINNumber = HAL_GPIO_PIN14,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOE_PIN14_EVENTOUT,
-        },
-
-        // PE15
-        [HAL_GPIO_PIN15_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTE,
-            .PINNumber = HAL_GPIO_PIN15,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOE_PIN15_EVENTOUT,
-        },
-    },
-
-    // configure pins of GPIO F
-    [HAL_GPIO_PORTF_INDEX] = {
-
-        // PF0
-        [HAL_GPIO_PIN0_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTF,
-            .PINNumber = HAL_GPIO_PIN0,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOF_PIN0_EVENTOUT,
-        },
-
-        // PF1
-        [HAL_GPIO_PIN1_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTF,
-            .PINNumber = HAL_GPIO_PIN1,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOF_PIN1_EVENTOUT,
-        },
-
-        // PF2
-        [HAL_GPIO_PIN2_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTF,
-            .PINNumber = HAL_GPIO_PIN2,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOF_PIN2_EVENTOUT,
-        },
-
-        // PF3
-        [HAL_GPIO_PIN3_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTF,
-            .PINNumber = HAL_GPIO_PIN3,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOF_PIN3_EVENTOUT,
-        },
-
-        // PF4
-        [HAL_GPIO_PIN4_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTF,
-            .PINNumber = HAL_GPIO_PIN4,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOF_PIN4_EVENTOUT,
-        },
-
-        // PF5
-        [HAL_GPIO_PIN5_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTF,
-            .PINNumber = HAL_GPIO_PIN5,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOF_PIN5_EVENTOUT,
-        },
-
-        // PF6
-        [HAL_GPIO_PIN6_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTF,
-            .PINNumber = HAL_GPIO_PIN6,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOF_PIN6_EVENTOUT,
-        },
-
-        // PF7
-        [HAL_GPIO_PIN7_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTF,
-            .PINNumber = HAL_GPIO_PIN7,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOF_PIN7_EVENTOUT,
-        },
-
-        // PF8
-        [HAL_GPIO_PIN8_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTF,
-            .PINNumber = HAL_GPIO_PIN8,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOF_PIN8_EVENTOUT,
-        },
-
-        // PF9
-        [HAL_GPIO_PIN9_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTF,
-            .PINNumber = HAL_GPIO_PIN9,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOF_PIN9_EVENTOUT,
-        },
-
-        // PF10
-        [HAL_GPIO_PIN10_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTF,
-            .PINNumber = HAL_GPIO_PIN10,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOF_PIN10_EVENTOUT,
-        },
-
-        // PF11
-        [HAL_GPIO_PIN11_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTF,
-            .PINNumber = HAL_GPIO_PIN11,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOF_PIN11_EVENTOUT,
-        },
-
-        // PF12
-        [HAL_GPIO_PIN12_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTF,
-            .PINNumber = HAL_GPIO_PIN12,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOF_PIN12_EVENTOUT,
-        },
-
-        // PF13
-        [HAL_GPIO_PIN13_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTF,
-            .PINNumber = HAL_GPIO_PIN13,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOF_PIN13_EVENTOUT,
-        },
-
-        // PF14
-        [HAL_GPIO_PIN14_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTF,
-            .PINNumber = HAL_GPIO_PIN14,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOF_PIN14_EVENTOUT,
-        },
-
-        // PF15
-        [HAL_GPIO_PIN15_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTF,
-            .PINNumber = HAL_GPIO_PIN15,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOF_PIN15_EVENTOUT,
-        },
-    },
-
-    // configure pins of GPIO G
-    [HAL_GPIO_PORTG_INDEX] = {
-
-        // PG0
-        [HAL_GPIO_PIN0_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTG,
-            .PINNumber = HAL_GPIO_PIN0,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOG_PIN0_EVENTOUT,
-        },
-
-        // PG1
-        [HAL_GPIO_PIN1_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTG,
-            .PINNumber = HAL_GPIO_PIN1,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOG_PIN1_EVENTOUT,
-        },
-
-        // PG2
-        [HAL_GPIO_PIN2_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTG,
-            .PINNumber = HAL_GPIO_PIN2,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOG_PIN2_EVENTOUT,
-        },
-
-        // PG3
-        [HAL_GPIO_PIN3_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTG,
-            .PINNumber = HAL_GPIO_PIN3,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOG_PIN3_EVENTOUT,
-        },
-
-        // PG4
-        [HAL_GPIO_PIN4_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTG,
-            .PINNumber = HAL_GPIO_PIN4,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOG_PIN4_EVENTOUT,
-        },
-
-        // PG5
-        [HAL_GPIO_PIN5_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTG,
-            .PINNumber = HAL_GPIO_PIN5,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOG_PIN5_EVENTOUT,
-        },
-
-        // PG6
-        [HAL_GPIO_PIN6_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTG,
-            .PINNumber = HAL_GPIO_PIN6,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOG_PIN6_EVENTOUT,
-        },
-
-        // PG7
-        [HAL_GPIO_PIN7_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTG,
-            .PINNumber = HAL_GPIO_PIN7,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOG_PIN7_EVENTOUT,
-        },
-
-        // PG8
-        [HAL_GPIO_PIN8_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTG,
-            .PINNumber = HAL_GPIO_PIN8,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOG_PIN8_EVENTOUT,
-        },
-
-        // PG9
-        [HAL_GPIO_PIN9_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTG,
-            .PINNumber = HAL_GPIO_PIN9,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOG_PIN9_EVENTOUT,
-        },
-
-        // PG10
-        [HAL_GPIO_PIN10_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTG,
-            .PINNumber = HAL_GPIO_PIN10,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOG_PIN10_EVENTOUT,
-        },
-
-        // PG11
-        [HAL_GPIO_PIN11_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTG,
-            .PINNumber = HAL_GPIO_PIN11,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOG_PIN11_EVENTOUT,
-        },
-
-        // PG12
-        [HAL_GPIO_PIN12_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTG,
-            .PINNumber = HAL_GPIO_PIN12,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOG_PIN12_EVENTOUT,
-        },
-
-        // PG13
-        [HAL_GPIO_PIN13_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTG,
-            .PINNumber = HAL_GPIO_PIN13,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOG_PIN13_EVENTOUT,
-        },
-
-        // PG14
-        [HAL_GPIO_PIN14_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTG,
-            .PINNumber = HAL_GPIO_PIN14,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOG_PIN14_EVENTOUT,
-        },
-
-        // PG15
-        [HAL_GPIO_PIN15_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTG,
-            .PINNumber = HAL_GPIO_PIN15,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOG_PIN15_EVENTOUT,
-        },
-    },
-
-    // configure pins of GPIO H
-    [HAL_GPIO_PORTH_INDEX] = {
-
-        // PH0
-        [HAL_GPIO_PIN0_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTH,
-            .PINNumber = HAL_GPIO_PIN0,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOH_PIN0_EVENTOUT,
-        },
-
-        // PH1
-        [HAL_GPIO_PIN1_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTH,
-            .PINNumber = HAL_GPIO_PIN1,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOH_PIN1_EVENTOUT,
-        },
-
-        // PH2
-        [HAL_GPIO_PIN2_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTH,
-            .PINNumber = HAL_GPIO_PIN2,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOH_PIN2_EVENTOUT,
-        },
-
-        // PH3
-        [HAL_GPIO_PIN3_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTH,
-            .PINNumber = HAL_GPIO_PIN3,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOH_PIN3_EVENTOUT,
-        },
-
-        // PH4
-        [HAL_GPIO_PIN4_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTH,
-            .PINNumber = HAL_GPIO_PIN4,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOH_PIN4_EVENTOUT,
-        },
-
-        // PH5
-        [HAL_GPIO_PIN5_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTH,
-            .PINNumber = HAL_GPIO_PIN5,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOH_PIN5_EVENTOUT,
-        },
-
-        // PH6
-        [HAL_GPIO_PIN6_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTH,
-            .PINNumber = HAL_GPIO_PIN6,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOH_PIN6_EVENTOUT,
-        },
-
-        // PH7
-        [HAL_GPIO_PIN7_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTH,
-            .PINNumber = HAL_GPIO_PIN7,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOH_PIN7_EVENTOUT,
-        },
-
-        // PH8
-        [HAL_GPIO_PIN8_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTH,
-            .PINNumber = HAL_GPIO_PIN8,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOH_PIN8_EVENTOUT,
-        },
-
-        // PH9
-        [HAL_GPIO_PIN9_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTH,
-            .PINNumber = HAL_GPIO_PIN9,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOH_PIN9_EVENTOUT,
-        },
-
-        // PH10
-        [HAL_GPIO_PIN10_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTH,
-            .PINNumber = HAL_GPIO_PIN10,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOH_PIN10_EVENTOUT,
-        },
-
-        // PH11
-        [HAL_GPIO_PIN11_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTH,
-            .PINNumber = HAL_GPIO_PIN11,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOH_PIN11_EVENTOUT,
-        },
-
-        // PH12
-        [HAL_GPIO_PIN12_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTH,
-            .PINNumber = HAL_GPIO_PIN12,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOH_PIN12_EVENTOUT,
-        },
-
-        // PH13
-        [HAL_GPIO_PIN13_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTH,
-            .PINNumber = HAL_GPIO_PIN13,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOH_PIN13_EVENTOUT,
-        },
-
-        // PH14
-        [HAL_GPIO_PIN14_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTH,
-            .PINNumber = HAL_GPIO_PIN14,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOH_PIN14_EVENTOUT,
-        },
-
-        // PH15
-        [HAL_GPIO_PIN15_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTH,
-            .PINNumber = HAL_GPIO_PIN15,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOH_PIN15_EVENTOUT,
-        },
-    },
-
-    // configure pins of GPIO I
-    [HAL_GPIO_PORTI_INDEX] = {
-
-        // PI0
-        [HAL_GPIO_PIN0_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTI,
-            .PINNumber = HAL_GPIO_PIN0,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOI_PIN0_EVENTOUT,
-        },
-
-        // PI1
-        [HAL_GPIO_PIN1_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTI,
-            .PINNumber = HAL_GPIO_PIN1,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOI_PIN1_EVENTOUT,
-        },
-
-        // PI2
-        [HAL_GPIO_PIN2_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTI,
-            .PINNumber = HAL_GPIO_PIN2,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOI_PIN2_EVENTOUT,
-        },
-
-        // PI3
-        [HAL_GPIO_PIN3_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTI,
-            .PINNumber = HAL_GPIO_PIN3,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOI_PIN3_EVENTOUT,
-        },
-
-        // PI4
-        [HAL_GPIO_PIN4_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTI,
-            .PINNumber = HAL_GPIO_PIN4,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOI_PIN4_EVENTOUT,
-        },
-
-        // PI5
-        [HAL_GPIO_PIN5_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTI,
-            .PINNumber = HAL_GPIO_PIN5,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOI_PIN5_EVENTOUT,
-        },
-
-        // PI6
-        [HAL_GPIO_PIN6_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTI,
-            .PINNumber = HAL_GPIO_PIN6,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOI_PIN6_EVENTOUT,
-        },
-
-        // PI7
-        [HAL_GPIO_PIN7_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTI,
-            .PINNumber = HAL_GPIO_PIN7,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOI_PIN7_EVENTOUT,
-        },
-
-        // PI8
-        [HAL_GPIO_PIN8_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTI,
-            .PINNumber = HAL_GPIO_PIN8,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOI_PIN8_EVENTOUT,
-        },
-
-        // PI9
-        [HAL_GPIO_PIN9_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTI,
-            .PINNumber = HAL_GPIO_PIN9,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOI_PIN9_EVENTOUT,
-        },
-
-        // PI10
-        [HAL_GPIO_PIN10_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTI,
-            .PINNumber = HAL_GPIO_PIN10,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOI_PIN10_EVENTOUT,
-        },
-
-        // PI11
-        [HAL_GPIO_PIN11_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTI,
-            .PINNumber = HAL_GPIO_PIN11,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOI_PIN11_EVENTOUT,
-        },
-
-        // PI12
-        [HAL_GPIO_PIN12_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTI,
-            .PINNumber = HAL_GPIO_PIN12,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOI_PIN12_EVENTOUT,
-        },
-
-        // PI13
-        [HAL_GPIO_PIN13_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTI,
-            .PINNumber = HAL_GPIO_PIN13,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOI_PIN13_EVENTOUT,
-        },
-
-        // PI14
-        [HAL_GPIO_PIN14_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTI,
-            .PINNumber = HAL_GPIO_PIN14,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOI_PIN14_EVENTOUT,
-        },
-
-        // PI15
-        [HAL_GPIO_PIN15_INDEX] = {
-            .GPIOName = HAL_GPIO_PORTI,
-            .PINNumber = HAL_GPIO_PIN15,
-            .Mode = HAL_GPIO_PIN_MODE_INPUT,
-            .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
-            .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW,
-            .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN,
-            .LockEnable = LIB_CONSTANTS_UNLOCKED,
-            .AlternateFunction = HAL_GPIOI_PIN15_EVENTOUT,
-        },
-    },
-
-};
-
 /******************************************************************************
  * Function Prototypes
  *******************************************************************************/
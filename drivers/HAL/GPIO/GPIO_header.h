@@ -54,10 +54,38 @@
  */
 #include "../../lib/stdint.h"
 
+/**
+ * @reason: contains volatile keyword definition regarding selected compiler
+ */
+#include "../../lib/common.h"
+
+/**
+ * @reason: contains base address of AHB1 bus on which GPIO ports lie and bit-band alias macros
+ */
+#include "../CM4F/CM4F_header.h"
+
 /******************************************************************************
  * Preprocessor Constants
  *******************************************************************************/
 
+/**
+ * @brief: these are used by the compile-time pin handles to reach GPIO registers without going through the ports table
+ */
+#define HAL_GPIO_PORT_ADDR_STRIDE 0x00000400 /**< distance between two consecutive GPIO ports on AHB1 bus*/
+#define HAL_GPIO_IDR_OFFSET 0x00000010       /**< offset of GPIOx_IDR from the GPIO port base address*/
+#define HAL_GPIO_ODR_OFFSET 0x00000014       /**< offset of GPIOx_ODR from the GPIO port base address*/
+#define HAL_GPIO_BSRR_OFFSET 0x00000018      /**< offset of GPIOx_BSRR from the GPIO port base address*/
+
+/**
+ * @brief: maximum number of slots a bit can be drawn with by the waveform engine (refer to @HAL_GPIO_WaveformSymbols_t)
+ */
+#define HAL_GPIO_MAX_WAVEFORM_SLOTS 16
+
+/**
+ * @brief: maximum number of rows a keypad matrix can have (refer to @HAL_GPIO_Keypad_t)
+ */
+#define HAL_GPIO_KEYPAD_MAX_ROWS 8
+
 /******************************************************************************
  * Configuration Constants
  *******************************************************************************/
@@ -66,6 +94,262 @@
  * Macros
  *******************************************************************************/
 
+/**
+ *  \b Macro                        :       HAL_GPIO_TOGGLE_BSRR_VAL(ODR_SNAPSHOT, PINS_MASK)
+ *  \b Description                  :       this macro builds the BSRR word that toggles the pins in PINS_MASK given one snapshot of ODR register,
+ *                                          pins that are high go to the reset half (bits 16-31) and pins that are low go to the set half (bits 0-15).
+ *                                          ODR_SNAPSHOT is evaluated only once (the masked value is mirrored into both halves by multiplying with 0x00010001 then
+ *                                          the low half is inverted) so it can be the volatile register itself.
+ *  @param    ODR_SNAPSHOT          :       the value read from GPIOx_ODR.
+ *  @param    PINS_MASK             :       the pins to be toggled, for possible values refer to @HAL_GPIO_Pins_t in "GPIO_header.h".
+ *  \b PRE-CONDITION                :       None.
+ *  \b POST-CONDITION               :       None.
+ *  @return                         :       the value to be written into GPIOx_BSRR.
+ *  @see                            :       HAL_GPIO_FAST_TOGGLE(HANDLE)
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+#define HAL_GPIO_TOGGLE_BSRR_VAL(ODR_SNAPSHOT, PINS_MASK) \
+    ((((uint32_t)(ODR_SNAPSHOT) & (uint32_t)(PINS_MASK)) * 0x00010001UL) ^ (uint32_t)(PINS_MASK))
+
+/**
+ *  \b Macro                        :       HAL_GPIO_PIN_HANDLE(PORT, PINS)
+ *  \b Description                  :       this macro packs a port and a set of pins of that port into one 32-bit constant (port in bits 16-31 and pins in bits 0-15)
+ *                                          to be used with HAL_GPIO_FAST_xxx() macros, when the handle is a compile time constant the port address and the pins mask
+ *                                          are folded by the compiler so every fast operation becomes one store to BSRR or one load from IDR with no parameters
+ *                                          checking, no call and no port search loop.
+ *  @param    PORT                  :       only one port, for possible values refer to @HAL_GPIO_Ports_t in "GPIO_header.h".
+ *  @param    PINS                  :       one or more pins of that port, for possible values refer to @HAL_GPIO_Pins_t in "GPIO_header.h".
+ *  \b PRE-CONDITION                :       make sure to call HAL_GPIO_Init() and that PORT holds only one port.
+ *  \b POST-CONDITION               :       None.
+ *  @return                         :       the pin handle.
+ *  @see                            :       HAL_GPIO_FAST_WRITE_HIGH(HANDLE)
+ *  @see                            :       HAL_GPIO_FAST_WRITE_LOW(HANDLE)
+ *  @see                            :       HAL_GPIO_FAST_WRITE(HANDLE, STATE)
+ *  @see                            :       HAL_GPIO_FAST_TOGGLE(HANDLE)
+ *  @see                            :       HAL_GPIO_FAST_READ(HANDLE)
+ *  @note                           :       cost isn't measured, only the instructions each operation compiles to with a constant handle are listed:
+ *                                          | operation          | HAL_GPIO_PinStateModify()/Read()        | fast handle                           |
+ *                                          |--------------------|-----------------------------------------|---------------------------------------|
+ *                                          | write high/low     | call, parameters checks, port search    | STR to BSRR                           |
+ *                                          | toggle             | call, parameters checks, port search    | LDR from ODR, AND, MUL, EOR, STR      |
+ *                                          | read one pin       | call, parameters checks, port search    | LDR from IDR, AND                     |
+ *                                          loads from ODR/IDR cross the bus matrix to AHB1 and stall for the GPIO access latency, so toggling and reading
+ *                                          cost more than their instruction count, cycle counts have to be taken on the target with DWT CYCCNT
+ *                                          (enabled by HAL_CM4F_BootProfileStart()) around the operation.
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * #define LCD_CS  HAL_GPIO_PIN_HANDLE(HAL_GPIO_PORTB, HAL_GPIO_PIN12)
+ * int main() {
+ *  HAL_GPIO_Init();
+ *  HAL_GPIO_FAST_WRITE_LOW(LCD_CS);    // one store to GPIOB_BSRR
+ *  HAL_GPIO_FAST_WRITE_HIGH(LCD_CS);   // one store to GPIOB_BSRR
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.1            </td><td> AMS      </td><td> unmeasured cycle estimates removed </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+#define HAL_GPIO_PIN_HANDLE(PORT, PINS) \
+    (((uint32_t)(PORT) << 16) | (uint32_t)(uint16_t)(PINS))
+
+/**
+ * @brief: these are used to extract data from a pin handle, the port index is found using count trailing zeros which the compiler folds for constant handles
+ */
+#define HAL_GPIO_HANDLE_PINS(HANDLE) \
+    ((uint32_t)(uint16_t)(HANDLE))
+
+#define HAL_GPIO_HANDLE_PORT_BASE_ADDR(HANDLE) \
+    (HAL_CM4F_AHB1_BASEADDR + (HAL_GPIO_PORT_ADDR_STRIDE * (uint32_t)__builtin_ctz((uint32_t)(HANDLE) >> 16)))
+
+#define HAL_GPIO_HANDLE_REG(HANDLE, REG_OFFSET) \
+    (*(__io uint32_t *)(HAL_GPIO_HANDLE_PORT_BASE_ADDR(HANDLE) + (REG_OFFSET)))
+
+/**
+ *  \b Macro                        :       HAL_GPIO_FAST_WRITE_HIGH(HANDLE)
+ *  \b Description                  :       this macro drives the pins of the handle high using only one store to GPIOx_BSRR.
+ *  @param    HANDLE                :       pin handle created by HAL_GPIO_PIN_HANDLE(PORT, PINS).
+ *  \b PRE-CONDITION                :       make sure to call HAL_GPIO_Init() and that pins are configured as output.
+ *  \b POST-CONDITION               :       pins of the handle are high.
+ *  @return                         :       None.
+ *  @see                            :       HAL_GPIO_PIN_HANDLE(PORT, PINS)
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+#define HAL_GPIO_FAST_WRITE_HIGH(HANDLE) \
+    (HAL_GPIO_HANDLE_REG(HANDLE, HAL_GPIO_BSRR_OFFSET) = HAL_GPIO_HANDLE_PINS(HANDLE))
+
+/**
+ *  \b Macro                        :       HAL_GPIO_FAST_WRITE_LOW(HANDLE)
+ *  \b Description                  :       this macro drives the pins of the handle low using only one store to GPIOx_BSRR.
+ *  @param    HANDLE                :       pin handle created by HAL_GPIO_PIN_HANDLE(PORT, PINS).
+ *  \b PRE-CONDITION                :       make sure to call HAL_GPIO_Init() and that pins are configured as output.
+ *  \b POST-CONDITION               :       pins of the handle are low.
+ *  @return                         :       None.
+ *  @see                            :       HAL_GPIO_PIN_HANDLE(PORT, PINS)
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+#define HAL_GPIO_FAST_WRITE_LOW(HANDLE) \
+    (HAL_GPIO_HANDLE_REG(HANDLE, HAL_GPIO_BSRR_OFFSET) = HAL_GPIO_HANDLE_PINS(HANDLE) << 16)
+
+/**
+ *  \b Macro                        :       HAL_GPIO_FAST_WRITE(HANDLE, STATE)
+ *  \b Description                  :       this macro drives the pins of the handle to STATE using only one store to GPIOx_BSRR.
+ *  @param    HANDLE                :       pin handle created by HAL_GPIO_PIN_HANDLE(PORT, PINS).
+ *  @param    STATE                 :       LOW or HIGH, for possible values refer to @LIB_CONSTANTS_LogicalStates_t in "constants.h".
+ *  \b PRE-CONDITION                :       make sure to call HAL_GPIO_Init() and that pins are configured as output.
+ *  \b POST-CONDITION               :       pins of the handle hold STATE.
+ *  @return                         :       None.
+ *  @see                            :       HAL_GPIO_PIN_HANDLE(PORT, PINS)
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+#define HAL_GPIO_FAST_WRITE(HANDLE, STATE) \
+    (HAL_GPIO_HANDLE_REG(HANDLE, HAL_GPIO_BSRR_OFFSET) = HAL_GPIO_HANDLE_PINS(HANDLE) << ((STATE) ? 0 : 16))
+
+/**
+ *  \b Macro                        :       HAL_GPIO_FAST_TOGGLE(HANDLE)
+ *  \b Description                  :       this macro toggles the pins of the handle using one load from GPIOx_ODR and one store to GPIOx_BSRR,
+ *                                          pins of the same port outside the handle are never written back.
+ *  @param    HANDLE                :       pin handle created by HAL_GPIO_PIN_HANDLE(PORT, PINS).
+ *  \b PRE-CONDITION                :       make sure to call HAL_GPIO_Init() and that pins are configured as output.
+ *  \b POST-CONDITION               :       pins of the handle are inverted.
+ *  @return                         :       None.
+ *  @see                            :       HAL_GPIO_PIN_HANDLE(PORT, PINS)
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+#define HAL_GPIO_FAST_TOGGLE(HANDLE) \
+    (HAL_GPIO_HANDLE_REG(HANDLE, HAL_GPIO_BSRR_OFFSET) = HAL_GPIO_TOGGLE_BSRR_VAL(HAL_GPIO_HANDLE_REG(HANDLE, HAL_GPIO_ODR_OFFSET), HAL_GPIO_HANDLE_PINS(HANDLE)))
+
+/**
+ *  \b Macro                        :       HAL_GPIO_FAST_READ(HANDLE)
+ *  \b Description                  :       this macro reads the pins of the handle using only one load from GPIOx_IDR.
+ *  @param    HANDLE                :       pin handle created by HAL_GPIO_PIN_HANDLE(PORT, PINS).
+ *  \b PRE-CONDITION                :       make sure to call HAL_GPIO_Init().
+ *  \b POST-CONDITION               :       None.
+ *  @return                         :       the masked IDR value (non-zero if any pin of the handle is high), for a single pin handle it can be used directly as a logical state.
+ *  @see                            :       HAL_GPIO_PIN_HANDLE(PORT, PINS)
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+#define HAL_GPIO_FAST_READ(HANDLE) \
+    (HAL_GPIO_HANDLE_REG(HANDLE, HAL_GPIO_IDR_OFFSET) & HAL_GPIO_HANDLE_PINS(HANDLE))
+
+/**
+ *  \b Macro                        :       HAL_GPIO_FAST_BUS_READ(HANDLE)
+ *  \b Description                  :       this macro reads a group of contiguous pins (8-bit or 16-bit bus for example) with one load from GPIOx_IDR and returns them
+ *                                          right aligned so that the lowest pin of the handle becomes bit 0.
+ *  @param    HANDLE                :       pin handle created by HAL_GPIO_PIN_HANDLE(PORT, PINS) where PINS are contiguous.
+ *  \b PRE-CONDITION                :       make sure to call HAL_GPIO_Init().
+ *  \b POST-CONDITION               :       None.
+ *  @return                         :       value of the bus.
+ *  @see                            :       HAL_GPIO_BusRead(uint16_t arg_u16GpioName, const uint16_t argConst_u16BusPins, uint16_t *const arg_constpu16Value)
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * #define DATA_BUS  HAL_GPIO_PIN_HANDLE(HAL_GPIO_PORTE, 0xFF00)    // PE8 - PE15
+ * int main() {
+ *  HAL_GPIO_Init();
+ *  uint8_t data = HAL_GPIO_FAST_BUS_READ(DATA_BUS);
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+#define HAL_GPIO_FAST_BUS_READ(HANDLE) \
+    (HAL_GPIO_FAST_READ(HANDLE) >> __builtin_ctz(HAL_GPIO_HANDLE_PINS(HANDLE)))
+
+/**
+ *  \b Macro                        :       HAL_GPIO_BITBAND_WRITE(HANDLE, STATE)
+ *  \b Description                  :       this macro writes one pin through the alias word of its GPIOx_ODR bit, it's one store with no masking and the bus
+ *                                          performs the read-modify-write atomically so other pins of the port are never affected.
+ *  @param    HANDLE                :       pin handle created by HAL_GPIO_PIN_HANDLE(PORT, PINS) holding only one pin.
+ *  @param    STATE                 :       LOW or HIGH, for possible values refer to @LIB_CONSTANTS_LogicalStates_t in "constants.h".
+ *  \b PRE-CONDITION                :       make sure to call HAL_GPIO_Init() and that the pin is configured as output.
+ *  \b POST-CONDITION               :       pin holds STATE.
+ *  @return                         :       None.
+ *  @see                            :       HAL_CM4F_PERIPH_BIT_BAND(regAddr, bitNumber)
+ *  @see                            :       HAL_GPIO_FAST_WRITE(HANDLE, STATE)
+ *  @note                           :       HAL_GPIO_FAST_WRITE() is still cheaper on the bus (1 transfer against 2), use bit-band when the state is already 0/1
+ *                                          and a branch or shift is to be avoided.
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+#define HAL_GPIO_BITBAND_WRITE(HANDLE, STATE) \
+    (HAL_CM4F_PERIPH_BIT_BAND(HAL_GPIO_HANDLE_PORT_BASE_ADDR(HANDLE) + HAL_GPIO_ODR_OFFSET, __builtin_ctz(HAL_GPIO_HANDLE_PINS(HANDLE))) = (STATE))
+
+/**
+ *  \b Macro                        :       HAL_GPIO_BITBAND_READ(HANDLE)
+ *  \b Description                  :       this macro reads one pin through the alias word of its GPIOx_IDR bit, it's one load returning 0 or 1 with no shift or mask.
+ *  @param    HANDLE                :       pin handle created by HAL_GPIO_PIN_HANDLE(PORT, PINS) holding only one pin.
+ *  \b PRE-CONDITION                :       make sure to call HAL_GPIO_Init().
+ *  \b POST-CONDITION               :       None.
+ *  @return                         :       state of the pin, for possible values refer to @LIB_CONSTANTS_LogicalStates_t in "constants.h".
+ *  @see                            :       HAL_CM4F_PERIPH_BIT_BAND(regAddr, bitNumber)
+ *  @see                            :       HAL_GPIO_FAST_READ(HANDLE)
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+#define HAL_GPIO_BITBAND_READ(HANDLE) \
+    HAL_CM4F_PERIPH_BIT_BAND(HAL_GPIO_HANDLE_PORT_BASE_ADDR(HANDLE) + HAL_GPIO_IDR_OFFSET, __builtin_ctz(HAL_GPIO_HANDLE_PINS(HANDLE)))
+
 // TODO: add the functionality for enabling backup domain access (RTC & SRAM)
 
 /******************************************************************************
@@ -78,9 +362,13 @@
  */
 typedef enum
 {
-    HAL_GPIO_OK,                 /**< it means everything has gone as intended so no errors*/
-    HAL_GPIO_ERR_INVALID_PARAMS, /**< it means that the supplied parameters of the function are invalid*/
-    HAL_GPIO_ERR_INVALID_CONFIG, /**< it means that the supplied configurations in the "GPIO_config.h" file are incorrect*/
+    HAL_GPIO_OK,                  /**< it means everything has gone as intended so no errors*/
+    HAL_GPIO_ERR_INVALID_PARAMS,  /**< it means that the supplied parameters of the function are invalid*/
+    HAL_GPIO_ERR_INVALID_CONFIG,  /**< it means that the supplied configurations in the "GPIO_config.h" file are incorrect*/
+    HAL_GPIO_ERR_PIN_LOCKED,      /**< it means that one of the pins to be reconfigured is locked by GPIOx_LCKR so nothing is changed*/
+    HAL_GPIO_ERR_PINS_CLAIMED,    /**< it means that one of the pins to be claimed is already owned by another user so nothing is claimed*/
+    HAL_GPIO_ERR_CAPTURE_OVERRUN, /**< it means that the DMA overwrote samples of a capture before they were searched or overwrote the trigger sample so the capture is stopped*/
+    HAL_GPIO_ERR_PINS_NOT_OWNED,  /**< it means that one of the pins to be reconfigured isn't configured by HAL_GPIO_Init() nor claimed so nothing is changed*/
 } HAL_GPIO_ErrStates_t;
 
 /**
@@ -138,6 +426,123 @@ typedef enum
     HAL_GPIO_MAX_PIN_OP,        /**< that value should never be used and it's only used by the implementation code for verifying the input*/
 } HAL_GPIO_PinsOperation_t;
 
+/**
+ * @enum: HAL_GPIO_WaveformTriggers_t
+ * @brief: timers update events that can pace a waveform, every trigger owns a fixed DMA2 stream.
+ */
+typedef enum
+{
+    HAL_GPIO_WAVEFORM_TRIG_TIM1_UP, /**< TIM1 update event, served by DMA2 stream 5 channel 6*/
+    HAL_GPIO_WAVEFORM_TRIG_TIM8_UP, /**< TIM8 update event, served by DMA2 stream 1 channel 7*/
+    HAL_GPIO_MAX_WAVEFORM_TRIG,     /**< that value should never be used and it's only used by the implementation code for verifying the input*/
+} HAL_GPIO_WaveformTriggers_t;
+
+/**
+ * @struct: HAL_GPIO_WaveformSymbols_t
+ * @brief: describes how a single bit is drawn on the pins as a number of equal time slots (one slot per timer update event).
+ */
+typedef struct
+{
+    uint8_t SlotsPerBit; /**< number of slots of every bit (1 up to @HAL_GPIO_MAX_WAVEFORM_SLOTS)*/
+    uint16_t Symbol0;    /**< levels of the slots of a '0' bit, bit n holds the level of slot n (slot 0 is sent first)*/
+    uint16_t Symbol1;    /**< levels of the slots of a '1' bit, bit n holds the level of slot n (slot 0 is sent first)*/
+} HAL_GPIO_WaveformSymbols_t;
+
+/**
+ * @enum: HAL_GPIO_CaptureStates_t
+ * @brief: states of a port capture.
+ */
+typedef enum
+{
+    HAL_GPIO_CAPTURE_IDLE,      /**< capture isn't started*/
+    HAL_GPIO_CAPTURE_ARMED,     /**< samples are being recorded and the pattern is being searched for*/
+    HAL_GPIO_CAPTURE_TRIGGERED, /**< pattern is found and the post trigger samples are being recorded*/
+    HAL_GPIO_CAPTURE_DONE,      /**< capture is stopped and the buffer can be read by HAL_GPIO_CaptureUnroll()*/
+    HAL_GPIO_MAX_CAPTURE_STATE, /**< that value should never be used and it's only used by the implementation code for verifying the input*/
+} HAL_GPIO_CaptureStates_t;
+
+/**
+ * @struct: HAL_GPIO_Capture_t
+ * @brief: holds a port capture, the first group of members is filled by the user and the rest is used by the implementation code.
+ */
+typedef struct
+{
+    uint16_t *Buffer;            /**< ring buffer receiving one GPIOx_IDR sample (16-bit) on every timer update event*/
+    uint16_t BufferSize;         /**< number of samples the ring buffer can hold*/
+    uint16_t PatternMask;        /**< pins that take part in the trigger pattern*/
+    uint16_t PatternValue;       /**< levels of the pins in PatternMask that fire the trigger*/
+    uint16_t PostTriggerSamples; /**< number of samples recorded after the trigger, the rest of the buffer holds the pre trigger history*/
+    uint16_t PinsMask;           /**< pins whose samples are used (PatternMask is added to them), they are claimed while the capture runs so they aren't switched to analog*/
+    uint8_t Trigger;             /**< for possible values refer to @HAL_GPIO_WaveformTriggers_t in "GPIO_header.h", used to select the timer that paces the sampling*/
+
+    uint8_t State;                /**< for possible values refer to @HAL_GPIO_CaptureStates_t in "GPIO_header.h", shall not be modified by the user*/
+    uint16_t ReadIndex;           /**< index of the next sample to be searched for the pattern, shall not be modified by the user*/
+    uint16_t TriggerIndex;        /**< index of the sample that fired the trigger, shall not be modified by the user*/
+    uint16_t SamplesSinceTrigger; /**< number of samples recorded after the trigger, shall not be modified by the user*/
+    uint16_t SamplesCount;        /**< number of valid samples in the buffer (saturates at BufferSize), shall not be modified by the user*/
+    uint16_t StopIndex;           /**< index at which the DMA stopped writing, shall not be modified by the user*/
+    uint16_t ClaimedPins;         /**< pins claimed by HAL_GPIO_CaptureStart() (refer to HAL_GPIO_PinsAttach()), shall not be modified by the user*/
+    uint8_t PortIndex;            /**< index of the sampled port in GPIO ports table, shall not be modified by the user*/
+} HAL_GPIO_Capture_t;
+
+/**
+ * @struct: HAL_GPIO_Debouncer_t
+ * @brief: holds the debouncing state of up to 16 pins of one port, it's filled by HAL_GPIO_DebounceInit() and shall not be modified by the user.
+ */
+typedef struct
+{
+    uint16_t PinsMask;      /**< pins that are debounced*/
+    uint16_t ActiveLowPins; /**< pins that are pressed when their level is low*/
+    uint16_t State;         /**< debounced state of the pins, bit is set when the pin is pressed*/
+    uint16_t CounterBit0;   /**< bit 0 of the 2-bit vertical counter of every pin*/
+    uint16_t CounterBit1;   /**< bit 1 of the 2-bit vertical counter of every pin*/
+    uint8_t PortIndex;      /**< index of the port in GPIO ports table*/
+} HAL_GPIO_Debouncer_t;
+
+/**
+ * @struct: HAL_GPIO_PinChange_t
+ * @brief: holds one change of a batch passed to HAL_GPIO_PortReconfigure(), all the pins in the mask take the same configuration.
+ */
+typedef struct
+{
+    uint16_t Pins;             /**< pins to be reconfigured, for possible values refer to @HAL_GPIO_Pins_t in "GPIO_header.h"*/
+    uint8_t Mode;              /**< for possible values refer to @HAL_GPIO_PinMode_t in "GPIO_config.h"*/
+    uint8_t OutputType;        /**< for possible values refer to @HAL_GPIO_OutputType_t in "GPIO_config.h"*/
+    uint8_t OutputSpeed;       /**< for possible values refer to @HAL_GPIO_OutputSpeed_t in "GPIO_config.h"*/
+    uint8_t PullUpDown;        /**< for possible values refer to @HAL_GPIO_PullUpDown_t in "GPIO_config.h"*/
+    uint8_t AlternateFunction; /**< for possible values refer to @HAL_GPIOx_AlternateFunctions_t in "GPIO_config.h", only used when Mode is alternate function*/
+} HAL_GPIO_PinChange_t;
+
+/**
+ * @struct: HAL_GPIO_Keypad_t
+ * @brief: holds a keypad (switch matrix) scanned by DMA, the first group of members is filled by the user and the rest is used by the implementation code.
+ */
+typedef struct
+{
+    uint16_t RowsPort;    /**< for possible values refer to @HAL_GPIO_Ports_t in "GPIO_header.h", port of the row pins*/
+    uint16_t RowsPins;    /**< row pins (up to @HAL_GPIO_KEYPAD_MAX_ROWS), row n is the n-th lowest pin in the mask*/
+    uint16_t ColumnsPort; /**< for possible values refer to @HAL_GPIO_Ports_t in "GPIO_header.h", port of the column pins*/
+    uint16_t ColumnsPins; /**< column pins*/
+    uint8_t Trigger;      /**< for possible values refer to @HAL_GPIO_WaveformTriggers_t in "GPIO_header.h", used to select the timer that paces the scanning*/
+
+    uint8_t RowsCount;                                  /**< number of rows, shall not be modified by the user*/
+    uint32_t RowsStrobes[HAL_GPIO_KEYPAD_MAX_ROWS];     /**< BSRR words written on the update events, entry n selects row (n + 1) and the last one selects row 0, shall not be modified by the user*/
+    uint16_t ColumnsSamples[HAL_GPIO_KEYPAD_MAX_ROWS];  /**< columns port sampled while every row is selected, shall not be modified by the user*/
+    uint16_t KeysState[HAL_GPIO_KEYPAD_MAX_ROWS];       /**< pressed columns of every row as reported by the last events, shall not be modified by the user*/
+    uint16_t RowsClaimedPins;                           /**< row pins claimed by HAL_GPIO_KeypadStart() (refer to HAL_GPIO_PinsAttach()), shall not be modified by the user*/
+    uint16_t ColumnsClaimedPins;                        /**< column pins claimed by HAL_GPIO_KeypadStart() (refer to HAL_GPIO_PinsAttach()), shall not be modified by the user*/
+} HAL_GPIO_Keypad_t;
+
+/**
+ * @struct: HAL_GPIO_KeyEvent_t
+ * @brief: holds one key event reported by HAL_GPIO_KeypadProcess().
+ */
+typedef struct
+{
+    uint8_t Key;   /**< code of the key, (row number << 4) | column pin number*/
+    uint8_t State; /**< for possible values refer to @LIB_CONSTANTS_LogicalStates_t in "constants.h", HIGH when the key is pressed and LOW when it's released*/
+} HAL_GPIO_KeyEvent_t;
+
 /******************************************************************************
  * Variables
  *******************************************************************************/
@@ -152,8 +557,9 @@ typedef enum
  *  @param                          :       None
  *  @note                           :       This shall be the first function to be called before using any other function in this interface, also it's a blocking function
  *                                          IT IS ADVISED TO CALL HAL_GPIO_Init() BEFORE CALLING ANY OTHER FUNCTION
- *  \b PRE-CONDITION                :       make sure to edit all configurations in file "GPIO_config.h" (any array labeled with @user_todo shall be edited)
- *  \b POST-CONDITION               :       it configures the GPIO pins regarding mode, speed, alternate functions, etc...
+ *  \b PRE-CONDITION                :       make sure to edit all configurations in file "GPIO_config.h" (any configuration labeled with @user_todo shall be edited)
+ *  \b POST-CONDITION               :       it configures the GPIO pins regarding mode, speed, alternate functions, etc... using registers values computed at compile time and marks the configured pins as owned (refer to HAL_GPIO_PinsClaim())
+ *                                          so that every register of a used port is written only once, ports with no used pins are skipped.
  *  @return                         :       it return one of error states indicating whether a failure or success happened during initialization (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
  *  @see                            :       HAL_GPIO_PinStateModify(uint16_t arg_u16GpioName, uint16_t arg_u16PinNumber, const uint8_t argConst_u8Operation)
  *  @see                            :       HAL_GPIO_PinStateRead(uint16_t arg_u16GpioName, uint16_t arg_u16PinNumber, uint8_t *const arg_constpu8State)
@@ -186,7 +592,7 @@ HAL_GPIO_ErrStates_t HAL_GPIO_Init();
  *  @param  arg_u16GpioName [IN]                :       this is input parameter and for possible values refer to @HAL_GPIO_Ports_t in "GPIO_header.h", this is input parameter which indicates which port to deal with..
  *  @param  arg_u16PinNumber [IN]               :       this is input parameter and for possible values refer to @HAL_GPIO_Pins_t in "GPIO_header.h", this is input parameter which indicates which pin to deal with.
  *  @param  argConst_u8Operation [IN]           :       this is input parameter and for possible values refer to @HAL_GPIO_PinsOperation_t in "GPIO_header.h", this is input parameter which indicates which operation to perform on the selected pins on the specified ports.
- *  @note                                       :       None.
+ *  @note                                       :       toggle operation is done with one read of ODR and one store to BSRR so that other pins of the port are never written back.
  *  \b PRE-CONDITION                            :       make sure to call HAL_GPIO_Init().
  *  \b POST-CONDITION                           :       MCU pins status changes according to the desired operation.
  *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
@@ -222,7 +628,7 @@ HAL_GPIO_ErrStates_t HAL_GPIO_PinStateModify(uint16_t arg_u16GpioName, uint16_t
  *  @param  arg_u16GpioName [IN]                :       this is input parameter and for possible values refer to @HAL_GPIO_Ports_t in "GPIO_header.h", this is input parameter which indicates which port to deal with..
  *  @param  arg_u16PinNumber [IN]               :       this is input parameter and for possible values refer to @HAL_GPIO_Pins_t in "GPIO_header.h", this is input parameter which indicates which pin to deal with.
  *  @param  arg_constpu8State [OUT]             :       this is output parameter which indicates which holds the address of the variable to which it will write the state of the pin, for possible states refer to @LIB_CONSTANTS_LogicalStates_t in "constants.h".
- *  @note                                       :       None.
+ *  @note                                       :       to sample several pins at the same time use HAL_GPIO_PortsSnapshot() or HAL_GPIO_BusRead().
  *  \b PRE-CONDITION                            :       make sure to call HAL_GPIO_Init().
  *  \b POST-CONDITION                           :       None.
  *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
@@ -253,5 +659,872 @@ HAL_GPIO_ErrStates_t HAL_GPIO_PinStateModify(uint16_t arg_u16GpioName, uint16_t
  */
 HAL_GPIO_ErrStates_t HAL_GPIO_PinStateRead(uint16_t arg_u16GpioName, uint16_t arg_u16PinNumber, uint8_t *const arg_constpu8State);
 
+/**
+ *  \b function                                 :       HAL_GPIO_PortWrite(uint16_t arg_u16GpioName, const uint16_t argConst_u16SetPins, const uint16_t argConst_u16ResetPins)
+ *  \b Description                              :       this functions is used to drive some pins high and others low on the same port using only one store to BSRR register.
+ *  @param  arg_u16GpioName [IN]                :       this is input parameter and for possible values refer to @HAL_GPIO_Ports_t in "GPIO_header.h", this is input parameter which indicates which port(s) to deal with.
+ *  @param  argConst_u16SetPins [IN]            :       this is input parameter and for possible values refer to @HAL_GPIO_Pins_t in "GPIO_header.h", this is input parameter which indicates which pins to drive high.
+ *  @param  argConst_u16ResetPins [IN]          :       this is input parameter and for possible values refer to @HAL_GPIO_Pins_t in "GPIO_header.h", this is input parameter which indicates which pins to drive low.
+ *  @note                                       :       all pins of the same port change at the same bus cycle which makes it suitable for bit-parallel buses,
+ *                                                  pins that are neither in set mask nor in reset mask keep their state, a pin can't be in both masks at the same time.
+ *  \b PRE-CONDITION                            :       make sure to call HAL_GPIO_Init().
+ *  \b POST-CONDITION                           :       MCU pins status changes according to the desired masks.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
+ *  @see                                        :       HAL_GPIO_Init()
+ *  @see                                        :       HAL_GPIO_PortToggle(uint16_t arg_u16GpioName, const uint16_t argConst_u16PinsMask)
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * int main() {
+ *  HAL_GPIO_Init();    // make sure that you edited any array in "GPIO_config.h" labeled with @user_todo so that GPIO can be initialized correctly
+ *  uint8_t data = 0xA5;
+ *  HAL_GPIO_ErrStates_t local_errState_t = HAL_GPIO_PortWrite(HAL_GPIO_PORTE, data, (uint8_t)~data);
+ *  if (local_errState_t == HAL_GPIO_OK)
+ *  {
+ *      // pins 0 to 7 on port E hold the value of data and pins 8 to 15 are untouched
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_PortWrite(uint16_t arg_u16GpioName, const uint16_t argConst_u16SetPins, const uint16_t argConst_u16ResetPins);
+
+/**
+ *  \b function                                 :       HAL_GPIO_PortToggle(uint16_t arg_u16GpioName, const uint16_t argConst_u16PinsMask)
+ *  \b Description                              :       this functions is used to toggle a set of pins using one snapshot of ODR register and one store to BSRR register.
+ *  @param  arg_u16GpioName [IN]                :       this is input parameter and for possible values refer to @HAL_GPIO_Ports_t in "GPIO_header.h", this is input parameter which indicates which port(s) to deal with.
+ *  @param  argConst_u16PinsMask [IN]           :       this is input parameter and for possible values refer to @HAL_GPIO_Pins_t in "GPIO_header.h", this is input parameter which indicates which pins to toggle.
+ *  @note                                       :       unlike "ODR ^= mask" the pins outside the mask are never written back so an ISR that modifies other pins of the same port
+ *                                                  between the read and the write won't lose its update.
+ *  \b PRE-CONDITION                            :       make sure to call HAL_GPIO_Init().
+ *  \b POST-CONDITION                           :       the selected pins are inverted.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
+ *  @see                                        :       HAL_GPIO_Init()
+ *  @see                                        :       HAL_GPIO_PortWrite(uint16_t arg_u16GpioName, const uint16_t argConst_u16SetPins, const uint16_t argConst_u16ResetPins)
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * int main() {
+ *  HAL_GPIO_Init();    // make sure that you edited any array in "GPIO_config.h" labeled with @user_todo so that GPIO can be initialized correctly
+ *  HAL_GPIO_ErrStates_t local_errState_t = HAL_GPIO_PortToggle(HAL_GPIO_PORTD, HAL_GPIO_PIN12 | HAL_GPIO_PIN13);
+ *  if (local_errState_t == HAL_GPIO_OK)
+ *  {
+ *      // pins 12 and 13 on port D are inverted
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_PortToggle(uint16_t arg_u16GpioName, const uint16_t argConst_u16PinsMask);
+
+/**
+ *  \b function                                 :       HAL_GPIO_PortsSnapshot(uint16_t arg_u16GpioNames, const uint16_t *const argConst_pu16PinsMasks, uint16_t *const arg_constpu16Values)
+ *  \b Description                              :       this functions is used to sample the input data registers of several ports back-to-back so that all the samples are
+ *                                                  taken within few bus cycles of each other and returns masked port words.
+ *  @param  arg_u16GpioNames [IN]               :       this is input parameter and for possible values refer to @HAL_GPIO_Ports_t in "GPIO_header.h", this is input parameter which indicates which ports to sample.
+ *  @param  argConst_pu16PinsMasks [IN]         :       this is input parameter which holds the pins mask of every selected port in ascending order of ports (PORTA first), for possible values refer to @HAL_GPIO_Pins_t in "GPIO_header.h".
+ *  @param  arg_constpu16Values [OUT]           :       this is output parameter which will hold the masked input word of every selected port in the same order of argConst_pu16PinsMasks.
+ *  @note                                       :       the ports are resolved before sampling so the loop that samples the ports is only loads,
+ *                                                  both arrays must have at least as many entries as the selected ports.
+ *  \b PRE-CONDITION                            :       make sure to call HAL_GPIO_Init().
+ *  \b POST-CONDITION                           :       None.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
+ *  @see                                        :       HAL_GPIO_BusRead(uint16_t arg_u16GpioName, const uint16_t argConst_u16BusPins, uint16_t *const arg_constpu16Value)
+ *  @see                                        :       HAL_GPIO_PinStateRead(uint16_t arg_u16GpioName, uint16_t arg_u16PinNumber, uint8_t *const arg_constpu8State)
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * int main() {
+ *  HAL_GPIO_Init();    // make sure that you edited any array in "GPIO_config.h" labeled with @user_todo so that GPIO can be initialized correctly
+ *  uint16_t masks[2] = {HAL_GPIO_PIN0 | HAL_GPIO_PIN1, 0xFF00};
+ *  uint16_t values[2];
+ *  HAL_GPIO_ErrStates_t local_errState_t = HAL_GPIO_PortsSnapshot(HAL_GPIO_PORTA | HAL_GPIO_PORTE, masks, values);
+ *  if (local_errState_t == HAL_GPIO_OK)
+ *  {
+ *      // values[0] holds PA0, PA1 and values[1] holds PE8 - PE15 sampled at the same time
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_PortsSnapshot(uint16_t arg_u16GpioNames, const uint16_t *const argConst_pu16PinsMasks, uint16_t *const arg_constpu16Values);
+
+/**
+ *  \b function                                 :       HAL_GPIO_BusRead(uint16_t arg_u16GpioName, const uint16_t argConst_u16BusPins, uint16_t *const arg_constpu16Value)
+ *  \b Description                              :       this functions is used to read a group of contiguous pins of one port (8-bit or 16-bit bus for example) in one sample.
+ *  @param  arg_u16GpioName [IN]                :       this is input parameter and for possible values refer to @HAL_GPIO_Ports_t in "GPIO_header.h", only one port shall be given.
+ *  @param  argConst_u16BusPins [IN]            :       this is input parameter which holds the contiguous pins of the bus, for possible values refer to @HAL_GPIO_Pins_t in "GPIO_header.h".
+ *  @param  arg_constpu16Value [OUT]            :       this is output parameter which will hold the value of the bus right aligned (lowest pin of the bus is bit 0).
+ *  @note                                       :       when the port and pins are known at compile time use HAL_GPIO_FAST_BUS_READ() instead.
+ *  \b PRE-CONDITION                            :       make sure to call HAL_GPIO_Init().
+ *  \b POST-CONDITION                           :       None.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
+ *  @see                                        :       HAL_GPIO_PortsSnapshot(uint16_t arg_u16GpioNames, const uint16_t *const argConst_pu16PinsMasks, uint16_t *const arg_constpu16Values)
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * int main() {
+ *  HAL_GPIO_Init();    // make sure that you edited any array in "GPIO_config.h" labeled with @user_todo so that GPIO can be initialized correctly
+ *  uint16_t data = 0;
+ *  HAL_GPIO_ErrStates_t local_errState_t = HAL_GPIO_BusRead(HAL_GPIO_PORTD, 0x0FF0, &data);
+ *  if (local_errState_t == HAL_GPIO_OK)
+ *  {
+ *      // data holds PD4 - PD11 where PD4 is bit 0
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_BusRead(uint16_t arg_u16GpioName, const uint16_t argConst_u16BusPins, uint16_t *const arg_constpu16Value);
+
+/**
+ *  \b function                                 :       HAL_GPIO_WaveformEncode(const uint16_t argConst_u16PinsMask, const uint16_t *const argConst_pu16Samples, const uint16_t argConst_u16SamplesCount, uint32_t *const arg_constpu32BSRRWords)
+ *  \b Description                              :       this functions is used to turn a sequence of parallel port samples into GPIOx_BSRR words that set and reset exactly the given pins.
+ *  @param  argConst_u16PinsMask [IN]           :       this is input parameter which holds the pins driven by the waveform, for possible values refer to @HAL_GPIO_Pins_t in "GPIO_header.h".
+ *  @param  argConst_pu16Samples [IN]           :       this is input parameter which holds the levels of the pins at every step (bit n is the level of pin n).
+ *  @param  argConst_u16SamplesCount [IN]       :       this is input parameter which holds the number of samples.
+ *  @param  arg_constpu32BSRRWords [OUT]        :       this is output parameter which will hold one BSRR word for every sample.
+ *  @note                                       :       pins outside the mask are never touched by the generated words, used for parallel buses and stepper pulse trains.
+ *  \b PRE-CONDITION                            :       None.
+ *  \b POST-CONDITION                           :       None.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
+ *  @see                                        :       HAL_GPIO_WaveformStart(uint16_t arg_u16GpioName, const uint32_t *const argConst_pu32BSRRWords, const uint16_t argConst_u16WordsCount, const uint8_t argConst_u8Trigger, const uint8_t argConst_u8CircularMode)
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * int main() {
+ *  // step and direction pins of a stepper on PE0 (STEP) and PE1 (DIR)
+ *  uint16_t local_arru16Samples[4] = {0x3, 0x2, 0x3, 0x2};
+ *  uint32_t local_arru32Words[4];
+ *  HAL_GPIO_ErrStates_t local_errState_t = HAL_GPIO_WaveformEncode(HAL_GPIO_PIN0 | HAL_GPIO_PIN1, local_arru16Samples, 4, local_arru32Words);
+ *  if (local_errState_t != HAL_GPIO_OK)
+ *  {
+ *      // if the function returned thus means it failed.
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_WaveformEncode(const uint16_t argConst_u16PinsMask, const uint16_t *const argConst_pu16Samples, const uint16_t argConst_u16SamplesCount, uint32_t *const arg_constpu32BSRRWords);
+
+/**
+ *  \b function                                 :       HAL_GPIO_WaveformEncodeBits(const uint16_t argConst_u16PinsMask, const uint8_t *const argConst_pu8Bits, const uint16_t argConst_u16BitsCount, const HAL_GPIO_WaveformSymbols_t *const argConst_pSymbols, uint32_t *const arg_constpu32BSRRWords)
+ *  \b Description                              :       this functions is used to turn a bit stream into GPIOx_BSRR words where every bit is drawn as a fixed number of slots (pulse width coding).
+ *  @param  argConst_u16PinsMask [IN]           :       this is input parameter which holds the pins driven by the waveform, for possible values refer to @HAL_GPIO_Pins_t in "GPIO_header.h".
+ *  @param  argConst_pu8Bits [IN]               :       this is input parameter which holds the bits to be sent, MSB of every byte is sent first.
+ *  @param  argConst_u16BitsCount [IN]          :       this is input parameter which holds the number of bits to be sent.
+ *  @param  argConst_pSymbols [IN]              :       this is input parameter which holds how a '0' and a '1' are drawn (refer to @HAL_GPIO_WaveformSymbols_t in "GPIO_header.h").
+ *  @param  arg_constpu32BSRRWords [OUT]        :       this is output parameter which will hold (argConst_u16BitsCount * SlotsPerBit) BSRR words.
+ *  @note                                       :       for WS2812 at 800 kHz use 3 slots (2.4 MHz update rate) with Symbol0 = 0x1 (high, low, low) and Symbol1 = 0x3 (high, high, low).
+ *  \b PRE-CONDITION                            :       None.
+ *  \b POST-CONDITION                           :       None.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
+ *  @see                                        :       HAL_GPIO_WaveformStart(uint16_t arg_u16GpioName, const uint32_t *const argConst_pu32BSRRWords, const uint16_t argConst_u16WordsCount, const uint8_t argConst_u8Trigger, const uint8_t argConst_u8CircularMode)
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * int main() {
+ *  const HAL_GPIO_WaveformSymbols_t local_ws2812_t = {.SlotsPerBit = 3, .Symbol0 = 0x1, .Symbol1 = 0x3};
+ *  uint8_t local_arru8Pixel[3] = {0xFF, 0x00, 0x80}; // G, R, B
+ *  uint32_t local_arru32Words[24 * 3];
+ *  HAL_GPIO_ErrStates_t local_errState_t = HAL_GPIO_WaveformEncodeBits(HAL_GPIO_PIN5, local_arru8Pixel, 24, &local_ws2812_t, local_arru32Words);
+ *  if (local_errState_t != HAL_GPIO_OK)
+ *  {
+ *      // if the function returned thus means it failed.
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_WaveformEncodeBits(const uint16_t argConst_u16PinsMask, const uint8_t *const argConst_pu8Bits, const uint16_t argConst_u16BitsCount, const HAL_GPIO_WaveformSymbols_t *const argConst_pSymbols, uint32_t *const arg_constpu32BSRRWords);
+
+/**
+ *  \b function                                 :       HAL_GPIO_WaveformStart(uint16_t arg_u16GpioName, const uint32_t *const argConst_pu32BSRRWords, const uint16_t argConst_u16WordsCount, const uint8_t argConst_u8Trigger, const uint8_t argConst_u8CircularMode)
+ *  \b Description                              :       this functions is used to clock BSRR words out to a port by DMA2, one word on every update event of the selected timer.
+ *  @param  arg_u16GpioName [IN]                :       this is input parameter and for possible values refer to @HAL_GPIO_Ports_t in "GPIO_header.h", only one port shall be given.
+ *  @param  argConst_pu32BSRRWords [IN]         :       this is input parameter which holds the words created by HAL_GPIO_WaveformEncode() or HAL_GPIO_WaveformEncodeBits(), the buffer must stay valid until the waveform ends.
+ *  @param  argConst_u16WordsCount [IN]         :       this is input parameter which holds the number of words (1 up to 65535).
+ *  @param  argConst_u8Trigger [IN]             :       this is input parameter and for possible values refer to @HAL_GPIO_WaveformTriggers_t in "GPIO_header.h", used to select the timer that paces the waveform.
+ *  @param  argConst_u8CircularMode [IN]        :       this is input parameter and for possible values refer to @LIB_CONSTANTS_DriverStates_t in "constants.h", used to repeat the waveform until HAL_GPIO_WaveformStop() is called.
+ *  @note                                       :       the CPU isn't involved per word, the timing of every edge is exact to the timer update period.
+ *                                                  the pins set or reset by any word are attached to the waveform (refer to HAL_GPIO_PinsAttach()) till HAL_GPIO_WaveformStop() is called,
+ *                                                  @HAL_GPIO_ERR_PINS_CLAIMED is returned if one of them is claimed by another driver.
+ *  \b PRE-CONDITION                            :       the pins are configured as outputs, DMA2 clock is enabled and the timer is running at the slot rate with its update DMA request (UDE) enabled.
+ *  \b POST-CONDITION                           :       the waveform is being sent.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
+ *  @see                                        :       HAL_GPIO_WaveformStop(const uint8_t argConst_u8Trigger)
+ *  @see                                        :       HAL_GPIO_WaveformGetRemaining(const uint8_t argConst_u8Trigger, uint16_t *const arg_constpu16Remaining)
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * uint32_t global_arru32Words[24 * 3];
+ * int main() {
+ *  HAL_GPIO_Init();    // make sure that you edited any array in "GPIO_config.h" labeled with @user_todo so that GPIO can be initialized correctly
+ *  // fill global_arru32Words by HAL_GPIO_WaveformEncodeBits() then start the timer
+ *  HAL_GPIO_ErrStates_t local_errState_t = HAL_GPIO_WaveformStart(HAL_GPIO_PORTB, global_arru32Words, 24 * 3, HAL_GPIO_WAVEFORM_TRIG_TIM1_UP, LIB_CONSTANTS_DISABLED);
+ *  if (local_errState_t != HAL_GPIO_OK)
+ *  {
+ *      // if the function returned thus means it failed.
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.1            </td><td> AMS      </td><td> driven pins are claimed </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_WaveformStart(uint16_t arg_u16GpioName, const uint32_t *const argConst_pu32BSRRWords, const uint16_t argConst_u16WordsCount, const uint8_t argConst_u8Trigger, const uint8_t argConst_u8CircularMode);
+
+/**
+ *  \b function                                 :       HAL_GPIO_WaveformStop(const uint8_t argConst_u8Trigger)
+ *  \b Description                              :       this functions is used to stop the waveform paced by the given trigger.
+ *  @param  argConst_u8Trigger [IN]             :       this is input parameter and for possible values refer to @HAL_GPIO_WaveformTriggers_t in "GPIO_header.h".
+ *  @note                                       :       the pins keep the levels of the last word sent, the pins claimed by HAL_GPIO_WaveformStart() are released.
+ *  \b PRE-CONDITION                            :       None.
+ *  \b POST-CONDITION                           :       the DMA2 stream of the trigger is disabled.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
+ *  @see                                        :       HAL_GPIO_WaveformStart(uint16_t arg_u16GpioName, const uint32_t *const argConst_pu32BSRRWords, const uint16_t argConst_u16WordsCount, const uint8_t argConst_u8Trigger, const uint8_t argConst_u8CircularMode)
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * int main() {
+ *  HAL_GPIO_ErrStates_t local_errState_t = HAL_GPIO_WaveformStop(HAL_GPIO_WAVEFORM_TRIG_TIM1_UP);
+ *  if (local_errState_t != HAL_GPIO_OK)
+ *  {
+ *      // if the function returned thus means it failed.
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.1            </td><td> AMS      </td><td> claimed pins are released </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_WaveformStop(const uint8_t argConst_u8Trigger);
+
+/**
+ *  \b function                                 :       HAL_GPIO_WaveformGetRemaining(const uint8_t argConst_u8Trigger, uint16_t *const arg_constpu16Remaining)
+ *  \b Description                              :       this functions is used to read how many words of the waveform are still to be sent.
+ *  @param  argConst_u8Trigger [IN]             :       this is input parameter and for possible values refer to @HAL_GPIO_WaveformTriggers_t in "GPIO_header.h".
+ *  @param  arg_constpu16Remaining [OUT]        :       this is output parameter which will hold the number of words not sent yet, 0 means the waveform has ended.
+ *  @note                                       :       in circular mode the value never reaches 0.
+ *  \b PRE-CONDITION                            :       HAL_GPIO_WaveformStart() is called.
+ *  \b POST-CONDITION                           :       None.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
+ *  @see                                        :       HAL_GPIO_WaveformStart(uint16_t arg_u16GpioName, const uint32_t *const argConst_pu32BSRRWords, const uint16_t argConst_u16WordsCount, const uint8_t argConst_u8Trigger, const uint8_t argConst_u8CircularMode)
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * int main() {
+ *  uint16_t local_u16Remaining = 0;
+ *  do
+ *  {
+ *      HAL_GPIO_WaveformGetRemaining(HAL_GPIO_WAVEFORM_TRIG_TIM1_UP, &local_u16Remaining);
+ *  } while (local_u16Remaining != 0);
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_WaveformGetRemaining(const uint8_t argConst_u8Trigger, uint16_t *const arg_constpu16Remaining);
+
+/**
+ *  \b function                                 :       HAL_GPIO_CaptureStart(uint16_t arg_u16GpioName, HAL_GPIO_Capture_t *const arg_constpCapture)
+ *  \b Description                              :       this functions is used to start recording GPIOx_IDR of a port into a ring buffer by DMA2 at the update rate of the selected timer.
+ *  @param  arg_u16GpioName [IN]                :       this is input parameter and for possible values refer to @HAL_GPIO_Ports_t in "GPIO_header.h", only one port shall be given.
+ *  @param  arg_constpCapture [IN/OUT]          :       this is input/output parameter which holds the capture (refer to @HAL_GPIO_Capture_t in "GPIO_header.h").
+ *  @note                                       :       the capture uses the same DMA2 stream of the waveform engine for the same trigger so both can't run on one trigger at the same time,
+ *                                                  the trigger is only accepted after (BufferSize - PostTriggerSamples) samples are recorded so that the pre trigger history is always complete.
+ *                                                  PinsMask and PatternMask pins are attached to the capture (refer to HAL_GPIO_PinsAttach()) till it's done or overrun.
+ *  \b PRE-CONDITION                            :       DMA2 clock is enabled and the timer is running at the sampling rate with its update DMA request (UDE) enabled.
+ *  \b POST-CONDITION                           :       the capture is armed.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
+ *  @see                                        :       HAL_GPIO_CaptureProcess(HAL_GPIO_Capture_t *const arg_constpCapture, uint8_t *const arg_constpu8State)
+ *  @see                                        :       HAL_GPIO_CaptureUnroll(const HAL_GPIO_Capture_t *const argConst_pCapture, uint16_t *const arg_constpu16Samples, uint16_t *const arg_constpu16SamplesCount, uint16_t *const arg_constpu16TriggerPos)
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * uint16_t global_arru16Samples[1024];
+ * HAL_GPIO_Capture_t global_capture_t = {
+ *  .Buffer = global_arru16Samples, .BufferSize = 1024, .PatternMask = HAL_GPIO_PIN3, .PatternValue = 0,
+ *  .PostTriggerSamples = 256, .Trigger = HAL_GPIO_WAVEFORM_TRIG_TIM8_UP};
+ * int main() {
+ *  HAL_GPIO_ErrStates_t local_errState_t = HAL_GPIO_CaptureStart(HAL_GPIO_PORTD, &global_capture_t);
+ *  if (local_errState_t != HAL_GPIO_OK)
+ *  {
+ *      // if the function returned thus means it failed.
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.1            </td><td> AMS      </td><td> sampled pins are claimed </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_CaptureStart(uint16_t arg_u16GpioName, HAL_GPIO_Capture_t *const arg_constpCapture);
+
+/**
+ *  \b function                                 :       HAL_GPIO_CaptureProcess(HAL_GPIO_Capture_t *const arg_constpCapture, uint8_t *const arg_constpu8State)
+ *  \b Description                              :       this functions is used to search the newly recorded samples for the trigger pattern and to stop the capture once the post trigger samples are recorded.
+ *  @param  arg_constpCapture [IN/OUT]          :       this is input/output parameter which holds the capture started by HAL_GPIO_CaptureStart().
+ *  @param  arg_constpu8State [OUT]             :       this is output parameter which will hold the state of the capture, for possible values refer to @HAL_GPIO_CaptureStates_t in "GPIO_header.h".
+ *  @note                                       :       it must be called at least once every (BufferSize / 2) sampling periods in both armed and triggered states (from the main loop or DMA half/full transfer interrupts),
+ *                                                  the half transfer and transfer complete flags of the stream are used to detect a longer lag, in that case the capture is stopped,
+ *                                                  the state goes back to @HAL_GPIO_CAPTURE_IDLE and @HAL_GPIO_ERR_CAPTURE_OVERRUN is returned.
+ *                                                  the DMA keeps recording while the function is not called so the post trigger part can be longer than requested by the lag, that's taken
+ *                                                  from the pre trigger history and if it reaches the trigger sample itself the capture is reported as overrun too.
+ *                                                  the pins claimed by HAL_GPIO_CaptureStart() are released once the capture is done or overrun.
+ *  \b PRE-CONDITION                            :       HAL_GPIO_CaptureStart() is called.
+ *  \b POST-CONDITION                           :       the half transfer and transfer complete flags of the stream are cleared.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
+ *  @see                                        :       HAL_GPIO_CaptureStart(uint16_t arg_u16GpioName, HAL_GPIO_Capture_t *const arg_constpCapture)
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * extern HAL_GPIO_Capture_t global_capture_t;
+ * int main() {
+ *  uint8_t local_u8State = HAL_GPIO_CAPTURE_ARMED;
+ *  while (local_u8State != HAL_GPIO_CAPTURE_DONE)
+ *  {
+ *      HAL_GPIO_CaptureProcess(&global_capture_t, &local_u8State);
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.1            </td><td> AMS      </td><td> overrun detection </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.2            </td><td> AMS      </td><td> claimed pins are released when the capture stops </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_CaptureProcess(HAL_GPIO_Capture_t *const arg_constpCapture, uint8_t *const arg_constpu8State);
+
+/**
+ *  \b function                                 :       HAL_GPIO_CaptureUnroll(const HAL_GPIO_Capture_t *const argConst_pCapture, uint16_t *const arg_constpu16Samples, uint16_t *const arg_constpu16SamplesCount, uint16_t *const arg_constpu16TriggerPos)
+ *  \b Description                              :       this functions is used to decode the ring buffer of a finished capture into a linear record ordered from the oldest sample to the newest one.
+ *  @param  argConst_pCapture [IN]              :       this is input parameter which holds a capture in @HAL_GPIO_CAPTURE_DONE state.
+ *  @param  arg_constpu16Samples [OUT]          :       this is output parameter which will hold the samples in time order, it must hold BufferSize samples and must not be the ring buffer itself.
+ *  @param  arg_constpu16SamplesCount [OUT]     :       this is output parameter which will hold the number of valid samples.
+ *  @param  arg_constpu16TriggerPos [OUT]       :       this is output parameter which will hold the index of the sample that fired the trigger inside arg_constpu16Samples.
+ *  @note                                       :       format of the record: sample n is GPIOx_IDR (bit m is the level of pin m) taken n sampling periods after the first one,
+ *                                                  samples before the trigger position are the pre trigger history.
+ *  \b PRE-CONDITION                            :       HAL_GPIO_CaptureProcess() returned @HAL_GPIO_CAPTURE_DONE.
+ *  \b POST-CONDITION                           :       None.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
+ *  @see                                        :       HAL_GPIO_CaptureProcess(HAL_GPIO_Capture_t *const arg_constpCapture, uint8_t *const arg_constpu8State)
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * extern HAL_GPIO_Capture_t global_capture_t;
+ * uint16_t global_arru16Record[1024];
+ * int main() {
+ *  uint16_t local_u16Count = 0, local_u16TriggerPos = 0;
+ *  HAL_GPIO_ErrStates_t local_errState_t = HAL_GPIO_CaptureUnroll(&global_capture_t, global_arru16Record, &local_u16Count, &local_u16TriggerPos);
+ *  if (local_errState_t != HAL_GPIO_OK)
+ *  {
+ *      // if the function returned thus means it failed.
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_CaptureUnroll(const HAL_GPIO_Capture_t *const argConst_pCapture, uint16_t *const arg_constpu16Samples, uint16_t *const arg_constpu16SamplesCount, uint16_t *const arg_constpu16TriggerPos);
+
+/**
+ *  \b function                                 :       HAL_GPIO_DebounceInit(uint16_t arg_u16GpioName, const uint16_t argConst_u16PinsMask, const uint16_t argConst_u16ActiveLowPins, HAL_GPIO_Debouncer_t *const arg_constpDebouncer)
+ *  \b Description                              :       this functions is used to prepare debouncing of a group of pins of one port, the current levels are taken as the initial debounced state.
+ *  @param  arg_u16GpioName [IN]                :       this is input parameter and for possible values refer to @HAL_GPIO_Ports_t in "GPIO_header.h", only one port shall be given.
+ *  @param  argConst_u16PinsMask [IN]           :       this is input parameter which holds the pins to be debounced, for possible values refer to @HAL_GPIO_Pins_t in "GPIO_header.h".
+ *  @param  argConst_u16ActiveLowPins [IN]      :       this is input parameter which holds the pins that are pressed when low (buttons with pull up resistors for example).
+ *  @param  arg_constpDebouncer [OUT]           :       this is output parameter which holds the debouncer to be prepared (refer to @HAL_GPIO_Debouncer_t in "GPIO_header.h").
+ *  @note                                       :       None.
+ *  \b PRE-CONDITION                            :       make sure to call HAL_GPIO_Init().
+ *  \b POST-CONDITION                           :       None.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
+ *  @see                                        :       HAL_GPIO_DebounceTick(HAL_GPIO_Debouncer_t *const arg_constpDebouncer, uint16_t *const arg_constpu16Pressed, uint16_t *const arg_constpu16Released)
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * HAL_GPIO_Debouncer_t global_buttons_t;
+ * int main() {
+ *  HAL_GPIO_Init();    // make sure that you edited any array in "GPIO_config.h" labeled with @user_todo so that GPIO can be initialized correctly
+ *  HAL_GPIO_ErrStates_t local_errState_t = HAL_GPIO_DebounceInit(HAL_GPIO_PORTC, 0x00FF, 0x00FF, &global_buttons_t);
+ *  if (local_errState_t != HAL_GPIO_OK)
+ *  {
+ *      // if the function returned thus means it failed.
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_DebounceInit(uint16_t arg_u16GpioName, const uint16_t argConst_u16PinsMask, const uint16_t argConst_u16ActiveLowPins, HAL_GPIO_Debouncer_t *const arg_constpDebouncer);
+
+/**
+ *  \b function                                 :       HAL_GPIO_DebounceTick(HAL_GPIO_Debouncer_t *const arg_constpDebouncer, uint16_t *const arg_constpu16Pressed, uint16_t *const arg_constpu16Released)
+ *  \b Description                              :       this functions is used to take one sample of the port and debounce all its pins at once using vertical counters.
+ *  @param  arg_constpDebouncer [IN/OUT]        :       this is input/output parameter which holds the debouncer prepared by HAL_GPIO_DebounceInit().
+ *  @param  arg_constpu16Pressed [OUT]          :       this is output parameter which will hold the pins that became pressed in this tick.
+ *  @param  arg_constpu16Released [OUT]         :       this is output parameter which will hold the pins that became released in this tick.
+ *  @note                                       :       a pin changes its debounced state only after it differs from it in 4 consecutive ticks (a 5 ms tick gives 20 ms debounce time),
+ *                                                  the cost is one load of GPIOx_IDR and few logical operations whatever the number of pins.
+ *  \b PRE-CONDITION                            :       HAL_GPIO_DebounceInit() is called.
+ *  \b POST-CONDITION                           :       None.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
+ *  @see                                        :       HAL_GPIO_DebounceInit(uint16_t arg_u16GpioName, const uint16_t argConst_u16PinsMask, const uint16_t argConst_u16ActiveLowPins, HAL_GPIO_Debouncer_t *const arg_constpDebouncer)
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * extern HAL_GPIO_Debouncer_t global_buttons_t;
+ * void SysTick_Handler(void) {
+ *  uint16_t local_u16Pressed = 0, local_u16Released = 0;
+ *  HAL_GPIO_DebounceTick(&global_buttons_t, &local_u16Pressed, &local_u16Released);
+ *  if (local_u16Pressed & HAL_GPIO_PIN0)
+ *  {
+ *      // button on PC0 is pressed
+ *  }
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_DebounceTick(HAL_GPIO_Debouncer_t *const arg_constpDebouncer, uint16_t *const arg_constpu16Pressed, uint16_t *const arg_constpu16Released);
+
+/**
+ *  \b function                                 :       HAL_GPIO_PortReconfigure(uint16_t arg_u16GpioName, const HAL_GPIO_PinChange_t *const argConst_pChanges, const uint8_t argConst_u8ChangesCount)
+ *  \b Description                              :       this functions is used to change the configuration of some pins of one port at run time (switching between alternate function and analog for example).
+ *  @param  arg_u16GpioName [IN]                :       this is input parameter and for possible values refer to @HAL_GPIO_Ports_t in "GPIO_header.h", only one port shall be given.
+ *  @param  argConst_pChanges [IN]              :       this is input parameter which holds the batch of changes (refer to @HAL_GPIO_PinChange_t in "GPIO_header.h").
+ *  @param  argConst_u8ChangesCount [IN]        :       this is input parameter which holds the number of changes in the batch.
+ *  @note                                       :       the whole batch is merged first so every configuration register is updated with one read-modify-write,
+ *                                                  the updates are done with interrupts disabled so an interrupt touching the same port can't be lost,
+ *                                                  pins going to input or analog get their mode first and pins going to output or alternate function get it last so no pin drives a wrong level in between,
+ *                                                  if any of the pins is locked by GPIOx_LCKR nothing is changed and @HAL_GPIO_ERR_PIN_LOCKED is returned.
+ *                                                  only owned pins (configured by HAL_GPIO_Init() or claimed by HAL_GPIO_PinsClaim()) can be reconfigured, otherwise nothing is changed and @HAL_GPIO_ERR_PINS_NOT_OWNED is returned.
+ *  \b PRE-CONDITION                            :       make sure to call HAL_GPIO_Init().
+ *  \b POST-CONDITION                           :       None.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
+ *  @see                                        :       HAL_GPIO_Init(void)
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * int main() {
+ *  HAL_GPIO_Init();    // make sure that you edited any array in "GPIO_config.h" labeled with @user_todo so that GPIO can be initialized correctly
+ *  // release SPI1 pins (PA5, PA6, PA7) to analog to save power
+ *  const HAL_GPIO_PinChange_t local_arrChanges_t[1] = {
+ *      {.Pins = HAL_GPIO_PIN5 | HAL_GPIO_PIN6 | HAL_GPIO_PIN7, .Mode = HAL_GPIO_PIN_MODE_ANALOG, .OutputType = HAL_GPIO_OUT_MODE_PUSH_PULL,
+ *       .OutputSpeed = HAL_GPIO_OUT_SPEED_LOW, .PullUpDown = HAL_GPIO_NO_PULL_UP_DOWN, .AlternateFunction = 0}};
+ *  HAL_GPIO_ErrStates_t local_errState_t = HAL_GPIO_PortReconfigure(HAL_GPIO_PORTA, local_arrChanges_t, 1);
+ *  if (local_errState_t != HAL_GPIO_OK)
+ *  {
+ *      // if the function returned thus means it failed.
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.1            </td><td> AMS      </td><td> pins that aren't owned are refused </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_PortReconfigure(uint16_t arg_u16GpioName, const HAL_GPIO_PinChange_t *const argConst_pChanges, const uint8_t argConst_u8ChangesCount);
+
+/**
+ *  \b function                                 :       HAL_GPIO_KeypadStart(HAL_GPIO_Keypad_t *const arg_constpKeypad)
+ *  \b Description                              :       this functions is used to start scanning a keypad without CPU: on every update event of the timer DMA2 selects the next row (driven low)
+ *                                                  through GPIOx_BSRR and on its channel 1 compare event another DMA2 stream samples the columns port into the keypad buffer.
+ *  @param  arg_constpKeypad [IN/OUT]           :       this is input/output parameter which holds the keypad (refer to @HAL_GPIO_Keypad_t in "GPIO_header.h").
+ *  @note                                       :       TIM1 uses DMA2 stream 5 for rows and stream 3 (TIM1_CH1) for columns, TIM8 uses DMA2 stream 1 for rows and stream 2 (TIM8_CH1) for columns,
+ *                                                  putting the compare value in the middle of the period gives the rows half a period to settle before the columns are sampled.
+ *                                                  the function selects row 0 itself so period n samples row n and the update event ending it selects row (n + 1),
+ *                                                  that needs the timer in up counting mode with no update event generated (UG) before it's started.
+ *                                                  row and column pins are attached to the keypad (refer to HAL_GPIO_PinsAttach()) till HAL_GPIO_KeypadStop() is called.
+ *  \b PRE-CONDITION                            :       rows are open drain outputs, columns are inputs with pull up resistors, DMA2 clock is enabled and the timer is configured
+ *                                                  with its update and channel 1 DMA requests (UDE, CC1DE) enabled but started only after this function returns.
+ *  \b POST-CONDITION                           :       the keypad is scanned continuously.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
+ *  @see                                        :       HAL_GPIO_KeypadProcess(HAL_GPIO_Keypad_t *const arg_constpKeypad, HAL_GPIO_KeyEvent_t *const arg_constpEvents, const uint8_t argConst_u8MaxEvents, uint8_t *const arg_constpu8EventsCount)
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * HAL_GPIO_Keypad_t global_keypad_t = {
+ *  .RowsPort = HAL_GPIO_PORTE, .RowsPins = 0x00FF, .ColumnsPort = HAL_GPIO_PORTE, .ColumnsPins = 0xFF00, .Trigger = HAL_GPIO_WAVEFORM_TRIG_TIM8_UP};
+ * int main() {
+ *  HAL_GPIO_Init();    // make sure that you edited any array in "GPIO_config.h" labeled with @user_todo so that GPIO can be initialized correctly
+ *  HAL_GPIO_ErrStates_t local_errState_t = HAL_GPIO_KeypadStart(&global_keypad_t);
+ *  if (local_errState_t != HAL_GPIO_OK)
+ *  {
+ *      // if the function returned thus means it failed.
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.1            </td><td> AMS      </td><td> row 0 is selected before the first sample </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.2            </td><td> AMS      </td><td> rows and columns pins are claimed </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_KeypadStart(HAL_GPIO_Keypad_t *const arg_constpKeypad);
+
+/**
+ *  \b function                                 :       HAL_GPIO_KeypadStop(HAL_GPIO_Keypad_t *const arg_constpKeypad)
+ *  \b Description                              :       this functions is used to stop scanning a keypad started by HAL_GPIO_KeypadStart().
+ *  @param  arg_constpKeypad [IN/OUT]           :       this is input/output parameter which holds the keypad started by HAL_GPIO_KeypadStart().
+ *  @note                                       :       both DMA2 streams of the trigger are disabled and the pins claimed by HAL_GPIO_KeypadStart() are released, the rows keep their last levels.
+ *  \b PRE-CONDITION                            :       HAL_GPIO_KeypadStart() is called.
+ *  \b POST-CONDITION                           :       the keypad isn't scanned anymore.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
+ *  @see                                        :       HAL_GPIO_KeypadStart(HAL_GPIO_Keypad_t *const arg_constpKeypad)
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * extern HAL_GPIO_Keypad_t global_keypad_t;
+ * int main() {
+ *  HAL_GPIO_ErrStates_t local_errState_t = HAL_GPIO_KeypadStop(&global_keypad_t);
+ *  if (local_errState_t != HAL_GPIO_OK)
+ *  {
+ *      // if the function returned thus means it failed.
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_KeypadStop(HAL_GPIO_Keypad_t *const arg_constpKeypad);
+
+/**
+ *  \b function                                 :       HAL_GPIO_KeypadProcess(HAL_GPIO_Keypad_t *const arg_constpKeypad, HAL_GPIO_KeyEvent_t *const arg_constpEvents, const uint8_t argConst_u8MaxEvents, uint8_t *const arg_constpu8EventsCount)
+ *  \b Description                              :       this functions is used to decode the columns samples collected by DMA into key press and release events.
+ *  @param  arg_constpKeypad [IN/OUT]           :       this is input/output parameter which holds the keypad started by HAL_GPIO_KeypadStart().
+ *  @param  arg_constpEvents [OUT]              :       this is output parameter which will hold the events (refer to @HAL_GPIO_KeyEvent_t in "GPIO_header.h").
+ *  @param  argConst_u8MaxEvents [IN]           :       this is input parameter which holds the number of events arg_constpEvents can hold.
+ *  @param  arg_constpu8EventsCount [OUT]       :       this is output parameter which will hold the number of reported events.
+ *  @note                                       :       changes that don't fit in the events buffer are reported by the next call,
+ *                                                  the cost depends on the number of rows and changed keys only as the changed columns are reached by counting trailing zeros.
+ *  \b PRE-CONDITION                            :       HAL_GPIO_KeypadStart() is called.
+ *  \b POST-CONDITION                           :       None.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
+ *  @see                                        :       HAL_GPIO_KeypadStart(HAL_GPIO_Keypad_t *const arg_constpKeypad)
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * extern HAL_GPIO_Keypad_t global_keypad_t;
+ * int main() {
+ *  HAL_GPIO_KeyEvent_t local_arrEvents_t[4];
+ *  uint8_t local_u8Count = 0;
+ *  while (1)
+ *  {
+ *      HAL_GPIO_KeypadProcess(&global_keypad_t, local_arrEvents_t, 4, &local_u8Count);
+ *      // handle local_u8Count events
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_KeypadProcess(HAL_GPIO_Keypad_t *const arg_constpKeypad, HAL_GPIO_KeyEvent_t *const arg_constpEvents, const uint8_t argConst_u8MaxEvents, uint8_t *const arg_constpu8EventsCount);
+
+/**
+ *  \b function                                 :       HAL_GPIO_PinsClaim(uint16_t arg_u16GpioName, const uint16_t argConst_u16PinsMask)
+ *  \b Description                              :       this functions is used by a driver to take the ownership of pins before configuring them (as alternate function for example),
+ *                                                  the claim succeeds only if none of the pins is owned already.
+ *  @param  arg_u16GpioName [IN]                :       this is input parameter and for possible values refer to @HAL_GPIO_Ports_t in "GPIO_header.h", used to select port (one port only).
+ *  @param  argConst_u16PinsMask [IN]           :       this is input parameter and for possible values refer to @HAL_GPIO_Pins_t in "GPIO_header.h", pins to be claimed.
+ *  @note                                       :       every port has one 16-bit ownership bitmap so the conflict check is one mask test, all or none of the pins are claimed,
+ *                                                  pins configured by HAL_GPIO_Init() are owned after initialization and the debug pins (PA13, PA14, PA15, PB3 and PB4) are owned from reset.
+ *  \b PRE-CONDITION                            :       HAL_GPIO_Init() is called.
+ *  \b POST-CONDITION                           :       the pins are owned by the caller till it releases them.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
+ *  @see                                        :       HAL_GPIO_PinsRelease(uint16_t arg_u16GpioName, const uint16_t argConst_u16PinsMask)
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * int main() {
+ *  HAL_GPIO_Init();    // make sure that you edited any array in "GPIO_config.h" labeled with @user_todo so that GPIO can be initialized correctly
+ *  HAL_GPIO_ErrStates_t local_errState_t = HAL_GPIO_PinsClaim(HAL_GPIO_PORTB, HAL_GPIO_PIN6 | HAL_GPIO_PIN7);
+ *  if (local_errState_t == HAL_GPIO_OK)
+ *  {
+ *      // configure PB6 and PB7 as I2C1 pins using HAL_GPIO_PortReconfigure()
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.1            </td><td> AMS      </td><td> debug pins are owned from reset </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_PinsClaim(uint16_t arg_u16GpioName, const uint16_t argConst_u16PinsMask);
+
+/**
+ *  \b function                                 :       HAL_GPIO_PinsAttach(uint16_t arg_u16GpioName, const uint16_t argConst_u16PinsMask, uint16_t *const arg_constpu16ClaimedPins)
+ *  \b Description                              :       this functions is used by engines and drivers that use pins which may be configured by HAL_GPIO_Init() already,
+ *                                                  the pins configured in "GPIO_config.h" are used as they are and the free ones are claimed.
+ *  @param  arg_u16GpioName [IN]                :       this is input parameter and for possible values refer to @HAL_GPIO_Ports_t in "GPIO_header.h", used to select port (one port only).
+ *  @param  argConst_u16PinsMask [IN]           :       this is input parameter and for possible values refer to @HAL_GPIO_Pins_t in "GPIO_header.h", pins used by the caller.
+ *  @param  arg_constpu16ClaimedPins [OUT]      :       this is output parameter which will hold the pins claimed by this call, the caller gives them back with HAL_GPIO_PinsRelease() when it stops.
+ *  @note                                       :       if one of the pins is claimed by another driver (or is a debug pin) nothing is claimed and @HAL_GPIO_ERR_PINS_CLAIMED is returned.
+ *  \b PRE-CONDITION                            :       None.
+ *  \b POST-CONDITION                           :       the pins are owned till the claimed ones are released.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
+ *  @see                                        :       HAL_GPIO_PinsClaim(uint16_t arg_u16GpioName, const uint16_t argConst_u16PinsMask)
+ *  @see                                        :       HAL_GPIO_PinsRelease(uint16_t arg_u16GpioName, const uint16_t argConst_u16PinsMask)
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * int main() {
+ *  uint16_t local_u16Claimed = 0;
+ *  HAL_GPIO_ErrStates_t local_errState_t = HAL_GPIO_PinsAttach(HAL_GPIO_PORTD, HAL_GPIO_PIN12 | HAL_GPIO_PIN13, &local_u16Claimed);
+ *  if (local_errState_t == HAL_GPIO_OK && local_u16Claimed != 0)
+ *  {
+ *      // use the pins then give back what was claimed
+ *      HAL_GPIO_PinsRelease(HAL_GPIO_PORTD, local_u16Claimed);
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_PinsAttach(uint16_t arg_u16GpioName, const uint16_t argConst_u16PinsMask, uint16_t *const arg_constpu16ClaimedPins);
+
+/**
+ *  \b function                                 :       HAL_GPIO_PinsRelease(uint16_t arg_u16GpioName, const uint16_t argConst_u16PinsMask)
+ *  \b Description                              :       this functions is used to give back the ownership of pins claimed by HAL_GPIO_PinsClaim().
+ *  @param  arg_u16GpioName [IN]                :       this is input parameter and for possible values refer to @HAL_GPIO_Ports_t in "GPIO_header.h", used to select port (one port only).
+ *  @param  argConst_u16PinsMask [IN]           :       this is input parameter and for possible values refer to @HAL_GPIO_Pins_t in "GPIO_header.h", pins to be released.
+ *  @note                                       :       releasing a pin that isn't owned is reported as invalid parameters and nothing is released, the pins configuration isn't changed.
+ *  \b PRE-CONDITION                            :       the pins are claimed.
+ *  \b POST-CONDITION                           :       the pins can be claimed by another driver.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
+ *  @see                                        :       HAL_GPIO_PinsClaim(uint16_t arg_u16GpioName, const uint16_t argConst_u16PinsMask)
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * int main() {
+ *  HAL_GPIO_ErrStates_t local_errState_t = HAL_GPIO_PinsRelease(HAL_GPIO_PORTB, HAL_GPIO_PIN6 | HAL_GPIO_PIN7);
+ *  if (local_errState_t != HAL_GPIO_OK)
+ *  {
+ *      // if the function returned thus means it failed.
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_PinsRelease(uint16_t arg_u16GpioName, const uint16_t argConst_u16PinsMask);
+
+/**
+ *  \b function                                 :       HAL_GPIO_GetUnusedPins(uint16_t arg_u16GpioName, uint16_t *const arg_constpu16UnusedPins)
+ *  \b Description                              :       this functions is used to get the pins of a port that aren't owned by anyone.
+ *  @param  arg_u16GpioName [IN]                :       this is input parameter and for possible values refer to @HAL_GPIO_Ports_t in "GPIO_header.h", used to select port (one port only).
+ *  @param  arg_constpu16UnusedPins [OUT]       :       this is output parameter which will hold the pins that aren't owned.
+ *  \b PRE-CONDITION                            :       HAL_GPIO_Init() is called.
+ *  \b POST-CONDITION                           :       None.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
+ *  @see                                        :       HAL_GPIO_UnusedPinsToAnalog(uint16_t arg_u16GpioNames)
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * int main() {
+ *  uint16_t local_u16Unused = 0;
+ *  HAL_GPIO_ErrStates_t local_errState_t = HAL_GPIO_GetUnusedPins(HAL_GPIO_PORTC, &local_u16Unused);
+ *  if (local_errState_t != HAL_GPIO_OK)
+ *  {
+ *      // if the function returned thus means it failed.
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_GetUnusedPins(uint16_t arg_u16GpioName, uint16_t *const arg_constpu16UnusedPins);
+
+/**
+ *  \b function                                 :       HAL_GPIO_UnusedPinsToAnalog(uint16_t arg_u16GpioNames)
+ *  \b Description                              :       this functions is used to put the pins that aren't owned by anyone into analog mode without pull resistors
+ *                                                  which disables their input Schmitt trigger and saves power.
+ *  @param  arg_u16GpioNames [IN]               :       this is input parameter and for possible values refer to @HAL_GPIO_Ports_t in "GPIO_header.h", ports can be ORed together.
+ *  @note                                       :       the pins stay unowned so they can still be claimed later, debug pins are never touched as they are owned from reset
+ *                                                  and the pins used by the waveform, capture, keypad and quadrature engines are claimed while they run.
+ *                                                  if any of the unused pins is locked by GPIOx_LCKR the port isn't changed and @HAL_GPIO_ERR_PIN_LOCKED is returned.
+ *  \b PRE-CONDITION                            :       HAL_GPIO_Init() is called and the clocks of the selected ports are enabled.
+ *  \b POST-CONDITION                           :       unused pins of the selected ports are in analog mode.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_GPIO_ErrStates_t in "GPIO_header.h")
+ *  @see                                        :       HAL_GPIO_GetUnusedPins(uint16_t arg_u16GpioName, uint16_t *const arg_constpu16UnusedPins)
+ *
+ *  \b Example:
+ * @code
+ * #include "GPIO_header.h"
+ * int main() {
+ *  HAL_GPIO_Init();    // make sure that you edited any array in "GPIO_config.h" labeled with @user_todo so that GPIO can be initialized correctly
+ *  HAL_GPIO_ErrStates_t local_errState_t = HAL_GPIO_UnusedPinsToAnalog(HAL_GPIO_PORTA | HAL_GPIO_PORTB | HAL_GPIO_PORTC);
+ *  if (local_errState_t != HAL_GPIO_OK)
+ *  {
+ *      // if the function returned thus means it failed.
+ *  }
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.1            </td><td> AMS      </td><td> engines pins and debug pins are never switched </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_GPIO_ErrStates_t HAL_GPIO_UnusedPinsToAnalog(uint16_t arg_u16GpioNames);
+
 /*** End of File **************************************************************/
 #endif /*HAL_GPIO_HEADER_H_*/
\ No newline at end of file
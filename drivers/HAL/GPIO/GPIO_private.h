@@ -64,10 +64,26 @@
  */
 #include "../../lib/math_btt.h"
 
+/**
+ * @reason: contains lock states used to validate pins configurations
+ */
+#include "../../lib/constants.h"
+
 /******************************************************************************
  * Preprocessor Constants
  *******************************************************************************/
 
+/**
+ * @brief: number of alternate functions available for every pin (AF0 - AF15)
+ */
+#define HAL_GPIO_MAX_ALTERNATE_FUNC 16
+
+/**
+ * @brief: pins used by the debug port after reset (SWD/JTAG), they are owned from reset so they are never claimed nor switched to analog
+ */
+#define HAL_GPIO_PORTA_DEBUG_PINS 0xE000U /**< PA13 (SWDIO), PA14 (SWCLK) and PA15 (JTDI)*/
+#define HAL_GPIO_PORTB_DEBUG_PINS 0x0018U /**< PB3 (SWO) and PB4 (NJTRST)*/
+
 /******************************************************************************
  * Configuration Constants
  *******************************************************************************/
@@ -76,9 +92,94 @@
  * Macros
  *******************************************************************************/
 
+/**
+ * @brief: these extract one field from a pin configuration tuple created by HAL_GPIO_PIN_CONFIG() or HAL_GPIO_PIN_NOT_USED in "GPIO_config.h"
+ */
+#define HAL_GPIO_CFG_FIELD_USED(USED, MODE, OUTPUT_TYPE, OUTPUT_SPEED, PULL_UP_DOWN, LOCK_ENABLE, ALTERNATE_FUNC) (USED)
+#define HAL_GPIO_CFG_FIELD_MODE(USED, MODE, OUTPUT_TYPE, OUTPUT_SPEED, PULL_UP_DOWN, LOCK_ENABLE, ALTERNATE_FUNC) (MODE)
+#define HAL_GPIO_CFG_FIELD_OUTPUT_TYPE(USED, MODE, OUTPUT_TYPE, OUTPUT_SPEED, PULL_UP_DOWN, LOCK_ENABLE, ALTERNATE_FUNC) (OUTPUT_TYPE)
+#define HAL_GPIO_CFG_FIELD_OUTPUT_SPEED(USED, MODE, OUTPUT_TYPE, OUTPUT_SPEED, PULL_UP_DOWN, LOCK_ENABLE, ALTERNATE_FUNC) (OUTPUT_SPEED)
+#define HAL_GPIO_CFG_FIELD_PULL_UP_DOWN(USED, MODE, OUTPUT_TYPE, OUTPUT_SPEED, PULL_UP_DOWN, LOCK_ENABLE, ALTERNATE_FUNC) (PULL_UP_DOWN)
+#define HAL_GPIO_CFG_FIELD_LOCK_ENABLE(USED, MODE, OUTPUT_TYPE, OUTPUT_SPEED, PULL_UP_DOWN, LOCK_ENABLE, ALTERNATE_FUNC) (LOCK_ENABLE)
+#define HAL_GPIO_CFG_FIELD_ALTERNATE_FUNC(USED, MODE, OUTPUT_TYPE, OUTPUT_SPEED, PULL_UP_DOWN, LOCK_ENABLE, ALTERNATE_FUNC) (ALTERNATE_FUNC)
+
+#define HAL_GPIO_CFG_USED(CFG) HAL_GPIO_CFG_FIELD_USED CFG
+#define HAL_GPIO_CFG_MODE(CFG) HAL_GPIO_CFG_FIELD_MODE CFG
+#define HAL_GPIO_CFG_OUTPUT_TYPE(CFG) HAL_GPIO_CFG_FIELD_OUTPUT_TYPE CFG
+#define HAL_GPIO_CFG_OUTPUT_SPEED(CFG) HAL_GPIO_CFG_FIELD_OUTPUT_SPEED CFG
+#define HAL_GPIO_CFG_PULL_UP_DOWN(CFG) HAL_GPIO_CFG_FIELD_PULL_UP_DOWN CFG
+#define HAL_GPIO_CFG_LOCK_ENABLE(CFG) HAL_GPIO_CFG_FIELD_LOCK_ENABLE CFG
+#define HAL_GPIO_CFG_ALTERNATE_FUNC(CFG) HAL_GPIO_CFG_FIELD_ALTERNATE_FUNC CFG
+
+/**
+ * @brief: these give the contribution of one pin (at position POS inside the register) to a register value
+ */
+#define HAL_GPIO_IMG_TERM_USED(CFG, POS) ((uint32_t)HAL_GPIO_CFG_USED(CFG) << (POS))
+#define HAL_GPIO_IMG_TERM_USED_2BITS(CFG, POS) ((uint32_t)HAL_GPIO_CFG_USED(CFG) * (0x3UL << (2 * (POS))))
+#define HAL_GPIO_IMG_TERM_MODE(CFG, POS) ((uint32_t)HAL_GPIO_CFG_MODE(CFG) << (2 * (POS)))
+#define HAL_GPIO_IMG_TERM_OUTPUT_TYPE(CFG, POS) ((uint32_t)HAL_GPIO_CFG_OUTPUT_TYPE(CFG) << (POS))
+#define HAL_GPIO_IMG_TERM_OUTPUT_SPEED(CFG, POS) ((uint32_t)HAL_GPIO_CFG_OUTPUT_SPEED(CFG) << (2 * (POS)))
+#define HAL_GPIO_IMG_TERM_PULL_UP_DOWN(CFG, POS) ((uint32_t)HAL_GPIO_CFG_PULL_UP_DOWN(CFG) << (2 * (POS)))
+#define HAL_GPIO_IMG_TERM_LOCK_ENABLE(CFG, POS) ((uint32_t)HAL_GPIO_CFG_LOCK_ENABLE(CFG) << (POS))
+#define HAL_GPIO_IMG_TERM_ALTERNATE_FUNC(CFG, POS) ((uint32_t)HAL_GPIO_CFG_ALTERNATE_FUNC(CFG) << (4 * (POS)))
+#define HAL_GPIO_IMG_TERM_INVALID(CFG, POS) ((uint32_t)(HAL_GPIO_CFG_USED(CFG) && HAL_GPIO_CFG_IS_INVALID(CFG)) << (POS))
+
+/**
+ * @brief: checks the fields of a pin configuration tuple against their ranges
+ */
+#define HAL_GPIO_CFG_IS_INVALID(CFG)                                  \
+    (HAL_GPIO_CFG_MODE(CFG) >= HAL_GPIO_MAX_PIN_MODE ||               \
+     HAL_GPIO_CFG_OUTPUT_TYPE(CFG) >= HAL_GPIO_MAX_OUT_MODE ||        \
+     HAL_GPIO_CFG_OUTPUT_SPEED(CFG) >= HAL_GPIO_MAX_OUT_SPEED ||      \
+     HAL_GPIO_CFG_PULL_UP_DOWN(CFG) >= HAL_GPIO_MAX_PULL_UP_DOWN ||   \
+     HAL_GPIO_CFG_LOCK_ENABLE(CFG) >= LIB_CONSTANTS_MAX_LOCK_STATE || \
+     HAL_GPIO_CFG_ALTERNATE_FUNC(CFG) >= HAL_GPIO_MAX_ALTERNATE_FUNC)
+
+/**
+ * @brief: these apply TERM to the configuration of every pin of port L (L is the port letter) and OR the results together
+ */
+#define HAL_GPIO_PORT_PINS_0_7(L, TERM) \
+    (TERM(HAL_GPIO_P##L##0_CONFIG, 0) | \
+     TERM(HAL_GPIO_P##L##1_CONFIG, 1) | \
+     TERM(HAL_GPIO_P##L##2_CONFIG, 2) | \
+     TERM(HAL_GPIO_P##L##3_CONFIG, 3) | \
+     TERM(HAL_GPIO_P##L##4_CONFIG, 4) | \
+     TERM(HAL_GPIO_P##L##5_CONFIG, 5) | \
+     TERM(HAL_GPIO_P##L##6_CONFIG, 6) | \
+     TERM(HAL_GPIO_P##L##7_CONFIG, 7))
+
+#define HAL_GPIO_PORT_PINS_8_15(L, TERM, FIRST_POS)    \
+    (TERM(HAL_GPIO_P##L##8_CONFIG, (FIRST_POS) + 0) |  \
+     TERM(HAL_GPIO_P##L##9_CONFIG, (FIRST_POS) + 1) |  \
+     TERM(HAL_GPIO_P##L##10_CONFIG, (FIRST_POS) + 2) | \
+     TERM(HAL_GPIO_P##L##11_CONFIG, (FIRST_POS) + 3) | \
+     TERM(HAL_GPIO_P##L##12_CONFIG, (FIRST_POS) + 4) | \
+     TERM(HAL_GPIO_P##L##13_CONFIG, (FIRST_POS) + 5) | \
+     TERM(HAL_GPIO_P##L##14_CONFIG, (FIRST_POS) + 6) | \
+     TERM(HAL_GPIO_P##L##15_CONFIG, (FIRST_POS) + 7))
+
+#define HAL_GPIO_PORT_ALL_PINS(L, TERM) \
+    (HAL_GPIO_PORT_PINS_0_7(L, TERM) | HAL_GPIO_PORT_PINS_8_15(L, TERM, 8))
+
+/**
+ * @brief: computes the registers values of port L at compile time, pins that aren't used keep the reset value of their fields
+ */
+#define HAL_GPIO_PORT_IMAGE(L)                                                                                                                                               \
+    {                                                                                                                                                                        \
+        .UsedPins = HAL_GPIO_PORT_ALL_PINS(L, HAL_GPIO_IMG_TERM_USED),                                                                                                       \
+        .InvalidPins = HAL_GPIO_PORT_ALL_PINS(L, HAL_GPIO_IMG_TERM_INVALID),                                                                                                 \
+        .MODER = (HAL_GPIO##L##_MODER_RESET_VAL & ~HAL_GPIO_PORT_ALL_PINS(L, HAL_GPIO_IMG_TERM_USED_2BITS)) | HAL_GPIO_PORT_ALL_PINS(L, HAL_GPIO_IMG_TERM_MODE),             \
+        .OTYPER = HAL_GPIO_PORT_ALL_PINS(L, HAL_GPIO_IMG_TERM_OUTPUT_TYPE),                                                                                                  \
+        .OSPEEDR = (HAL_GPIO##L##_OSPEEDR_RESET_VAL & ~HAL_GPIO_PORT_ALL_PINS(L, HAL_GPIO_IMG_TERM_USED_2BITS)) | HAL_GPIO_PORT_ALL_PINS(L, HAL_GPIO_IMG_TERM_OUTPUT_SPEED), \
+        .PUPDR = (HAL_GPIO##L##_PUPDR_RESET_VAL & ~HAL_GPIO_PORT_ALL_PINS(L, HAL_GPIO_IMG_TERM_USED_2BITS)) | HAL_GPIO_PORT_ALL_PINS(L, HAL_GPIO_IMG_TERM_PULL_UP_DOWN),     \
+        .LCKR = HAL_GPIO_PORT_ALL_PINS(L, HAL_GPIO_IMG_TERM_LOCK_ENABLE),                                                                                                    \
+        .AFRL = HAL_GPIO_PORT_PINS_0_7(L, HAL_GPIO_IMG_TERM_ALTERNATE_FUNC),                                                                                                 \
+        .AFRH = HAL_GPIO_PORT_PINS_8_15(L, HAL_GPIO_IMG_TERM_ALTERNATE_FUNC, 0),                                                                                             \
+    }
+
 /**
  * @enum: HAL_GPIO__PortsIndexes_t
- * @brief: these are indexes used in globalConstArr_GPIO_PinsConfig_t.
+ * @brief: these are indexes used in globalConstArr_GPIO_PortsImages_t and the pins of a port.
  */
 typedef enum
 {
@@ -96,7 +197,7 @@ typedef enum
 
 /**
  * @enum: HAL_GPIO_PinsIndexes_t
- * @brief: these are indexes used in globalConstArr_GPIO_PinsConfig_t.
+ * @brief: these are indexes used in globalConstArr_GPIO_PortsImages_t and the pins of a port.
  */
 typedef enum
 {
@@ -119,9 +220,46 @@ typedef enum
     HAL_GPIO_MAX_PIN_INDEX,
 } HAL_GPIO_PinsIndexes_t;
 
+/**
+ * @struct: HAL_GPIO_PortImage_t
+ * @brief: holds the values to be stored in the configuration registers of a port, computed at compile time from "GPIO_config.h".
+ */
+typedef struct
+{
+    uint32_t UsedPins;    /**< pins that are configured by the user, a port with no used pins isn't touched*/
+    uint32_t InvalidPins; /**< used pins having a field out of its range, checked by HAL_GPIO_Init()*/
+    uint32_t MODER;       /**< value of GPIO port mode register.*/
+    uint32_t OTYPER;      /**< value of GPIO port output type register.*/
+    uint32_t OSPEEDR;     /**< value of GPIO port output speed register.*/
+    uint32_t PUPDR;       /**< value of GPIO port pull-up/pull-down register.*/
+    uint32_t LCKR;        /**< pins to be locked.*/
+    uint32_t AFRL;        /**< value of GPIO alternate function low register.*/
+    uint32_t AFRH;        /**< value of GPIO alternate function high register.*/
+} HAL_GPIO_PortImage_t;
+
+/**
+ * @struct: HAL_GPIO_DmaTrigger_t
+ * @brief: holds the DMA2 stream and channel that serve the update request of a timer.
+ */
+typedef struct
+{
+    uint8_t Stream;  /**< for possible values refer to @HAL_DMA_Streams_t in "DMA_header.h"*/
+    uint8_t Channel; /**< for possible values refer to @HAL_DMA2_StreamsChannels_t in "DMA_config.h"*/
+} HAL_GPIO_DmaTrigger_t;
+
 /******************************************************************************
  * Function Prototypes
  *******************************************************************************/
 
+/**
+ * @brief: this function gives back the pins claimed by HAL_GPIO_CaptureStart() and clears the claimed mask so that they are never released twice
+ */
+static void HAL_GPIO_CaptureReleasePins(HAL_GPIO_Capture_t *const arg_constpCapture);
+
+/**
+ * @brief: this function gives back the row and column pins claimed by HAL_GPIO_KeypadStart() and clears the claimed masks so that they are never released twice
+ */
+static void HAL_GPIO_KeypadReleasePins(HAL_GPIO_Keypad_t *const arg_constpKeypad);
+
 /*** End of File **************************************************************/
 #endif /*HAL_GPIO_PRIVATE_H_*/
@@ -93,6 +93,38 @@
  */
 #define HAL_GPIOx_LCKR_LCKK 16 /**< Lock key. This bit can be read any time. It can only be modified using the lock key write sequence.*/
 
+/**
+ * @brief: reset values of GPIO configuration registers, ports A and B aren't zero as the debug pins (PA13, PA14, PA15, PB3 and PB4) are in alternate function mode after reset,
+ *         registers that aren't listed here (OTYPER, AFRL, AFRH, LCKR) reset to zero for all ports
+ */
+#define HAL_GPIOA_MODER_RESET_VAL 0xA8000000   /**< reset value of GPIOA_MODER*/
+#define HAL_GPIOA_OSPEEDR_RESET_VAL 0x0C000000 /**< reset value of GPIOA_OSPEEDR*/
+#define HAL_GPIOA_PUPDR_RESET_VAL 0x64000000   /**< reset value of GPIOA_PUPDR*/
+#define HAL_GPIOB_MODER_RESET_VAL 0x00000280   /**< reset value of GPIOB_MODER*/
+#define HAL_GPIOB_OSPEEDR_RESET_VAL 0x000000C0 /**< reset value of GPIOB_OSPEEDR*/
+#define HAL_GPIOB_PUPDR_RESET_VAL 0x00000100   /**< reset value of GPIOB_PUPDR*/
+#define HAL_GPIOC_MODER_RESET_VAL 0x00000000   /**< reset value of GPIOC_MODER*/
+#define HAL_GPIOC_OSPEEDR_RESET_VAL 0x00000000 /**< reset value of GPIOC_OSPEEDR*/
+#define HAL_GPIOC_PUPDR_RESET_VAL 0x00000000   /**< reset value of GPIOC_PUPDR*/
+#define HAL_GPIOD_MODER_RESET_VAL 0x00000000   /**< reset value of GPIOD_MODER*/
+#define HAL_GPIOD_OSPEEDR_RESET_VAL 0x00000000 /**< reset value of GPIOD_OSPEEDR*/
+#define HAL_GPIOD_PUPDR_RESET_VAL 0x00000000   /**< reset value of GPIOD_PUPDR*/
+#define HAL_GPIOE_MODER_RESET_VAL 0x00000000   /**< reset value of GPIOE_MODER*/
+#define HAL_GPIOE_OSPEEDR_RESET_VAL 0x00000000 /**< reset value of GPIOE_OSPEEDR*/
+#define HAL_GPIOE_PUPDR_RESET_VAL 0x00000000   /**< reset value of GPIOE_PUPDR*/
+#define HAL_GPIOF_MODER_RESET_VAL 0x00000000   /**< reset value of GPIOF_MODER*/
+#define HAL_GPIOF_OSPEEDR_RESET_VAL 0x00000000 /**< reset value of GPIOF_OSPEEDR*/
+#define HAL_GPIOF_PUPDR_RESET_VAL 0x00000000   /**< reset value of GPIOF_PUPDR*/
+#define HAL_GPIOG_MODER_RESET_VAL 0x00000000   /**< reset value of GPIOG_MODER*/
+#define HAL_GPIOG_OSPEEDR_RESET_VAL 0x00000000 /**< reset value of GPIOG_OSPEEDR*/
+#define HAL_GPIOG_PUPDR_RESET_VAL 0x00000000   /**< reset value of GPIOG_PUPDR*/
+#define HAL_GPIOH_MODER_RESET_VAL 0x00000000   /**< reset value of GPIOH_MODER*/
+#define HAL_GPIOH_OSPEEDR_RESET_VAL 0x00000000 /**< reset value of GPIOH_OSPEEDR*/
+#define HAL_GPIOH_PUPDR_RESET_VAL 0x00000000   /**< reset value of GPIOH_PUPDR*/
+#define HAL_GPIOI_MODER_RESET_VAL 0x00000000   /**< reset value of GPIOI_MODER*/
+#define HAL_GPIOI_OSPEEDR_RESET_VAL 0x00000000 /**< reset value of GPIOI_OSPEEDR*/
+#define HAL_GPIOI_PUPDR_RESET_VAL 0x00000000   /**< reset value of GPIOI_PUPDR*/
+
 /******************************************************************************
  * Configuration Constants
  *******************************************************************************/
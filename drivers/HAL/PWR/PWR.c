@@ -171,6 +171,8 @@ HAL_PWR_ErrStates_t HAL_PWR_Init()
         HAL_CM4F_CONFIGURE_SLEEP_ON_EXIT(globalConstArr_PWRConfig_t[0].SleepOnExitFromISREnable);
     }
 
+    HAL_CM4F_BOOT_PROFILE_MARK(HAL_CM4F_BOOT_STAGE_PWR_INIT, 0);
+
     return local_errState_t;
 }
 
@@ -273,7 +275,8 @@ HAL_PWR_ErrStates_t HAL_PWR_Config(const uint8_t argConst_u8Key, const uint8_t a
     else
     {
         if ((argConst_u8Key == HAL_PWR_KEY_SLEEP_METHOD && argConst_u8Value >= HAL_PWR_MAX_VAL_SLEEP_METHOD) ||
-            (argConst_u8Key == HAL_PWR_KEY_SLEEP_EXIT_ISR_ENABLE && argConst_u8Value >= LIB_CONSTANTS_MAX_DRIVER_STATE))
+            (argConst_u8Key == HAL_PWR_KEY_SLEEP_EXIT_ISR_ENABLE && argConst_u8Value >= LIB_CONSTANTS_MAX_DRIVER_STATE) ||
+            (argConst_u8Key == HAL_PWR_KEY_MAX_HCLK_FREQ && argConst_u8Value >= HAL_PWR_MAX_HCLK))
         {
             local_errState_t = HAL_PWR_ERR_INVALID_PARAMS;
         }
@@ -294,6 +297,10 @@ HAL_PWR_ErrStates_t HAL_PWR_Config(const uint8_t argConst_u8Key, const uint8_t a
         {
             HAL_CM4F_CONFIGURE_SLEEP_ON_EXIT(argConst_u8Value);
         }
+        else if (argConst_u8Key == HAL_PWR_KEY_MAX_HCLK_FREQ)
+        {
+            LIB_MATH_BTT_ASSIGN_BIT(global_pPWRReg_t->PWR_CR, HAL_PWR_CR_VOS, argConst_u8Value);
+        }
     }
 
     return local_errState_t;
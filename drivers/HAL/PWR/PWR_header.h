@@ -138,6 +138,7 @@ typedef enum
 {
     HAL_PWR_KEY_SLEEP_METHOD,          /**< for possible corresponding values refer to @HAL_PWR_VAL_SleepMethod_t in "PWR_header.h", it indicates how the MCU shall enter the sleep mode*/
     HAL_PWR_KEY_SLEEP_EXIT_ISR_ENABLE, /**< for for possible values refer to @LIB_CONSTANTS_DriverStates_t in "constants.h", it indicates whether to enable or disable sleeping on exit from ISR*/
+    HAL_PWR_KEY_MAX_HCLK_FREQ,         /**< for possible values refer to @HAL_PWR_HCLK_MAX_FREQ_t in "PWR_config.h", it scales the regulator output voltage (VOS) to the maximum reachable HCLK, it has to be written while the main PLL is off*/
     HAL_PWR_MAX_CONFIG_KEYS,           /**< this value shall never used by the user and it's only used by implementation code to verify input*/
 } HAL_PWR_ConfigKeys_t;
 
@@ -85,6 +85,21 @@
  */
 #include "RCC_private.h"
 
+/**
+ * @reason: sets the flash wait states when the clock profile changes
+ */
+#include "../Flash/flash_header.h"
+
+/**
+ * @reason: scales the regulator output voltage when the clock profile changes
+ */
+#include "../PWR/PWR_header.h"
+
+/**
+ * @reason: protects the clock users counters from interrupts
+ */
+#include "../CM4F/CM4F_header.h"
+
 /******************************************************************************
  * Module Preprocessor Constants
  *******************************************************************************/
@@ -120,34 +135,20 @@ HAL_RCC_ErrStates_t HAL_RCC_Init()
     uint8_t local_u8PeriArrLen = (sizeof globalConstArr_RCCEnablementConfig_t) / (sizeof globalConstArr_RCCEnablementConfig_t[0]);
     uint32_t local_u32TempReg = 0;
     uint32_t local_u32TempVal = 0;
-    uint32_t local_u32VCO1 = 0;
-    uint32_t local_u32VCO2 = 0;
-    uint8_t local_u8PLLM = 2;
-    uint8_t local_u8PLLM_min = 0;
-    uint8_t local_u8PLLM_max = 0;
-    uint8_t local_u8PLLP = 2;
-    uint8_t local_u8PLL48CLKQ = 2;
-    uint8_t local_u8PLLI2SR = 2;
-    uint16_t local_u16PLLN = 50;
-    uint16_t local_u16PLLI2SN = 50;
-    uint32_t local_u32PLLSrcSpeed = 0;
-    uint8_t local_u8PLLConfigSuccess = LIB_CONSTANTS_FAIL;
-
-    // assign a value for system clock
-    if (globalConstArr_RCC_SYSCLK_ClockConfig_t[0].SYSClkClockSource == HAL_RCC_SYSCLK_CLK_SRC_HSI)
-    {
-        global_u32SystemClock = HAL_RCC_HSI_SPEED;
-    }
-    else if (globalConstArr_RCC_SYSCLK_ClockConfig_t[0].SYSClkClockSource == HAL_RCC_SYSCLK_CLK_SRC_HSE)
-    {
-        global_u32SystemClock = globalConstArr_RCC_MiscellaneousConfig_t[0].HSEVal;
-    }
-    else if (globalConstArr_RCC_SYSCLK_ClockConfig_t[0].SYSClkClockSource == HAL_RCC_SYSCLK_CLK_SRC_PLL)
-    {
-        global_u32SystemClock = globalConstArr_RCC_PLL_ClockConfig_t[0].PLLOutputValue;
-    }
-
-    // validate all configurations
+    uint32_t local_u32EnableMasks[HAL_RCC_MAX_BUS] = {0};
+    uint32_t local_u32EnableImages[HAL_RCC_MAX_BUS] = {0};
+    uint32_t local_u32LowPowerMasks[HAL_RCC_MAX_BUS] = {0};
+    uint32_t local_u32LowPowerImages[HAL_RCC_MAX_BUS] = {0};
+    const HAL_RCC_PeripheralBits_t *local_pBits_t = &globalConstArr_RCC_PeripheralBits_t[0];
+    __io uint32_t *local_pu32BusReg = &global_pRCCReg_t->RCC_AHB1RSTR;
+
+    // system clock is known at build time (refer to @HAL_RCC_CLOCK_TREE in "RCC_private.h")
+    global_u32SystemClock = HAL_RCC_CT_SYSCLK_SPEED;
+    global_u16AHBPrescaler = HAL_RCC_CFG_AHB_PRESCALER;
+    global_u8APB1Prescaler = HAL_RCC_CFG_APB1_PRESCALER;
+    global_u8APB2Prescaler = HAL_RCC_CFG_APB2_PRESCALER;
+
+    // validate all configurations (clock tree targets are validated at build time)
     for (local_u8Iterator = 0; local_u8Iterator < local_u8PeriArrLen; local_u8Iterator++)
     {
         if (globalConstArr_RCCEnablementConfig_t[local_u8Iterator].PeripheralName >= HAL_RCC_MAX_PERIPHERAL ||
@@ -160,17 +161,10 @@ HAL_RCC_ErrStates_t HAL_RCC_Init()
     }
     if (globalConstArr_RCC_MiscellaneousConfig_t[0].I2SClockSource >= HAL_RCC_MAX_I2S_CLK_SRC ||
         globalConstArr_RCC_MiscellaneousConfig_t[0].EthernetMACPrescalar >= 21 ||
-        globalConstArr_RCC_MiscellaneousConfig_t[0].HSEVal > 26000000 || globalConstArr_RCC_MiscellaneousConfig_t[0].HSEVal < 4000000 ||
-        globalConstArr_RCC_ClocksEnable_t[0].PLL_ClkEnable >= LIB_CONSTANTS_MAX_DRIVER_STATE ||
-        globalConstArr_RCC_ClocksEnable_t[0].PLLI2S_ClkEnable >= LIB_CONSTANTS_MAX_DRIVER_STATE ||
-        globalConstArr_RCC_ClocksEnable_t[0].PLL48_ClkEnable >= LIB_CONSTANTS_MAX_DRIVER_STATE ||
         globalConstArr_RCC_ClocksEnable_t[0].HSI_ClkEnable >= LIB_CONSTANTS_MAX_DRIVER_STATE ||
         globalConstArr_RCC_ClocksEnable_t[0].HSE_ClkEnable >= LIB_CONSTANTS_MAX_DRIVER_STATE ||
         globalConstArr_RCC_ClocksEnable_t[0].LSI_ClkEnable >= LIB_CONSTANTS_MAX_DRIVER_STATE ||
         globalConstArr_RCC_ClocksEnable_t[0].LSE_ClkEnable >= LIB_CONSTANTS_MAX_DRIVER_STATE ||
-        globalConstArr_RCC_PLL_ClockConfig_t[0].PLLClockSource >= HAL_RCC_MAX_PLL_CLK_SRC ||
-        globalConstArr_RCC_PLL_ClockConfig_t[0].PLLOutputValue < 25000000 || globalConstArr_RCC_PLL_ClockConfig_t[0].PLLOutputValue > 168000000 || globalConstArr_RCC_PLL_ClockConfig_t[0].PLLOutputValue % 1000000 != 0 ||
-        globalConstArr_RCC_PLL_ClockConfig_t[0].PLLI2SOutputValue > 25000000 || globalConstArr_RCC_PLL_ClockConfig_t[0].PLLI2SOutputValue > 192000000 || globalConstArr_RCC_PLL_ClockConfig_t[0].PLLOutputValue % 1000000 != 0 ||
         globalConstArr_RCC_MCO_ClockConfig_t[0].MCO1Enable >= LIB_CONSTANTS_MAX_DRIVER_STATE ||
         globalConstArr_RCC_MCO_ClockConfig_t[0].MCO1ClockSource >= HAL_RCC_MAX_MCO1_CLK_SRC ||
         globalConstArr_RCC_MCO_ClockConfig_t[0].MCO1Prescalar > 5 ||
@@ -178,227 +172,46 @@ HAL_RCC_ErrStates_t HAL_RCC_Init()
         globalConstArr_RCC_MCO_ClockConfig_t[0].MCO2ClockSource >= HAL_RCC_MAX_MCO2_CLK_SRC ||
         globalConstArr_RCC_MCO_ClockConfig_t[0].MCO2Prescalar > 5 ||
         globalConstArr_RCC_RTC_ClockConfig_t[0].RTCClockSource >= HAL_RCC_MAX_RTC_CLK_SRC ||
-        globalConstArr_RCC_SYSCLK_ClockConfig_t[0].SYSClkClockSource >= HAL_RCC_MAX_SYSCLK_CLK_SRC ||
-        (globalConstArr_RCC_SYSCLK_ClockConfig_t[0].SYSCLK_to_AHB_Prescalar != 0 && globalConstArr_RCC_SYSCLK_ClockConfig_t[0].SYSCLK_to_AHB_Prescalar <= 16 && (globalConstArr_RCC_SYSCLK_ClockConfig_t[0].SYSCLK_to_AHB_Prescalar & (globalConstArr_RCC_SYSCLK_ClockConfig_t[0].SYSCLK_to_AHB_Prescalar - 1))) ||
-        (globalConstArr_RCC_SYSCLK_ClockConfig_t[0].AHB_to_APB1_Prescalar != 0 && globalConstArr_RCC_SYSCLK_ClockConfig_t[0].AHB_to_APB1_Prescalar <= 16 && (globalConstArr_RCC_SYSCLK_ClockConfig_t[0].AHB_to_APB1_Prescalar & (globalConstArr_RCC_SYSCLK_ClockConfig_t[0].AHB_to_APB1_Prescalar - 1))) ||
-        (globalConstArr_RCC_SYSCLK_ClockConfig_t[0].AHB_to_APB2_Prescalar != 0 && globalConstArr_RCC_SYSCLK_ClockConfig_t[0].AHB_to_APB2_Prescalar <= 16 && (globalConstArr_RCC_SYSCLK_ClockConfig_t[0].AHB_to_APB2_Prescalar & (globalConstArr_RCC_SYSCLK_ClockConfig_t[0].AHB_to_APB2_Prescalar - 1))) ||
-        (globalConstArr_RCC_SYSCLK_ClockConfig_t[0].SYSClkClockSource == HAL_RCC_SYSCLK_CLK_SRC_PLL && globalConstArr_RCC_PLL_ClockConfig_t[0].PLLOutputValue / globalConstArr_RCC_SYSCLK_ClockConfig_t[0].SYSCLK_to_AHB_Prescalar > 168000000) ||
-        (globalConstArr_RCC_SYSCLK_ClockConfig_t[0].SYSClkClockSource == HAL_RCC_SYSCLK_CLK_SRC_PLL && globalConstArr_RCC_PLL_ClockConfig_t[0].PLLOutputValue / (globalConstArr_RCC_SYSCLK_ClockConfig_t[0].SYSCLK_to_AHB_Prescalar * globalConstArr_RCC_SYSCLK_ClockConfig_t[0].AHB_to_APB1_Prescalar) > 42000000) ||
-        (globalConstArr_RCC_SYSCLK_ClockConfig_t[0].SYSClkClockSource == HAL_RCC_SYSCLK_CLK_SRC_PLL && globalConstArr_RCC_PLL_ClockConfig_t[0].PLLOutputValue / (globalConstArr_RCC_SYSCLK_ClockConfig_t[0].SYSCLK_to_AHB_Prescalar * globalConstArr_RCC_SYSCLK_ClockConfig_t[0].AHB_to_APB2_Prescalar) > 84000000) ||
-        ((globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_ETHERNET].EnableInRunMode == LIB_CONSTANTS_ENABLED || globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_ETHERNET].EnableInSleepMode == LIB_CONSTANTS_ENABLED) && (global_u32SystemClock / globalConstArr_RCC_SYSCLK_ClockConfig_t[0].SYSCLK_to_AHB_Prescalar < 25000000)))
+        ((globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_ETHERNET].EnableInRunMode == LIB_CONSTANTS_ENABLED || globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_ETHERNET].EnableInSleepMode == LIB_CONSTANTS_ENABLED) && (HAL_RCC_CT_HCLK_SPEED < HAL_RCC_ETH_MIN_HCLK_SPEED)))
 
     {
         local_errState = HAL_RCC_ERR_INVALID_CONFIG;
     }
 
-    // find configurations for PLL if enabled (UGLIEST CODE I HAVE EVER WRITTEN --> TODO: REFACTOR THE BELOW CODE)
+    // main initialization
     if (local_errState == HAL_RCC_OK)
     {
-        local_u32PLLSrcSpeed = (globalConstArr_RCC_PLL_ClockConfig_t[0].PLLClockSource == HAL_RCC_PLL_CLK_SRC_HSE) ? globalConstArr_RCC_MiscellaneousConfig_t[0].HSEVal : HAL_RCC_HSI_SPEED;
-
-        local_u8PLLM_max = local_u32PLLSrcSpeed / 1000000;
-        local_u8PLLM_min = local_u32PLLSrcSpeed / 2000000;
-
-        // optimize for PLL, PLLI2S, PLL48
-        if (globalConstArr_RCC_ClocksEnable_t[0].PLL_ClkEnable == LIB_CONSTANTS_ENABLED && globalConstArr_RCC_ClocksEnable_t[0].PLLI2S_ClkEnable == LIB_CONSTANTS_ENABLED && globalConstArr_RCC_ClocksEnable_t[0].PLL48_ClkEnable == LIB_CONSTANTS_ENABLED)
-        {
-            for (local_u8PLLM = local_u8PLLM_min; local_u8PLLM <= local_u8PLLM_max; local_u8PLLM++)
-            {
-                for (local_u8PLLP = 2; local_u8PLLP <= 8; local_u8PLLP += 2)
-                {
-                    for (local_u8PLL48CLKQ = 2; local_u8PLL48CLKQ <= 15; local_u8PLL48CLKQ++)
-                    {
-                        for (local_u8PLLI2SR = 2; local_u8PLLI2SR <= 7; local_u8PLLI2SR++)
-                        {
-                            for (local_u16PLLN = 50; local_u16PLLN <= 432; local_u16PLLN++)
-                            {
-                                for (local_u16PLLI2SN = local_u16PLLI2SN; local_u16PLLI2SN <= 432; local_u16PLLI2SN++)
-                                {
-                                    local_u32VCO1 = (local_u32PLLSrcSpeed * ((local_u16PLLN * 10) / local_u8PLLM)) / 10;
-                                    local_u32VCO2 = (local_u32PLLSrcSpeed * ((local_u16PLLI2SN * 10) / local_u8PLLM)) / 10;
-                                    if (globalConstArr_RCC_PLL_ClockConfig_t[0].PLLOutputValue == local_u32VCO1 / local_u8PLLP &&
-                                        globalConstArr_RCC_PLL_ClockConfig_t[0].PLLI2SOutputValue == local_u32VCO2 / local_u8PLLI2SR &&
-                                        local_u32VCO1 >= HAL_RCC_VCO_MIN_SPEED && local_u32VCO1 <= HAL_RCC_VCO_MAX_SPEED &&
-                                        local_u32VCO2 >= HAL_RCC_VCO_MIN_SPEED && local_u32VCO2 <= HAL_RCC_VCO_MAX_SPEED &&
-                                        HAL_RCC_PLL48CLK_SPEED * local_u8PLL48CLKQ == local_u32VCO1)
-                                    {
-                                        local_u8PLLConfigSuccess = LIB_CONSTANTS_SUCCESS;
-                                        goto label;
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        // optimize for PLL, PLLI2S
-        else if (globalConstArr_RCC_ClocksEnable_t[0].PLL_ClkEnable == LIB_CONSTANTS_ENABLED && globalConstArr_RCC_ClocksEnable_t[0].PLLI2S_ClkEnable == LIB_CONSTANTS_ENABLED && globalConstArr_RCC_ClocksEnable_t[0].PLL48_ClkEnable == LIB_CONSTANTS_DISABLED)
-        {
-            for (local_u8PLLP = 2; local_u8PLLP <= 8; local_u8PLLP += 2)
-            {
-                for (local_u8PLLI2SR = 2; local_u8PLLI2SR <= 7; local_u8PLLI2SR++)
-                {
-                    for (local_u16PLLN = 50; local_u16PLLN <= 432; local_u16PLLN++)
-                    {
-                        for (local_u16PLLI2SN = local_u16PLLI2SN; local_u16PLLI2SN <= 432; local_u16PLLI2SN++)
-                        {
-                            local_u32VCO1 = (local_u32PLLSrcSpeed * ((local_u16PLLN * 10) / local_u8PLLM)) / 10;
-                            local_u32VCO2 = (local_u32PLLSrcSpeed * ((local_u16PLLI2SN * 10) / local_u8PLLM)) / 10;
-                            if (globalConstArr_RCC_PLL_ClockConfig_t[0].PLLOutputValue == local_u32VCO1 / local_u8PLLP &&
-                                globalConstArr_RCC_PLL_ClockConfig_t[0].PLLI2SOutputValue == local_u32VCO2 / local_u8PLLI2SR &&
-                                local_u32VCO1 >= HAL_RCC_VCO_MIN_SPEED && local_u32VCO1 <= HAL_RCC_VCO_MAX_SPEED &&
-                                local_u32VCO2 >= HAL_RCC_VCO_MIN_SPEED && local_u32VCO2 <= HAL_RCC_VCO_MAX_SPEED)
-                            {
-                                local_u8PLLConfigSuccess = LIB_CONSTANTS_SUCCESS;
-                                goto label;
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        // optimize for PLL, PLL48
-        else if (globalConstArr_RCC_ClocksEnable_t[0].PLL_ClkEnable == LIB_CONSTANTS_ENABLED && globalConstArr_RCC_ClocksEnable_t[0].PLLI2S_ClkEnable == LIB_CONSTANTS_DISABLED && globalConstArr_RCC_ClocksEnable_t[0].PLL48_ClkEnable == LIB_CONSTANTS_ENABLED)
-        {
-            for (local_u8PLLM = local_u8PLLM_min; local_u8PLLM <= local_u8PLLM_max; local_u8PLLM++)
-            {
-                for (local_u8PLLP = 2; local_u8PLLP <= 8; local_u8PLLP += 2)
-                {
-                    for (local_u8PLL48CLKQ = 2; local_u8PLL48CLKQ <= 15; local_u8PLL48CLKQ++)
-                    {
-                        for (local_u16PLLN = 50; local_u16PLLN <= 432; local_u16PLLN++)
-                        {
-                            local_u32VCO1 = (local_u32PLLSrcSpeed * ((local_u16PLLN * 10) / local_u8PLLM)) / 10;
-                            if (globalConstArr_RCC_PLL_ClockConfig_t[0].PLLOutputValue == local_u32VCO1 / local_u8PLLP &&
-                                local_u32VCO1 >= HAL_RCC_VCO_MIN_SPEED && local_u32VCO1 <= HAL_RCC_VCO_MAX_SPEED &&
-                                HAL_RCC_PLL48CLK_SPEED * local_u8PLL48CLKQ == local_u32VCO1)
-                            {
-                                local_u8PLLConfigSuccess = LIB_CONSTANTS_SUCCESS;
-                                goto label;
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        // optimize for PLL
-        else if (globalConstArr_RCC_ClocksEnable_t[0].PLL_ClkEnable == LIB_CONSTANTS_ENABLED && globalConstArr_RCC_ClocksEnable_t[0].PLLI2S_ClkEnable == LIB_CONSTANTS_DISABLED && globalConstArr_RCC_ClocksEnable_t[0].PLL48_ClkEnable == LIB_CONSTANTS_DISABLED)
+        // log the reset before anything else could reset the MCU again
+        if (HAL_RCC_CFG_RESET_HISTORY_ENABLE)
         {
-            for (local_u8PLLM = local_u8PLLM_min; local_u8PLLM <= local_u8PLLM_max; local_u8PLLM++)
-            {
-                for (local_u8PLLP = 2; local_u8PLLP <= 8; local_u8PLLP += 2)
-                {
-                    for (local_u16PLLN = 50; local_u16PLLN <= 432; local_u16PLLN++)
-                    {
-                        local_u32VCO1 = (local_u32PLLSrcSpeed * ((local_u16PLLN * 10) / local_u8PLLM)) / 10;
-                        if (globalConstArr_RCC_PLL_ClockConfig_t[0].PLLOutputValue == local_u32VCO1 / local_u8PLLP &&
-                            local_u32VCO1 >= HAL_RCC_VCO_MIN_SPEED && local_u32VCO1 <= HAL_RCC_VCO_MAX_SPEED)
-                        {
-                            local_u8PLLConfigSuccess = LIB_CONSTANTS_SUCCESS;
-                            goto label;
-                        }
-                    }
-                }
-            }
+            HAL_RCC_LogReset();
         }
-        // optimize for PLLI2S, PLL48
-        else if (globalConstArr_RCC_ClocksEnable_t[0].PLL_ClkEnable == LIB_CONSTANTS_DISABLED && globalConstArr_RCC_ClocksEnable_t[0].PLLI2S_ClkEnable == LIB_CONSTANTS_ENABLED && globalConstArr_RCC_ClocksEnable_t[0].PLL48_ClkEnable == LIB_CONSTANTS_ENABLED)
+        else
         {
-            for (local_u8PLLM = local_u8PLLM_min; local_u8PLLM <= local_u8PLLM_max; local_u8PLLM++)
-            {
-                for (local_u8PLL48CLKQ = 2; local_u8PLL48CLKQ <= 15; local_u8PLL48CLKQ++)
-                {
-                    for (local_u8PLLI2SR = 2; local_u8PLLI2SR <= 7; local_u8PLLI2SR++)
-                    {
-                        for (local_u16PLLN = 50; local_u16PLLN <= 432; local_u16PLLN++)
-                        {
-                            for (local_u16PLLI2SN = local_u16PLLI2SN; local_u16PLLI2SN <= 432; local_u16PLLI2SN++)
-                            {
-                                local_u32VCO1 = (local_u32PLLSrcSpeed * ((local_u16PLLN * 10) / local_u8PLLM)) / 10;
-                                local_u32VCO2 = (local_u32PLLSrcSpeed * ((local_u16PLLI2SN * 10) / local_u8PLLM)) / 10;
-                                if (globalConstArr_RCC_PLL_ClockConfig_t[0].PLLI2SOutputValue == local_u32VCO2 / local_u8PLLI2SR &&
-                                    local_u32VCO1 >= HAL_RCC_VCO_MIN_SPEED && local_u32VCO1 <= HAL_RCC_VCO_MAX_SPEED &&
-                                    local_u32VCO2 >= HAL_RCC_VCO_MIN_SPEED && local_u32VCO2 <= HAL_RCC_VCO_MAX_SPEED &&
-                                    HAL_RCC_PLL48CLK_SPEED * local_u8PLL48CLKQ == local_u32VCO1)
-                                {
-                                    local_u8PLLConfigSuccess = LIB_CONSTANTS_SUCCESS;
-                                    goto label;
-                                }
-                            }
-                        }
-                    }
-                }
-            }
+            // do nothing
         }
-        // optimize for PLLI2S
-        else if (globalConstArr_RCC_ClocksEnable_t[0].PLL_ClkEnable == LIB_CONSTANTS_DISABLED && globalConstArr_RCC_ClocksEnable_t[0].PLLI2S_ClkEnable == LIB_CONSTANTS_ENABLED && globalConstArr_RCC_ClocksEnable_t[0].PLL48_ClkEnable == LIB_CONSTANTS_DISABLED)
+
+        // turn on the oscillators and wait for them to be stable (TODO: enable/disable HSE bypass, adjust calibration)
+        LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_HSION);
+        while (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_HSIRDY) == 0)
         {
-            for (local_u8PLLM = local_u8PLLM_min; local_u8PLLM <= local_u8PLLM_max; local_u8PLLM++)
-            {
-                for (local_u8PLLI2SR = 2; local_u8PLLI2SR <= 7; local_u8PLLI2SR++)
-                {
-                    for (local_u16PLLI2SN = local_u16PLLI2SN; local_u16PLLI2SN <= 432; local_u16PLLI2SN++)
-                    {
-                        local_u32VCO2 = (local_u32PLLSrcSpeed * ((local_u16PLLI2SN * 10) / local_u8PLLM)) / 10;
-                        if (globalConstArr_RCC_PLL_ClockConfig_t[0].PLLI2SOutputValue == local_u32VCO2 / local_u8PLLI2SR &&
-                            local_u32VCO2 >= HAL_RCC_VCO_MIN_SPEED && local_u32VCO2 <= HAL_RCC_VCO_MAX_SPEED)
-                        {
-                            local_u8PLLConfigSuccess = LIB_CONSTANTS_SUCCESS;
-                            goto label;
-                        }
-                    }
-                }
-            }
+            // wait till HSI is stable as it's the clock used during the switch
         }
-        // optimize for PLL48
-        else if (globalConstArr_RCC_ClocksEnable_t[0].PLL_ClkEnable == LIB_CONSTANTS_DISABLED && globalConstArr_RCC_ClocksEnable_t[0].PLLI2S_ClkEnable == LIB_CONSTANTS_DISABLED && globalConstArr_RCC_ClocksEnable_t[0].PLL48_ClkEnable == LIB_CONSTANTS_ENABLED)
+        if (HAL_RCC_CT_HSE_USED || globalConstArr_RCC_ClocksEnable_t[0].HSE_ClkEnable == LIB_CONSTANTS_ENABLED)
         {
-            for (local_u8PLLM = local_u8PLLM_min; local_u8PLLM <= local_u8PLLM_max; local_u8PLLM++)
+            LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_HSEON);
+            while (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_HSERDY) == 0)
             {
-                for (local_u8PLL48CLKQ = 2; local_u8PLL48CLKQ <= 15; local_u8PLL48CLKQ++)
-                {
-                    for (local_u16PLLN = 50; local_u16PLLN <= 432; local_u16PLLN++)
-                    {
-                        local_u32VCO1 = (local_u32PLLSrcSpeed * ((local_u16PLLN * 10) / local_u8PLLM)) / 10;
-                        if (globalConstArr_RCC_PLL_ClockConfig_t[0].PLLOutputValue == local_u32VCO1 / local_u8PLLP &&
-                            local_u32VCO1 >= HAL_RCC_VCO_MIN_SPEED && local_u32VCO1 <= HAL_RCC_VCO_MAX_SPEED &&
-                            HAL_RCC_PLL48CLK_SPEED * local_u8PLL48CLKQ == local_u32VCO1)
-                        {
-                            local_u8PLLConfigSuccess = LIB_CONSTANTS_SUCCESS;
-                            goto label;
-                        }
-                    }
-                }
+                // wait till HSE is stable
             }
+            HAL_CM4F_BOOT_PROFILE_MARK(HAL_CM4F_BOOT_STAGE_HSE_READY, 0);
         }
         else
         {
             // do nothing
-            local_u8PLLConfigSuccess = LIB_CONSTANTS_SUCCESS;
         }
 
-    label:
-        local_errState = (local_u8PLLConfigSuccess == LIB_CONSTANTS_SUCCESS) ? local_errState : HAL_RCC_ERR_INVALID_CLK_VAL;
-    }
-    else
-    {
-        // do nothing
-    }
-
-    // main initialization
-    if (local_errState == HAL_RCC_OK)
-    {
-        // configure RCC PLL configuration register
-        local_u32TempReg = global_pRCCReg_t->RCC_PLLCFGR;
-        LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, HAL_RCC_PLLCFGR_PLLQ, local_u8PLL48CLKQ, 4);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_PLLCFGR_PLLSRC, globalConstArr_RCC_PLL_ClockConfig_t[0].PLLClockSource);
-        LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, HAL_RCC_PLLCFGR_PLLP, (local_u8PLLP - 2) / 2, 2);
-        LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, HAL_RCC_PLLCFGR_PLLN, local_u16PLLN, 9);
-        LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, HAL_RCC_PLLCFGR_PLLM, local_u8PLLM, 6);
-        global_pRCCReg_t->RCC_PLLCFGR = local_u32TempReg;
-
-        // configure RCC clock configuration register
+        // configure RCC clock configuration register, prescalers are set before the switch so buses never run over their limits
         local_u32TempReg = global_pRCCReg_t->RCC_CFGR;
         LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, HAL_RCC_CFGR_MCO2, globalConstArr_RCC_MCO_ClockConfig_t[0].MCO2ClockSource, 2);
         LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, HAL_RCC_CFGR_MCO2PRE, globalConstArr_RCC_MCO_ClockConfig_t[0].MCO2Prescalar + 2, 3);
@@ -416,13 +229,7 @@ HAL_RCC_ErrStates_t HAL_RCC_Init()
         }
         global_u32HSEtoRTCClk = globalConstArr_RCC_MiscellaneousConfig_t[0].HSEVal / (local_u32TempVal / 10);
         LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, HAL_RCC_CFGR_RTCPRE, local_u32TempVal / 10, 5);
-        local_u32TempVal = LIB_MATH_BTT_u8GetMSBSetPos(globalConstArr_RCC_SYSCLK_ClockConfig_t[0].AHB_to_APB2_Prescalar);
-        LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, HAL_RCC_CFGR_PPRE2, local_u32TempVal + 3, 3);
-        local_u32TempVal = LIB_MATH_BTT_u8GetMSBSetPos(globalConstArr_RCC_SYSCLK_ClockConfig_t[0].AHB_to_APB1_Prescalar);
-        LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, HAL_RCC_CFGR_PPRE1, local_u32TempVal + 3, 3);
-        local_u32TempVal = LIB_MATH_BTT_u8GetMSBSetPos(globalConstArr_RCC_SYSCLK_ClockConfig_t[0].SYSCLK_to_AHB_Prescalar);
-        LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, HAL_RCC_CFGR_HPRE, local_u32TempVal + 7, 3);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_CFGR_SW, globalConstArr_RCC_SYSCLK_ClockConfig_t[0].SYSClkClockSource);
+        local_u32TempReg = (local_u32TempReg & ~(HAL_RCC_CT_CFGR_MASK & ~HAL_RCC_CFGR_SW_MASK)) | (HAL_RCC_CT_CFGR_IMAGE & ~HAL_RCC_CFGR_SW_MASK);
         global_pRCCReg_t->RCC_CFGR = local_u32TempReg;
 
         // configure RCC clock interrupt register (RCC_CIR)
@@ -442,190 +249,123 @@ HAL_RCC_ErrStates_t HAL_RCC_Init()
 
         // TODO: configure RCC spread spectrum clock generation register
 
-        // configure RCC PLLI2S configuration register
-        local_u32TempReg = global_pRCCReg_t->RCC_PLLI2SCFGR;
-        LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, HAL_RCC_PLLI2SCFGR_PLLI2SR, local_u8PLLI2SR, 3);
-        LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, HAL_RCC_PLLI2SCFGR_PLLI2SN, local_u16PLLI2SN, 9);
-        global_pRCCReg_t->RCC_PLLI2SCFGR = local_u32TempReg;
+        // write the dividers solved at build time, PLLs are stopped first as their configuration registers can't be written while they are on
+        LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLON);
+        LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLI2SON);
+        global_pRCCReg_t->RCC_PLLCFGR = (global_pRCCReg_t->RCC_PLLCFGR & ~HAL_RCC_CT_PLLCFGR_MASK) | HAL_RCC_CT_PLLCFGR_IMAGE;
+        global_pRCCReg_t->RCC_PLLI2SCFGR = (global_pRCCReg_t->RCC_PLLI2SCFGR & ~HAL_RCC_CT_PLLI2SCFGR_MASK) | HAL_RCC_CT_PLLI2SCFGR_IMAGE;
+
+        // turn on the PLLs and wait for them to lock
+        if (HAL_RCC_CT_PLL_USED)
+        {
+            LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLON);
+            while (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLRDY) == 0)
+            {
+                // wait till main PLL is locked
+            }
+        }
+        else
+        {
+            // do nothing
+        }
+        if (HAL_RCC_CFG_PLLI2S_ENABLE)
+        {
+            LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLI2SON);
+            while (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLI2SRDY) == 0)
+            {
+                // wait till PLLI2S is locked
+            }
+        }
+        else
+        {
+            // do nothing
+        }
+        HAL_CM4F_BOOT_PROFILE_MARK(HAL_CM4F_BOOT_STAGE_PLL_LOCKED, 0);
+
+        // switch system clock and wait for the switch to take place
+        HAL_RCC_SwitchSystemClock(HAL_RCC_CFG_SYSCLK_SOURCE);
 
-        // configure RCC clock control register (TODO: enable/disable HSE bypase , adjust calibration)
+        // turn off the unused high speed oscillators (HSI is kept by hardware if it's still used) and enable clock security system
         local_u32TempReg = global_pRCCReg_t->RCC_CR;
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_CR_PLLI2SON, globalConstArr_RCC_ClocksEnable_t[0].PLLI2S_ClkEnable);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_CR_PLLON, globalConstArr_RCC_ClocksEnable_t[0].PLL_ClkEnable);
         LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_CR_CSSON, globalConstArr_RCC_MiscellaneousConfig_t[0].ClockSecurityEnable);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_CR_HSEON, globalConstArr_RCC_ClocksEnable_t[0].HSE_ClkEnable);
         LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_CR_HSION, globalConstArr_RCC_ClocksEnable_t[0].HSI_ClkEnable);
         global_pRCCReg_t->RCC_CR = local_u32TempReg;
 
-        // configure RCC AHB1 peripheral clock enable register
-        local_u32TempReg = global_pRCCReg_t->RCC_AHB1ENR;
-        if (1) // TODO: edit this line with configuration from USB to determine whether to use HS or FS
-        {
-            LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1ENR_OTGHSEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_USB_OTG].EnableInRunMode);
-        }
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1ENR_ETHMACPTPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_ETHERNET].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1ENR_ETHMACRXEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_ETHERNET].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1ENR_ETHMACTXEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_ETHERNET].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1ENR_ETHMACEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_ETHERNET].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1ENR_DMA2EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_DMA2].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1ENR_DMA1EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_DMA1].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1ENR_CCMDATARAMEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_CCM].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1ENR_BKPSRAMEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_BKP_SRAM].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1ENR_CRCEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_CRC].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1ENR_GPIOAEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_GPIOA].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1ENR_GPIOBEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_GPIOB].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1ENR_GPIOCEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_GPIOC].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1ENR_GPIODEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_GPIOD].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1ENR_GPIOEEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_GPIOE].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1ENR_GPIOFEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_GPIOF].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1ENR_GPIOGEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_GPIOG].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1ENR_GPIOHEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_GPIOH].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1ENR_GPIOIEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_GPIOI].EnableInRunMode);
-        global_pRCCReg_t->RCC_AHB1ENR = local_u32TempReg;
-
-        // configure RCC AHB2 peripheral clock enable register
-        local_u32TempReg = global_pRCCReg_t->RCC_AHB2ENR;
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB2ENR_RNGEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_RNG].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB2ENR_HASHEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_HASH].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB2ENR_CRYPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_CRYPTO].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB2ENR_DCMIEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_CAMERA].EnableInRunMode);
-        global_pRCCReg_t->RCC_AHB2ENR = local_u32TempReg;
-
-        // configure RCC AHB3 peripheral clock enable register
-        HAL_RCC_EN_FSMCEN(globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_FSMC].EnableInRunMode);
-
-        // configure RCC APB1 peripheral clock enable register
-        local_u32TempReg = global_pRCCReg_t->RCC_APB1ENR;
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1ENR_DACEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_DAC].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1ENR_PWREN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_PWR].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1ENR_CAN2EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_CAN2].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1ENR_CAN1EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_CAN1].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1ENR_I2C1EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_I2C3].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1ENR_I2C2EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_I2C2].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1ENR_I2C3EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_I2C1].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1ENR_UART5EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_UART5].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1ENR_UART4EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_UART4].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1ENR_USART3EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_USART3].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1ENR_USART2EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_USART2].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1ENR_SPI3EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_SPI3].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1ENR_SPI2EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_SPI2].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1ENR_WWDGEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_WWDG].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1ENR_TIM14EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM14].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1ENR_TIM13EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM13].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1ENR_TIM12EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM12].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1ENR_TIM7EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM7].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1ENR_TIM6EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM6].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1ENR_TIM5EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM5].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1ENR_TIM4EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM4].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1ENR_TIM3EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM3].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1ENR_TIM2EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM2].EnableInRunMode);
-        global_pRCCReg_t->RCC_APB1ENR = local_u32TempReg;
-
-        // Configure RCC APB2 peripheral clock enable register
-        local_u32TempReg = global_pRCCReg_t->RCC_APB2ENR;
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2ENR_TIM11EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM11].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2ENR_TIM10EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM10].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2ENR_TIM9EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM9].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2ENR_SYSCFGEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_SYS_CFG].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2ENR_SPI1EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_SPI1].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2ENR_SDIOEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_SDIO].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2ENR_ADC3EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_ADC3].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2ENR_ADC2EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_ADC2].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2ENR_ADC1EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_ADC1].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2ENR_USART6EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_USART6].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2ENR_USART1EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_USART1].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2ENR_TIM8EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM8].EnableInRunMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2ENR_TIM1EN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM1].EnableInRunMode);
-        global_pRCCReg_t->RCC_APB2ENR = local_u32TempReg;
-
-        // configure RCC AHB1 peripheral clock enable in low power mode register
-        local_u32TempReg = global_pRCCReg_t->RCC_AHB1LPENR;
-        if (1) // TODO: edit this line with configuration from USB to determine whether to use HS or FS
-        {
-            LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1LPENR_OTGHSLPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_USB_OTG].EnableInSleepMode);
-        }
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1LPENR_ETHMACPTPLPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_ETHERNET].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1LPENR_ETHMACRXLPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_ETHERNET].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1LPENR_ETHMACTXLPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_ETHERNET].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1LPENR_ETHMACLPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_ETHERNET].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1LPENR_DMA2LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_DMA2].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1LPENR_DMA1LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_DMA1].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1LPENR_BKPSRAMLPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_BKP_SRAM].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1LPENR_SRAM2LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_SRAM2].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1LPENR_SRAM1LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_SRAM1].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1LPENR_FLITFLPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_FLASH_MEM].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1LPENR_CRCLPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_CRC].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1LPENR_GPIOALPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_GPIOA].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1LPENR_GPIOBLPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_GPIOB].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1LPENR_GPIOCLPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_GPIOC].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1LPENR_GPIODLPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_GPIOD].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1LPENR_GPIOELPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_GPIOE].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1LPENR_GPIOFLPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_GPIOF].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1LPENR_GPIOGLPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_GPIOG].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1LPENR_GPIOHLPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_GPIOH].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1LPENR_GPIOILPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_GPIOI].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB1LPENR_GPIOILPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_GPIOI].EnableInSleepMode);
-        global_pRCCReg_t->RCC_AHB1LPENR = local_u32TempReg;
-
-        // configure RCC AHB2 peripheral clock enable in low power mode register
-        local_u32TempReg = global_pRCCReg_t->RCC_AHB2LPENR;
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB2LPENR_RNGLPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_RNG].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB2LPENR_HASHLPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_HASH].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB2LPENR_CRYPLPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_CRYPTO].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_AHB2LPENR_DCMILPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_CAMERA].EnableInSleepMode);
-        global_pRCCReg_t->RCC_AHB2LPENR = local_u32TempReg;
-
-        // configure RCC AHB3 peripheral clock enable in low power mode register
-        HAL_RCC_LOW_PWR_FSMCLPEN(globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_FSMC].EnableInSleepMode);
-
-        // configure RCC APB1 peripheral clock enable in low power mode register
-        local_u32TempReg = global_pRCCReg_t->RCC_APB1LPENR;
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1LPENR_DACLPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_DAC].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1LPENR_PWRLPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_PWR].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1LPENR_CAN2LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_CAN2].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1LPENR_CAN1LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_CAN1].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1LPENR_I2C3LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_I2C3].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1LPENR_I2C2LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_I2C2].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1LPENR_I2C1LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_I2C1].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1LPENR_UART5LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_UART5].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1LPENR_UART4LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_UART4].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1LPENR_USART3LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_USART3].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1LPENR_USART2LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_USART2].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1LPENR_SPI3LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_SPI3].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1LPENR_SPI2LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_SPI2].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1LPENR_WWDGLPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_WWDG].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1LPENR_TIM14LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM14].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1LPENR_TIM13LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM13].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1LPENR_TIM12LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM12].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1LPENR_TIM7LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM7].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1LPENR_TIM6LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM6].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1LPENR_TIM5LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM5].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1LPENR_TIM4LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM4].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1LPENR_TIM3LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM3].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB1LPENR_TIM2LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM2].EnableInSleepMode);
-        global_pRCCReg_t->RCC_APB1LPENR = local_u32TempReg;
-
-        // configure RCC APB2 peripheral clock enabled in low power mode register
-        local_u32TempReg = global_pRCCReg_t->RCC_APB2LPENR;
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2LPENR_TIM11LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM11].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2LPENR_TIM10LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM10].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2LPENR_TIM9LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM9].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2LPENR_TIM8LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM8].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2LPENR_TIM1LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_TIM1].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2LPENR_SYSCFGLPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_SYS_CFG].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2LPENR_SDIOLPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_SDIO].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2LPENR_ADC3LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_ADC3].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2LPENR_ADC2LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_ADC2].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2LPENR_ADC1LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_ADC1].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2LPENR_USART6LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_USART6].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2LPENR_USART1LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_USART1].EnableInSleepMode);
-        LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_APB2LPENR_USART1LPEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_USART1].EnableInSleepMode);
-        global_pRCCReg_t->RCC_APB2LPENR = local_u32TempReg;
+        // save input frequencies of the peripherals
+        HAL_RCC_UpdatePeripheralClocks();
+        HAL_CM4F_BOOT_PROFILE_MARK(HAL_CM4F_BOOT_STAGE_SYSCLK_SWITCHED, globalArr_RCC_PeripheralClocks_u32[HAL_RCC_PERI_CLK_AHB]);
+
+        // build the run and sleep mode enable images of every bus from the peripheral bits so the registers can't disagree with the clock users
+        for (local_u8Iterator = 0; local_u8Iterator < local_u8PeriArrLen; local_u8Iterator++)
+        {
+            local_pBits_t = &globalConstArr_RCC_PeripheralBits_t[globalConstArr_RCCEnablementConfig_t[local_u8Iterator].PeripheralName];
+            local_u32EnableMasks[local_pBits_t->Bus] |= local_pBits_t->EnableMask;
+            local_u32LowPowerMasks[local_pBits_t->Bus] |= local_pBits_t->LowPowerMask;
+            if (globalConstArr_RCCEnablementConfig_t[local_u8Iterator].EnableInRunMode == LIB_CONSTANTS_ENABLED ||
+                globalArr_RCC_ClockUsers_u8[globalConstArr_RCCEnablementConfig_t[local_u8Iterator].PeripheralName] != 0)
+            {
+                // clocks already acquired (backup SRAM of the reset history) are kept on
+                local_u32EnableImages[local_pBits_t->Bus] |= local_pBits_t->EnableMask;
+            }
+            else
+            {
+                // do nothing
+            }
+            if (globalConstArr_RCCEnablementConfig_t[local_u8Iterator].EnableInSleepMode == LIB_CONSTANTS_ENABLED)
+            {
+                local_u32LowPowerImages[local_pBits_t->Bus] |= local_pBits_t->LowPowerMask;
+            }
+            else
+            {
+                // do nothing
+            }
+        }
+
+        // write every RCC_xxxENR and RCC_xxxLPENR once, bits of the peripherals missing from the configuration are kept as they are
+        for (local_u8Iterator = 0; local_u8Iterator < HAL_RCC_MAX_BUS; local_u8Iterator++)
+        {
+            if (local_u32EnableMasks[local_u8Iterator] != 0)
+            {
+                local_u32TempReg = local_pu32BusReg[local_u8Iterator + HAL_RCC_ENR_OFFSET];
+                local_u32TempReg = (local_u32TempReg & ~local_u32EnableMasks[local_u8Iterator]) | local_u32EnableImages[local_u8Iterator];
+                local_pu32BusReg[local_u8Iterator + HAL_RCC_ENR_OFFSET] = local_u32TempReg;
+            }
+            else
+            {
+                // do nothing
+            }
+            if (local_u32LowPowerMasks[local_u8Iterator] != 0)
+            {
+                local_u32TempReg = local_pu32BusReg[local_u8Iterator + HAL_RCC_LPENR_OFFSET];
+                local_u32TempReg = (local_u32TempReg & ~local_u32LowPowerMasks[local_u8Iterator]) | local_u32LowPowerImages[local_u8Iterator];
+                local_pu32BusReg[local_u8Iterator + HAL_RCC_LPENR_OFFSET] = local_u32TempReg;
+            }
+            else
+            {
+                // do nothing
+            }
+        }
 
         // for backup domain
         LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_BDCR, HAL_RCC_BDCR_RTCEN, globalConstArr_RCCEnablementConfig_t[HAL_RCC_PERIPHERAL_RTC].EnableInRunMode);
+
+        // clocks turned on by the configuration count as one user so an acquire/release pair of a driver never gates them
+        for (local_u8Iterator = 0; local_u8Iterator < local_u8PeriArrLen; local_u8Iterator++)
+        {
+            if (globalConstArr_RCCEnablementConfig_t[local_u8Iterator].EnableInRunMode == LIB_CONSTANTS_ENABLED &&
+                globalArr_RCC_ClockUsers_u8[globalConstArr_RCCEnablementConfig_t[local_u8Iterator].PeripheralName] == 0)
+            {
+                globalArr_RCC_ClockUsers_u8[globalConstArr_RCCEnablementConfig_t[local_u8Iterator].PeripheralName] = 1;
+            }
+            else
+            {
+                // do nothing
+            }
+        }
     }
 
+    HAL_CM4F_BOOT_PROFILE_MARK(HAL_CM4F_BOOT_STAGE_RCC_INIT, 0);
+
     return local_errState;
 }
 
@@ -636,6 +376,9 @@ HAL_RCC_ErrStates_t HAL_RCC_PeripheralModify(const uint8_t argConst_u8Peripheral
 {
     // local used variables
     HAL_RCC_ErrStates_t local_errState = HAL_RCC_OK;
+    uint32_t local_u32Masks[HAL_RCC_MAX_BUS] = {0};
+    uint32_t local_u32LowPowerMasks[HAL_RCC_MAX_BUS] = {0};
+    uint32_t local_u32Primask = 0;
 
     // check for errors
     if (argConst_u8PeripheralName >= HAL_RCC_MAX_PERIPHERAL || argConst_u8Operation >= HAL_RCC_MAX_PERI_OP)
@@ -648,1428 +391,1354 @@ HAL_RCC_ErrStates_t HAL_RCC_PeripheralModify(const uint8_t argConst_u8Peripheral
     }
 
     // main function
-    if (local_errState == HAL_RCC_OK)
+    if (local_errState == HAL_RCC_OK && (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE || argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE))
     {
-        switch (argConst_u8PeripheralName)
-        {
-
-        case HAL_RCC_PERIPHERAL_USB_OTG: // TDDO: check the type of the USB
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_OTGHSRST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_OTGHSEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_OTGHSEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_OTGHSLPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_OTGHSLPEN);
-            }
-            break;
-
-        case HAL_RCC_PERIPHERAL_ETHERNET:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_ETHMACRST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_ETHMACPTPEN);
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_ETHMACRXEN);
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_ETHMACTXEN);
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_ETHMACEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_ETHMACPTPEN);
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_ETHMACRXEN);
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_ETHMACTXEN);
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_ETHMACEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_ETHMACPTPLPEN);
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_ETHMACRXLPEN);
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_ETHMACTXLPEN);
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_ETHMACLPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_ETHMACPTPLPEN);
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_ETHMACRXLPEN);
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_ETHMACTXLPEN);
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_ETHMACLPEN);
-            }
-            break;
+        // enabling and disabling are counted like HAL_RCC_ClockAcquire() and HAL_RCC_ClockRelease() so they never gate a clock still used by a driver
+        HAL_CM4F_ENTER_CRITICAL(local_u32Primask);
+        local_errState = HAL_RCC_UpdateClockUsers(argConst_u8PeripheralName, argConst_u8Operation, local_u32Masks, local_u32LowPowerMasks);
+        HAL_RCC_ApplyPeripheralMasks(local_u32LowPowerMasks, (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE) ? HAL_RCC_PERI_OP_LOW_PWR_ENABLE : HAL_RCC_PERI_OP_LOW_PWR_DISABLE);
+        HAL_RCC_ApplyPeripheralMasks(local_u32Masks, argConst_u8Operation);
+        HAL_CM4F_EXIT_CRITICAL(local_u32Primask);
+    }
+    else if (local_errState == HAL_RCC_OK)
+    {
+        HAL_RCC_AddPeripheralMask(argConst_u8PeripheralName, argConst_u8Operation, local_u32Masks);
+        HAL_RCC_ApplyPeripheralMasks(local_u32Masks, argConst_u8Operation);
+    }
+    else
+    {
+        // do nothing
+    }
 
-        case HAL_RCC_PERIPHERAL_DMA1:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_DMA1RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_DMA1EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_DMA1EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_DMA1LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_DMA1LPEN);
-            }
-            break;
+    return local_errState;
+}
 
-        case HAL_RCC_PERIPHERAL_DMA2:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_DMA2RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_DMA2EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_DMA2EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_DMA2LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_DMA2LPEN);
-            }
-            break;
+/**
+ *
+ */
+HAL_RCC_ErrStates_t HAL_RCC_PeripheralModifyGroup(const uint8_t *const argConst_pu8Peripherals, const uint8_t argConst_u8Count, const uint8_t argConst_u8Operation)
+{
+    // local used variables
+    HAL_RCC_ErrStates_t local_errState = HAL_RCC_OK;
+    HAL_RCC_ErrStates_t local_errStateUsers = HAL_RCC_OK;
+    uint32_t local_u32Masks[HAL_RCC_MAX_BUS] = {0};
+    uint32_t local_u32LowPowerMasks[HAL_RCC_MAX_BUS] = {0};
+    uint32_t local_u32Primask = 0;
+    uint8_t local_u8Iterator = 0;
 
-        case HAL_RCC_PERIPHERAL_CCM:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                // do nothing
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_CCMDATARAMEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_CCMDATARAMEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                // do nothing
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
+    // check for errors
+    if (argConst_pu8Peripherals == NULL || argConst_u8Count == 0 || argConst_u8Operation >= HAL_RCC_MAX_PERI_OP)
+    {
+        local_errState = HAL_RCC_ERR_INVALID_PARAMS;
+    }
+    else
+    {
+        for (local_u8Iterator = 0; local_u8Iterator < argConst_u8Count; local_u8Iterator++)
+        {
+            if (argConst_pu8Peripherals[local_u8Iterator] >= HAL_RCC_MAX_PERIPHERAL)
             {
-                // do nothing
+                local_errState = HAL_RCC_ERR_INVALID_PARAMS;
             }
-            break;
-
-        case HAL_RCC_PERIPHERAL_BKP_SRAM:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
+            else
             {
                 // do nothing
             }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_BKPSRAMEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_BKPSRAMEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_BKPSRAMLPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_BKPSRAMLPEN);
-            }
-            break;
+        }
+    }
 
-        case HAL_RCC_PERIPHERAL_SRAM1:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                // do nothing
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
+    // main function
+    if (local_errState == HAL_RCC_OK && (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE || argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE))
+    {
+        // every peripheral is counted, only the ones whose clock has to change are added to the masks which are then written once
+        HAL_CM4F_ENTER_CRITICAL(local_u32Primask);
+        for (local_u8Iterator = 0; local_u8Iterator < argConst_u8Count; local_u8Iterator++)
+        {
+            local_errStateUsers = HAL_RCC_UpdateClockUsers(argConst_pu8Peripherals[local_u8Iterator], argConst_u8Operation, local_u32Masks, local_u32LowPowerMasks);
+            if (local_errStateUsers != HAL_RCC_OK)
             {
-                // do nothing
+                local_errState = local_errStateUsers;
             }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
+            else
             {
                 // do nothing
             }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_SRAM1LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_SRAM1LPEN);
-            }
-            break;
+        }
+        HAL_RCC_ApplyPeripheralMasks(local_u32LowPowerMasks, (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE) ? HAL_RCC_PERI_OP_LOW_PWR_ENABLE : HAL_RCC_PERI_OP_LOW_PWR_DISABLE);
+        HAL_RCC_ApplyPeripheralMasks(local_u32Masks, argConst_u8Operation);
+        HAL_CM4F_EXIT_CRITICAL(local_u32Primask);
+    }
+    else if (local_errState == HAL_RCC_OK)
+    {
+        for (local_u8Iterator = 0; local_u8Iterator < argConst_u8Count; local_u8Iterator++)
+        {
+            HAL_RCC_AddPeripheralMask(argConst_pu8Peripherals[local_u8Iterator], argConst_u8Operation, local_u32Masks);
+        }
+        HAL_RCC_ApplyPeripheralMasks(local_u32Masks, argConst_u8Operation);
+    }
+    else
+    {
+        // do nothing
+    }
 
-        case HAL_RCC_PERIPHERAL_SRAM2:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                // do nothing
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                // do nothing
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                // do nothing
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_SRAM2LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_SRAM2LPEN);
-            }
-            break;
+    return local_errState;
+}
 
-        case HAL_RCC_PERIPHERAL_CRC:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_CRCRST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_CRCEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_CRCEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_CRCLPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_CRCLPEN);
-            }
-            break;
+/**
+ *
+ */
+HAL_RCC_ErrStates_t HAL_RCC_ClockAcquire(const uint8_t argConst_u8PeripheralName)
+{
+    // local used variables
+    HAL_RCC_ErrStates_t local_errState = HAL_RCC_OK;
+    uint32_t local_u32EnableMasks[HAL_RCC_MAX_BUS] = {0};
+    uint32_t local_u32LowPowerMasks[HAL_RCC_MAX_BUS] = {0};
+    uint32_t local_u32Primask = 0;
 
-        case HAL_RCC_PERIPHERAL_GPIOA:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_GPIOARST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIOAEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIOAEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIOALPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIOALPEN);
-            }
-            break;
+    // check for errors
+    if (argConst_u8PeripheralName >= HAL_RCC_MAX_PERIPHERAL)
+    {
+        local_errState = HAL_RCC_ERR_INVALID_PARAMS;
+    }
+    else
+    {
+        // do nothing
+    }
 
-        case HAL_RCC_PERIPHERAL_GPIOB:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_GPIOBRST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIOBEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIOBEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIOBLPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIOBLPEN);
-            }
-            break;
+    // main function
+    if (local_errState == HAL_RCC_OK)
+    {
+        // first user turns the clock on, it keeps running in sleep mode as long as it's used
+        HAL_CM4F_ENTER_CRITICAL(local_u32Primask);
+        local_errState = HAL_RCC_UpdateClockUsers(argConst_u8PeripheralName, HAL_RCC_PERI_OP_ENABLE, local_u32EnableMasks, local_u32LowPowerMasks);
+        HAL_RCC_ApplyPeripheralMasks(local_u32EnableMasks, HAL_RCC_PERI_OP_ENABLE);
+        HAL_RCC_ApplyPeripheralMasks(local_u32LowPowerMasks, HAL_RCC_PERI_OP_LOW_PWR_ENABLE);
+        HAL_CM4F_EXIT_CRITICAL(local_u32Primask);
+    }
+    else
+    {
+        // do nothing
+    }
 
-        case HAL_RCC_PERIPHERAL_GPIOC:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_GPIOCRST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIOCEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIOCEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIOCLPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIOCLPEN);
-            }
-            break;
+    return local_errState;
+}
 
-        case HAL_RCC_PERIPHERAL_GPIOD:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_GPIODRST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIODEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIODEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIODLPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIODLPEN);
-            }
-            break;
+/**
+ *
+ */
+HAL_RCC_ErrStates_t HAL_RCC_ClockRelease(const uint8_t argConst_u8PeripheralName)
+{
+    // local used variables
+    HAL_RCC_ErrStates_t local_errState = HAL_RCC_OK;
+    uint32_t local_u32EnableMasks[HAL_RCC_MAX_BUS] = {0};
+    uint32_t local_u32LowPowerMasks[HAL_RCC_MAX_BUS] = {0};
+    uint32_t local_u32Primask = 0;
 
-        case HAL_RCC_PERIPHERAL_GPIOE:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_GPIOERST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIOEEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIOEEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIOELPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIOELPEN);
-            }
-            break;
+    // check for errors
+    if (argConst_u8PeripheralName >= HAL_RCC_MAX_PERIPHERAL)
+    {
+        local_errState = HAL_RCC_ERR_INVALID_PARAMS;
+    }
+    else
+    {
+        // do nothing
+    }
 
-        case HAL_RCC_PERIPHERAL_GPIOF:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_GPIOFRST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIOFEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIOFEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIOFLPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIOFLPEN);
-            }
-            break;
+    // main function
+    if (local_errState == HAL_RCC_OK)
+    {
+        // last user gates the clock in both run and sleep modes
+        HAL_CM4F_ENTER_CRITICAL(local_u32Primask);
+        local_errState = HAL_RCC_UpdateClockUsers(argConst_u8PeripheralName, HAL_RCC_PERI_OP_DISABLE, local_u32EnableMasks, local_u32LowPowerMasks);
+        HAL_RCC_ApplyPeripheralMasks(local_u32LowPowerMasks, HAL_RCC_PERI_OP_LOW_PWR_DISABLE);
+        HAL_RCC_ApplyPeripheralMasks(local_u32EnableMasks, HAL_RCC_PERI_OP_DISABLE);
+        HAL_CM4F_EXIT_CRITICAL(local_u32Primask);
+    }
+    else
+    {
+        // do nothing
+    }
 
-        case HAL_RCC_PERIPHERAL_GPIOG:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_GPIOGRST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIOGEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIOGEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIOGLPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIOGLPEN);
-            }
-            break;
+    return local_errState;
+}
 
-        case HAL_RCC_PERIPHERAL_GPIOH:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_GPIOHRST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIOHEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIOHEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIOHLPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIOHLPEN);
-            }
-            break;
+/**
+ *
+ */
+HAL_RCC_ErrStates_t HAL_RCC_RetryHSE(void)
+{
+    // local used variables
+    HAL_RCC_ErrStates_t local_errState = HAL_RCC_OK;
+    uint32_t local_u32Timeout = HAL_RCC_CFG_HSE_STARTUP_TIMEOUT;
 
-        case HAL_RCC_PERIPHERAL_GPIOI:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_GPIOIRST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIOIEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIOIEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIOILPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIOILPEN);
-            }
-            break;
+    // check for errors
+    if (global_u8HSEFailed == LIB_CONSTANTS_FAIL)
+    {
+        // do nothing (HSE is healthy)
+    }
+    else
+    {
+        LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_HSEON);
+        while (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_HSERDY) == 0 && local_u32Timeout > 0)
+        {
+            local_u32Timeout--;
+        }
+        if (local_u32Timeout == 0)
+        {
+            LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_HSEON);
+            local_errState = HAL_RCC_ERR_HSE_NOT_READY;
+        }
+        else
+        {
+            // do nothing
+        }
+    }
 
-        case HAL_RCC_PERIPHERAL_RNG:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB2RSTR, HAL_RCC_AHB2RSTR_RNGRST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB2ENR, HAL_RCC_AHB2ENR_RNGEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB2ENR, HAL_RCC_AHB2ENR_RNGEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB2LPENR, HAL_RCC_AHB2LPENR_RNGLPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB2LPENR, HAL_RCC_AHB2LPENR_RNGLPEN);
-            }
-            break;
+    // main function
+    if (local_errState == HAL_RCC_OK && global_u8HSEFailed == LIB_CONSTANTS_SUCCESS)
+    {
+        HAL_RCC_NotifyRateChange(globalArr_RCC_PreRateNotifiers_t);
+
+        // leave the PLL before it's rebuilt from HSE
+        HAL_RCC_SwitchSystemClock(HAL_RCC_SYSCLK_CLK_SRC_HSI);
+        HAL_RCC_RestartPLL(global_u32HSEPLLConfig, global_u32HSEPLLI2SConfig);
+        HAL_RCC_SwitchSystemClock(global_u8HSESystemClockSource);
+        LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_CSSON, globalConstArr_RCC_MiscellaneousConfig_t[0].ClockSecurityEnable);
+        LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_HSION, globalConstArr_RCC_ClocksEnable_t[0].HSI_ClkEnable);
+
+        global_u32SystemClock = global_u32HSESystemClock;
+        global_u8HSEFailed = LIB_CONSTANTS_FAIL;
+        HAL_RCC_UpdatePeripheralClocks();
+
+        HAL_RCC_NotifyRateChange(globalArr_RCC_PostRateNotifiers_t);
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_RCC_ErrStates_t HAL_RCC_CalibrateHSI(const uint32_t argConst_u32MaxErrorPPM, int32_t *const arg_Constps32ErrorPPM)
+{
+    // local used variables
+    HAL_RCC_ErrStates_t local_errState = HAL_RCC_OK;
+    uint32_t local_u32TimerClock = globalArr_RCC_PeripheralClocks_u32[HAL_RCC_PERI_CLK_APB1_TIMER];
+    uint32_t local_u32ExpectedTicks = 0;
+    uint32_t local_u32MeasuredTicks = 0;
+    uint32_t local_u32SavedRegs[6] = {0};
+    int32_t local_s32ErrorPPM = 0;
+    int32_t local_s32PrevErrorPPM = 0;
+    int32_t local_s32BestErrorPPM = 0x7FFFFFFF;
+    uint8_t local_u8Trim = (uint8_t)((global_pRCCReg_t->RCC_CR >> HAL_RCC_CR_HSITRIM) & HAL_RCC_HSITRIM_MAX);
+    uint8_t local_u8BestTrim = local_u8Trim;
+    uint8_t local_u8Done = LIB_CONSTANTS_FAIL;
+    uint8_t local_u8Iterator = 0;
+
+    // check for errors
+    if (arg_Constps32ErrorPPM == NULL)
+    {
+        local_errState = HAL_RCC_ERR_INVALID_PARAMS;
+    }
+    // TIM5 has to be clocked from HSI to be measured against LSE
+    else if (!(global_u8SystemClockSource == HAL_RCC_SYSCLK_CLK_SRC_HSI ||
+               (global_u8SystemClockSource == HAL_RCC_SYSCLK_CLK_SRC_PLL && LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_PLLCFGR, HAL_RCC_PLLCFGR_PLLSRC) == 0)))
+    {
+        local_errState = HAL_RCC_ERR_INVALID_CONFIG;
+    }
+    else if (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_BDCR, HAL_RCC_BDCR_LSERDY) == 0)
+    {
+        local_errState = HAL_RCC_ERR_LSE_NOT_READY;
+    }
+    else
+    {
+        // do nothing
+    }
 
-        case HAL_RCC_PERIPHERAL_HASH:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
+    // main function
+    if (local_errState == HAL_RCC_OK)
+    {
+        // ticks of TIM5 in (8 * captures) LSE periods if HSI is exactly 16 MHZ, computed without overflowing 32 bits
+        local_u32ExpectedTicks = ((local_u32TimerClock / (HAL_RCC_LSE_SPEED / HAL_RCC_TIM5_LSE_EDGES_PER_CAPTURE)) * HAL_RCC_CFG_HSI_TRIM_CAPTURES) +
+                                 (((local_u32TimerClock % (HAL_RCC_LSE_SPEED / HAL_RCC_TIM5_LSE_EDGES_PER_CAPTURE)) * HAL_RCC_CFG_HSI_TRIM_CAPTURES) / (HAL_RCC_LSE_SPEED / HAL_RCC_TIM5_LSE_EDGES_PER_CAPTURE));
+
+        // TIM5 is borrowed so its configuration is saved and restored
+        HAL_RCC_ClockAcquire(HAL_RCC_PERIPHERAL_TIM5);
+        local_u32SavedRegs[0] = HAL_RCC_TIM5_REG(HAL_RCC_TIM5_CR1);
+        local_u32SavedRegs[1] = HAL_RCC_TIM5_REG(HAL_RCC_TIM5_CCMR2);
+        local_u32SavedRegs[2] = HAL_RCC_TIM5_REG(HAL_RCC_TIM5_CCER);
+        local_u32SavedRegs[3] = HAL_RCC_TIM5_REG(HAL_RCC_TIM5_PSC);
+        local_u32SavedRegs[4] = HAL_RCC_TIM5_REG(HAL_RCC_TIM5_ARR);
+        local_u32SavedRegs[5] = HAL_RCC_TIM5_REG(HAL_RCC_TIM5_OR);
+
+        HAL_RCC_TIM5_REG(HAL_RCC_TIM5_CR1) = 0;
+        HAL_RCC_TIM5_REG(HAL_RCC_TIM5_CCER) = 0;
+        HAL_RCC_TIM5_REG(HAL_RCC_TIM5_OR) = HAL_RCC_TIM5_OR_TI4_LSE;
+        HAL_RCC_TIM5_REG(HAL_RCC_TIM5_CCMR2) = HAL_RCC_TIM5_CCMR2_IC4_LSE;
+        HAL_RCC_TIM5_REG(HAL_RCC_TIM5_CCER) = HAL_RCC_TIM5_CCER_CC4E;
+        HAL_RCC_TIM5_REG(HAL_RCC_TIM5_PSC) = 0;
+        HAL_RCC_TIM5_REG(HAL_RCC_TIM5_ARR) = 0xFFFFFFFFUL;
+        HAL_RCC_TIM5_REG(HAL_RCC_TIM5_EGR) = HAL_RCC_TIM5_EGR_UG;
+        HAL_RCC_TIM5_REG(HAL_RCC_TIM5_CR1) = HAL_RCC_TIM5_CR1_CEN;
+
+        // HSI speed rises with HSITRIM, walk towards the target and stop once the error changes sign
+        for (local_u8Iterator = 0; local_u8Iterator <= HAL_RCC_HSITRIM_MAX && local_errState == HAL_RCC_OK && local_u8Done == LIB_CONSTANTS_FAIL; local_u8Iterator++)
+        {
+            local_errState = HAL_RCC_MeasureHSI(&local_u32MeasuredTicks);
+            if (local_errState == HAL_RCC_OK)
             {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB2RSTR, HAL_RCC_AHB2RSTR_HASHRST);
+                // 100 ppm resolution keeps the product within 32 bits, HSITRIM step is about 0.5 %
+                local_s32ErrorPPM = (((int32_t)(local_u32MeasuredTicks - local_u32ExpectedTicks) * 10000) / (int32_t)local_u32ExpectedTicks) * 100;
+                if ((local_s32ErrorPPM < 0 ? -local_s32ErrorPPM : local_s32ErrorPPM) < (local_s32BestErrorPPM < 0 ? -local_s32BestErrorPPM : local_s32BestErrorPPM))
+                {
+                    local_s32BestErrorPPM = local_s32ErrorPPM;
+                    local_u8BestTrim = local_u8Trim;
+                }
+                else
+                {
+                    // do nothing
+                }
+
+                if ((uint32_t)(local_s32ErrorPPM < 0 ? -local_s32ErrorPPM : local_s32ErrorPPM) <= argConst_u32MaxErrorPPM ||
+                    (local_u8Iterator != 0 && (local_s32ErrorPPM < 0) != (local_s32PrevErrorPPM < 0)) ||
+                    (local_s32ErrorPPM > 0 && local_u8Trim == 0) || (local_s32ErrorPPM < 0 && local_u8Trim == HAL_RCC_HSITRIM_MAX))
+                {
+                    local_u8Done = LIB_CONSTANTS_SUCCESS;
+                }
+                else
+                {
+                    local_u8Trim = (local_s32ErrorPPM > 0) ? (local_u8Trim - 1) : (local_u8Trim + 1);
+                    LIB_MATH_BTT_ASSIGN_BITS(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_HSITRIM, local_u8Trim, 5);
+                    local_s32PrevErrorPPM = local_s32ErrorPPM;
+                }
             }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
+            else
             {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB2ENR, HAL_RCC_AHB2ENR_HASHEN);
+                // do nothing
             }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
+        }
+
+        LIB_MATH_BTT_ASSIGN_BITS(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_HSITRIM, local_u8BestTrim, 5);
+
+        HAL_RCC_TIM5_REG(HAL_RCC_TIM5_CR1) = 0;
+        HAL_RCC_TIM5_REG(HAL_RCC_TIM5_CCER) = 0;
+        HAL_RCC_TIM5_REG(HAL_RCC_TIM5_CCMR2) = local_u32SavedRegs[1];
+        HAL_RCC_TIM5_REG(HAL_RCC_TIM5_CCER) = local_u32SavedRegs[2];
+        HAL_RCC_TIM5_REG(HAL_RCC_TIM5_PSC) = local_u32SavedRegs[3];
+        HAL_RCC_TIM5_REG(HAL_RCC_TIM5_ARR) = local_u32SavedRegs[4];
+        HAL_RCC_TIM5_REG(HAL_RCC_TIM5_OR) = local_u32SavedRegs[5];
+        HAL_RCC_TIM5_REG(HAL_RCC_TIM5_CR1) = local_u32SavedRegs[0];
+        HAL_RCC_ClockRelease(HAL_RCC_PERIPHERAL_TIM5);
+
+        if (local_errState == HAL_RCC_OK)
+        {
+            *arg_Constps32ErrorPPM = local_s32BestErrorPPM;
+            if ((uint32_t)(local_s32BestErrorPPM < 0 ? -local_s32BestErrorPPM : local_s32BestErrorPPM) > argConst_u32MaxErrorPPM)
             {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB2ENR, HAL_RCC_AHB2ENR_HASHEN);
+                local_errState = HAL_RCC_ERR_HSI_NOT_TRIMMED;
             }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
+            else
             {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB2LPENR, HAL_RCC_AHB2LPENR_HASHLPEN);
+                // do nothing
             }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB2LPENR, HAL_RCC_AHB2LPENR_HASHLPEN);
-            }
-            break;
+        }
+        else
+        {
+            // do nothing
+        }
+    }
+    else
+    {
+        // do nothing
+    }
 
-        case HAL_RCC_PERIPHERAL_CRYPTO:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB2RSTR, HAL_RCC_AHB2RSTR_CRYPRST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB2ENR, HAL_RCC_AHB2ENR_CRYPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB2ENR, HAL_RCC_AHB2ENR_CRYPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB2LPENR, HAL_RCC_AHB2LPENR_CRYPLPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB2LPENR, HAL_RCC_AHB2LPENR_CRYPLPEN);
-            }
-            break;
+    return local_errState;
+}
 
-        case HAL_RCC_PERIPHERAL_CAMERA:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB2RSTR, HAL_RCC_AHB2RSTR_DCMIRST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB2ENR, HAL_RCC_AHB2ENR_DCMIEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB2ENR, HAL_RCC_AHB2ENR_DCMIEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB2LPENR, HAL_RCC_AHB2LPENR_DCMILPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB2LPENR, HAL_RCC_AHB2LPENR_DCMILPEN);
-            }
-            break;
+/**
+ *
+ */
+HAL_RCC_ErrStates_t HAL_RCC_SolveI2SClock(const uint32_t argConst_u32SampleRate, const uint8_t argConst_u8Frame, const uint8_t argConst_u8MCLKEnable, HAL_RCC_I2SClock_t *const arg_constpI2SClock)
+{
+    // local used variables
+    HAL_RCC_ErrStates_t local_errState = HAL_RCC_OK;
+    uint32_t local_u32PLLConfig = global_pRCCReg_t->RCC_PLLCFGR;
+    uint32_t local_u32SourceSpeed = (LIB_MATH_BTT_GET_BIT(local_u32PLLConfig, HAL_RCC_PLLCFGR_PLLSRC) == 1) ? HAL_RCC_CFG_HSE_VALUE : HAL_RCC_HSI_SPEED;
+    uint32_t local_u32Ratio = 0;
+    uint32_t local_u32VCO = 0;
+    uint32_t local_u32Prescaler = 0;
+    uint64_t local_u64Numerator = 0;
+    uint64_t local_u64Denominator = 0;
+    int64_t local_s64ErrorPPB = 0;
+    int64_t local_s64BestErrorPPB = 0x7FFFFFFFFFFFFFFFLL;
+    uint16_t local_u16PLLI2SN = 0;
+    uint8_t local_u8PLLM = (uint8_t)((local_u32PLLConfig >> HAL_RCC_PLLCFGR_PLLM) & 0x3FUL);
+    uint8_t local_u8PLLI2SR = 0;
+    uint8_t local_u8Found = LIB_CONSTANTS_FAIL;
 
-        case HAL_RCC_PERIPHERAL_FSMC:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB3RSTR, HAL_RCC_AHB3RSTR_FSMCRST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB3ENR, HAL_RCC_AHB3ENR_FSMCEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB3ENR, HAL_RCC_AHB3ENR_FSMCEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB3LPENR, HAL_RCC_AHB3LPENR_FSMCLPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB3LPENR, HAL_RCC_AHB3LPENR_FSMCLPEN);
-            }
-            break;
+    // check for errors
+    if (arg_constpI2SClock == NULL || argConst_u32SampleRate < HAL_RCC_I2S_MIN_SAMPLE_RATE || argConst_u32SampleRate > HAL_RCC_I2S_MAX_SAMPLE_RATE ||
+        argConst_u8Frame >= HAL_RCC_MAX_I2S_FRAME || argConst_u8MCLKEnable >= LIB_CONSTANTS_MAX_DRIVER_STATE)
+    {
+        local_errState = HAL_RCC_ERR_INVALID_PARAMS;
+    }
+    else if (local_u8PLLM < HAL_RCC_PLLM_MIN)
+    {
+        local_errState = HAL_RCC_ERR_INVALID_CONFIG;
+    }
+    else
+    {
+        // do nothing
+    }
 
-        case HAL_RCC_PERIPHERAL_DAC:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_DACRST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_DACEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_DACEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_DACLPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_DACLPEN);
-            }
-            break;
+    // main function
+    if (local_errState == HAL_RCC_OK)
+    {
+        if (argConst_u8MCLKEnable == LIB_CONSTANTS_ENABLED)
+        {
+            local_u32Ratio = HAL_RCC_I2S_MCLK_RATIO;
+        }
+        else if (argConst_u8Frame == HAL_RCC_I2S_FRAME_16BIT)
+        {
+            local_u32Ratio = HAL_RCC_I2S_FRAME_16BIT_RATIO;
+        }
+        else
+        {
+            local_u32Ratio = HAL_RCC_I2S_FRAME_32BIT_RATIO;
+        }
 
-        case HAL_RCC_PERIPHERAL_PWR:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_PWRRST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_PWREN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_PWREN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_PWRLPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_PWRLPEN);
-            }
-            break;
+        // I2S clock = source * N / (M * R) and Fs = I2S clock / (ratio * prescaler), the search stops at the first exact match
+        for (local_u16PLLI2SN = HAL_RCC_PLLI2SN_MIN; local_u16PLLI2SN <= HAL_RCC_PLLI2SN_MAX && local_s64BestErrorPPB != 0; local_u16PLLI2SN++)
+        {
+            local_u64Numerator = (uint64_t)local_u32SourceSpeed * local_u16PLLI2SN;
+            local_u32VCO = (uint32_t)(local_u64Numerator / local_u8PLLM);
 
-        case HAL_RCC_PERIPHERAL_CAN1:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_CAN1RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_CAN1EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_CAN1EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
+            for (local_u8PLLI2SR = HAL_RCC_PLLI2SR_MIN; local_u8PLLI2SR <= HAL_RCC_PLLI2SR_MAX && local_s64BestErrorPPB != 0 &&
+                                                        local_u32VCO >= HAL_RCC_VCO_MIN_SPEED && local_u32VCO <= HAL_RCC_VCO_MAX_SPEED;
+                 local_u8PLLI2SR++)
             {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_CAN1LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_CAN1LPEN);
-            }
-            break;
+                if (local_u32VCO / local_u8PLLI2SR <= HAL_RCC_PLLI2S_MAX_SPEED)
+                {
+                    // nearest prescaler, limited to what I2SDIV and ODD can hold
+                    local_u64Denominator = (uint64_t)local_u8PLLM * local_u8PLLI2SR * argConst_u32SampleRate * local_u32Ratio;
+                    local_u32Prescaler = (uint32_t)((local_u64Numerator + (local_u64Denominator / 2)) / local_u64Denominator);
+                    local_u32Prescaler = (local_u32Prescaler < HAL_RCC_I2S_PRESCALER_MIN) ? HAL_RCC_I2S_PRESCALER_MIN : local_u32Prescaler;
+                    local_u32Prescaler = (local_u32Prescaler > HAL_RCC_I2S_PRESCALER_MAX) ? HAL_RCC_I2S_PRESCALER_MAX : local_u32Prescaler;
 
-        case HAL_RCC_PERIPHERAL_CAN2:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_CAN2RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_CAN2EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_CAN2EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_CAN2LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_CAN2LPEN);
-            }
-            break;
+                    // error = (numerator - denominator * prescaler) / (denominator * prescaler), kept in ppb so that sub ppm matches are ordered too
+                    local_u64Denominator *= local_u32Prescaler;
+                    local_s64ErrorPPB = (((int64_t)local_u64Numerator - (int64_t)local_u64Denominator) * 1000000) / (int64_t)(local_u64Denominator / 1000);
 
-        case HAL_RCC_PERIPHERAL_I2C1:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_I2C1RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_I2C1EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_I2C1EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_I2C1LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_I2C1LPEN);
+                    if ((local_s64ErrorPPB < 0 ? -local_s64ErrorPPB : local_s64ErrorPPB) < (local_s64BestErrorPPB < 0 ? -local_s64BestErrorPPB : local_s64BestErrorPPB))
+                    {
+                        local_s64BestErrorPPB = local_s64ErrorPPB;
+                        arg_constpI2SClock->PLLI2SN = local_u16PLLI2SN;
+                        arg_constpI2SClock->PLLI2SR = local_u8PLLI2SR;
+                        arg_constpI2SClock->I2SDIV = (uint8_t)(local_u32Prescaler / 2);
+                        arg_constpI2SClock->I2SODD = (uint8_t)(local_u32Prescaler & 1UL);
+                        local_u8Found = LIB_CONSTANTS_SUCCESS;
+                    }
+                    else
+                    {
+                        // do nothing
+                    }
+                }
+                else
+                {
+                    // do nothing
+                }
             }
-            break;
+        }
 
-        case HAL_RCC_PERIPHERAL_I2C2:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_I2C2RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_I2C2EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_I2C2EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_I2C2LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_I2C2LPEN);
-            }
-            break;
+        if (local_u8Found == LIB_CONSTANTS_SUCCESS)
+        {
+            arg_constpI2SClock->ErrorPPM = (int32_t)(local_s64BestErrorPPB / 1000);
+        }
+        else
+        {
+            local_errState = HAL_RCC_ERR_INVALID_CLK_VAL;
+        }
+    }
+    else
+    {
+        // do nothing
+    }
 
-        case HAL_RCC_PERIPHERAL_I2C3:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_I2C3RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_I2C3EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_I2C3EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_I2C3LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_I2C3LPEN);
-            }
-            break;
+    return local_errState;
+}
 
-        case HAL_RCC_PERIPHERAL_USART1:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2RSTR, HAL_RCC_APB2RSTR_USART1RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_USART1EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_USART1EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_USART1LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_USART1LPEN);
-            }
-            break;
+/**
+ *
+ */
+HAL_RCC_ErrStates_t HAL_RCC_SetI2SClock(const HAL_RCC_I2SClock_t *const argConst_pI2SClock)
+{
+    // local used variables
+    HAL_RCC_ErrStates_t local_errState = HAL_RCC_OK;
+    uint32_t local_u32PLLConfig = global_pRCCReg_t->RCC_PLLCFGR;
+    uint32_t local_u32SourceSpeed = (LIB_MATH_BTT_GET_BIT(local_u32PLLConfig, HAL_RCC_PLLCFGR_PLLSRC) == 1) ? HAL_RCC_CFG_HSE_VALUE : HAL_RCC_HSI_SPEED;
+    uint32_t local_u32VCO = 0;
+    uint32_t local_u32TempReg = 0;
+    uint8_t local_u8PLLM = (uint8_t)((local_u32PLLConfig >> HAL_RCC_PLLCFGR_PLLM) & 0x3FUL);
 
-        case HAL_RCC_PERIPHERAL_USART2:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_USART2RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_USART2EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_USART2EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_USART2LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_USART2LPEN);
-            }
-            break;
+    // check for errors
+    if (argConst_pI2SClock == NULL)
+    {
+        local_errState = HAL_RCC_ERR_INVALID_PARAMS;
+    }
+    else if (argConst_pI2SClock->PLLI2SN < HAL_RCC_PLLI2SN_MIN || argConst_pI2SClock->PLLI2SN > HAL_RCC_PLLI2SN_MAX ||
+             argConst_pI2SClock->PLLI2SR < HAL_RCC_PLLI2SR_MIN || argConst_pI2SClock->PLLI2SR > HAL_RCC_PLLI2SR_MAX)
+    {
+        local_errState = HAL_RCC_ERR_INVALID_PARAMS;
+    }
+    else if (local_u8PLLM < HAL_RCC_PLLM_MIN)
+    {
+        local_errState = HAL_RCC_ERR_INVALID_CONFIG;
+    }
+    else
+    {
+        // PLLI2S shares the source and M of the main PLL so the VCO is checked against what's running (same limits as HAL_RCC_SolveI2SClock())
+        local_u32VCO = (uint32_t)(((uint64_t)local_u32SourceSpeed * argConst_pI2SClock->PLLI2SN) / local_u8PLLM);
+        if (local_u32VCO < HAL_RCC_VCO_MIN_SPEED || local_u32VCO > HAL_RCC_VCO_MAX_SPEED || local_u32VCO / argConst_pI2SClock->PLLI2SR > HAL_RCC_PLLI2S_MAX_SPEED)
+        {
+            local_errState = HAL_RCC_ERR_INVALID_CLK_VAL;
+        }
+        else
+        {
+            // do nothing
+        }
+    }
 
-        case HAL_RCC_PERIPHERAL_USART3:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_USART3RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_USART3EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_USART3EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_USART3LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_USART3LPEN);
-            }
-            break;
+    // main function
+    if (local_errState == HAL_RCC_OK)
+    {
+        // PLLI2S dividers can only be written while it's stopped
+        LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLI2SON);
+        while (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLI2SRDY) == 1)
+        {
+            // wait till PLLI2S is stopped
+        }
 
-        case HAL_RCC_PERIPHERAL_UART4:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_UART4RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_UART4EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_UART4EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_UART4LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_UART4LPEN);
-            }
-            break;
+        local_u32TempReg = global_pRCCReg_t->RCC_PLLI2SCFGR;
+        LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, HAL_RCC_PLLI2SCFGR_PLLI2SR, argConst_pI2SClock->PLLI2SR, 3);
+        LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, HAL_RCC_PLLI2SCFGR_PLLI2SN, argConst_pI2SClock->PLLI2SN, 9);
+        global_pRCCReg_t->RCC_PLLI2SCFGR = local_u32TempReg;
+        LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_CFGR, HAL_RCC_CFGR_I2SSRC);
 
-        case HAL_RCC_PERIPHERAL_UART5:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_UART5RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_UART5EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_UART5EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_UART5LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_UART5LPEN);
-            }
-            break;
+        LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLI2SON);
+        while (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLI2SRDY) == 0)
+        {
+            // wait till PLLI2S is locked
+        }
+    }
+    else
+    {
+        // do nothing
+    }
 
-        case HAL_RCC_PERIPHERAL_USART6:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2RSTR, HAL_RCC_APB2RSTR_USART6RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_USART6EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_USART6EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_USART6LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_USART6LPEN);
-            }
-            break;
+    return local_errState;
+}
 
-        case HAL_RCC_PERIPHERAL_SPI1:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2RSTR, HAL_RCC_APB2RSTR_SPI1RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_SPI1EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_SPI1EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_SPI1LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_SPI1LPEN);
-            }
-            break;
+/**
+ *
+ */
+HAL_RCC_ErrStates_t HAL_RCC_GetResetFlags(uint8_t *const arg_Constpu8Flags)
+{
+    // local used variables
+    HAL_RCC_ErrStates_t local_errState = HAL_RCC_OK;
 
-        case HAL_RCC_PERIPHERAL_SPI2:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_SPI2RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_SPI2EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_SPI2EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_SPI2LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_SPI2LPEN);
-            }
-            break;
+    // check for errors
+    if (arg_Constpu8Flags == NULL)
+    {
+        local_errState = HAL_RCC_ERR_INVALID_PARAMS;
+    }
 
-        case HAL_RCC_PERIPHERAL_SPI3:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_SPI3RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_SPI3EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_SPI3EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_SPI3LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_SPI3LPEN);
-            }
-            break;
+    // main function
+    if (local_errState == HAL_RCC_OK)
+    {
+        HAL_RCC_ReadResetFlags();
+        *arg_Constpu8Flags = global_u8ResetFlags;
+    }
 
-        case HAL_RCC_PERIPHERAL_WWDG:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_WWDGRST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_WWDGEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_WWDGEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_WWDGLPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_WWDGLPEN);
-            }
-            break;
+    return local_errState;
+}
 
-        case HAL_RCC_PERIPHERAL_TIM1:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2RSTR, HAL_RCC_APB2RSTR_TIM1RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_TIM1EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_TIM1EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_TIM1LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_TIM1LPEN);
-            }
-            break;
+/**
+ *
+ */
+HAL_RCC_ErrStates_t HAL_RCC_SaveFaultContext(const uint32_t argConst_u32PC)
+{
+    // local used variables
+    HAL_RCC_ErrStates_t local_errState = HAL_RCC_OK;
 
-        case HAL_RCC_PERIPHERAL_TIM2:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_TIM2RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM2EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM2EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM2LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM2LPEN);
-            }
-            break;
+    // check for errors
+    if (HAL_RCC_CFG_RESET_HISTORY_ENABLE == 0)
+    {
+        local_errState = HAL_RCC_ERR_INVALID_CONFIG;
+    }
 
-        case HAL_RCC_PERIPHERAL_TIM3:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_TIM3RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM3EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM3EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM3LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM3LPEN);
-            }
-            break;
+    // main function
+    if (local_errState == HAL_RCC_OK)
+    {
+        HAL_RCC_EnableBackupSRAM();
+        global_pRCCResetHistory_t->FaultPC = argConst_u32PC;
+        global_pRCCResetHistory_t->FaultCFSR = global_pSCBReg_t->CFSR;
+        global_pRCCResetHistory_t->FaultHFSR = global_pSCBReg_t->HFSR;
 
-        case HAL_RCC_PERIPHERAL_TIM4:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_TIM4RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM4EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM4EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM4LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM4LPEN);
-            }
-            break;
+        // context is marked valid at last so a reset in the middle never leaves a half saved context
+        global_pRCCResetHistory_t->FaultValid = LIB_CONSTANTS_SUCCESS;
+    }
 
-        case HAL_RCC_PERIPHERAL_TIM5:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_TIM5RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM5EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM5EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM5LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM5LPEN);
-            }
-            break;
+    return local_errState;
+}
 
-        case HAL_RCC_PERIPHERAL_TIM6:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_TIM6RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM6EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM6EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM6LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM6LPEN);
-            }
-            break;
+/**
+ *
+ */
+HAL_RCC_ErrStates_t HAL_RCC_GetResetHistory(const uint8_t argConst_u8Index, HAL_RCC_ResetRecord_t *const arg_constpRecord)
+{
+    // local used variables
+    HAL_RCC_ErrStates_t local_errState = HAL_RCC_OK;
+    uint32_t local_u32RecordIndex = 0;
 
-        case HAL_RCC_PERIPHERAL_TIM7:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_TIM7RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM7EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM7EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM7LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM7LPEN);
-            }
-            break;
+    // check for errors
+    if (HAL_RCC_CFG_RESET_HISTORY_ENABLE == 0)
+    {
+        local_errState = HAL_RCC_ERR_INVALID_CONFIG;
+    }
+    else if (arg_constpRecord == NULL)
+    {
+        local_errState = HAL_RCC_ERR_INVALID_PARAMS;
+    }
+    else
+    {
+        HAL_RCC_EnableBackupSRAM();
+        if (global_pRCCResetHistory_t->Magic != HAL_RCC_RESET_HISTORY_MAGIC || argConst_u8Index >= global_pRCCResetHistory_t->Count)
+        {
+            local_errState = HAL_RCC_ERR_NO_RESET_RECORD;
+        }
+        else
+        {
+            // do nothing
+        }
+    }
 
-        case HAL_RCC_PERIPHERAL_TIM8:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2RSTR, HAL_RCC_APB2RSTR_TIM8RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_TIM8EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_TIM8EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_TIM8LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_TIM8LPEN);
-            }
-            break;
+    // main function
+    if (local_errState == HAL_RCC_OK)
+    {
+        // head is the slot of the next reset so the newest record is just before it
+        local_u32RecordIndex = (global_pRCCResetHistory_t->Head + HAL_RCC_CFG_RESET_HISTORY_DEPTH - 1 - argConst_u8Index) % HAL_RCC_CFG_RESET_HISTORY_DEPTH;
+
+        arg_constpRecord->BootNumber = global_pRCCResetHistory_t->Records[local_u32RecordIndex].BootNumber;
+        arg_constpRecord->RTCTime = global_pRCCResetHistory_t->Records[local_u32RecordIndex].RTCTime;
+        arg_constpRecord->RTCDate = global_pRCCResetHistory_t->Records[local_u32RecordIndex].RTCDate;
+        arg_constpRecord->FaultPC = global_pRCCResetHistory_t->Records[local_u32RecordIndex].FaultPC;
+        arg_constpRecord->FaultCFSR = global_pRCCResetHistory_t->Records[local_u32RecordIndex].FaultCFSR;
+        arg_constpRecord->FaultHFSR = global_pRCCResetHistory_t->Records[local_u32RecordIndex].FaultHFSR;
+        arg_constpRecord->Flags = global_pRCCResetHistory_t->Records[local_u32RecordIndex].Flags;
+        arg_constpRecord->FaultValid = global_pRCCResetHistory_t->Records[local_u32RecordIndex].FaultValid;
+    }
 
-        case HAL_RCC_PERIPHERAL_TIM9:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2RSTR, HAL_RCC_APB2RSTR_TIM9RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_TIM9EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_TIM9EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_TIM9LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_TIM9LPEN);
-            }
-            break;
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_RCC_ErrStates_t HAL_RCC_GetSystemResetType(uint8_t *const arg_Constpu8Value)
+{
+    // local used variables
+    HAL_RCC_ErrStates_t local_errState = HAL_RCC_OK;
+
+    // check for errors
+    if (arg_Constpu8Value == NULL)
+    {
+        local_errState = HAL_RCC_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState == HAL_RCC_OK)
+    {
+        HAL_RCC_ReadResetFlags();
+
+        // every reset drives NRST so pin flag is checked after all the internal causes
+        if (global_u8ResetFlags & HAL_RCC_RESET_FLAG_LOW_POWER)
+        {
+            *arg_Constpu8Value = HAL_RCC_RESET_CAUSE_LOW_POWER;
+        }
+        else if (global_u8ResetFlags & HAL_RCC_RESET_FLAG_WINDOW_WATCHDOG)
+        {
+            *arg_Constpu8Value = HAL_RCC_RESET_CAUSE_WINDOW_WATCHDOG;
+        }
+        else if (global_u8ResetFlags & HAL_RCC_RESET_FLAG_INDEPENDEDNT_WATCHDOG)
+        {
+            *arg_Constpu8Value = HAL_RCC_RESET_CAUSE_INDEPENDEDNT_WATCHDOG;
+        }
+        else if (global_u8ResetFlags & HAL_RCC_RESET_FLAG_SOFTWARE)
+        {
+            *arg_Constpu8Value = HAL_RCC_RESET_CAUSE_SOFTWARE;
+        }
+        else if (global_u8ResetFlags & HAL_RCC_RESET_FLAG_POR_PDR)
+        {
+            *arg_Constpu8Value = HAL_RCC_RESET_CAUSE_POR_PDR;
+        }
+        else if (global_u8ResetFlags & HAL_RCC_RESET_FLAG_BOR)
+        {
+            *arg_Constpu8Value = HAL_RCC_RESET_CAUSE_BOR;
+        }
+        else if (global_u8ResetFlags & HAL_RCC_RESET_FLAG_PIN)
+        {
+            *arg_Constpu8Value = HAL_RCC_RESET_CAUSE_PIN;
+        }
+        else
+        {
+            *arg_Constpu8Value = HAL_RCC_NO_RESET_HAPPENED;
+        }
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_RCC_ErrStates_t HAL_RCC_GetPeripheralInputFrequency(const uint8_t argConst_u8PeripheralName, uint32_t *const arg_Constpu32Value)
+{
+    // local used variables
+    HAL_RCC_ErrStates_t local_errState = HAL_RCC_OK;
+
+    // check for errors
+    if (arg_Constpu32Value == NULL || argConst_u8PeripheralName >= HAL_RCC_MAX_PERIPHERAL)
+    {
+        local_errState = HAL_RCC_ERR_INVALID_PARAMS;
+    }
+    else
+    {
+        // do nothing
+    }
+
+    // main function
+    if (local_errState == HAL_RCC_OK)
+    {
+        *arg_Constpu32Value = globalArr_RCC_PeripheralClocks_u32[globalConstArr_RCC_PeripheralClock_t[argConst_u8PeripheralName]];
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_RCC_ErrStates_t HAL_RCC_RegisterCallback(const uint8_t argConst_u8CallBackType, const functionCallBack_t argConst_pFunctionCallBack)
+{
+    // local used variables
+    HAL_RCC_ErrStates_t local_errState = HAL_RCC_OK;
+
+    // check for errors
+    if (argConst_u8CallBackType >= HAL_RCC_MAX_CALLBACK_TYPE || argConst_pFunctionCallBack == NULL)
+    {
+        local_errState = HAL_RCC_ERR_INVALID_PARAMS;
+    }
+
+    // main function
+    if (local_errState == HAL_RCC_OK)
+    {
+        if (argConst_u8CallBackType == HAL_RCC_CALLBACK_CLOCK_SECURITY)
+        {
+            global_pClockUnstableCallBack_t = argConst_pFunctionCallBack;
+        }
+        else
+        {
+            // do nothing
+        }
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_RCC_ErrStates_t HAL_RCC_SetClockProfile(const uint8_t argConst_u8Profile)
+{
+    // local used variables
+    HAL_RCC_ErrStates_t local_errState = HAL_RCC_OK;
+    const HAL_RCC_ClockProfile_t *local_pProfile_t = NULL;
+    HAL_RCC_PLLDividers_t local_PLLDividers_t;
+    uint32_t local_u32SystemClock = 0;
+    uint32_t local_u32NewHCLK = 0;
+    uint32_t local_u32OldHCLK = global_u32SystemClock / global_u16AHBPrescaler;
+    uint32_t local_u32TempReg = 0;
+    uint32_t local_u32Timeout = HAL_RCC_CFG_HSE_STARTUP_TIMEOUT;
+    uint8_t local_u8WaitStates = 0;
+    uint8_t local_u8PLLI2SStopped = LIB_CONSTANTS_FAIL;
+    uint8_t local_u8HSEUsed = LIB_CONSTANTS_FAIL;
+
+    // check for errors
+    if (argConst_u8Profile >= (sizeof globalConstArr_RCC_ClockProfiles_t) / (sizeof globalConstArr_RCC_ClockProfiles_t[0]))
+    {
+        local_errState = HAL_RCC_ERR_INVALID_PARAMS;
+    }
+    else
+    {
+        local_pProfile_t = &globalConstArr_RCC_ClockProfiles_t[argConst_u8Profile];
+        if (local_pProfile_t->SYSClkClockSource == HAL_RCC_SYSCLK_CLK_SRC_HSI)
+        {
+            local_u32SystemClock = HAL_RCC_HSI_SPEED;
+        }
+        else if (local_pProfile_t->SYSClkClockSource == HAL_RCC_SYSCLK_CLK_SRC_HSE)
+        {
+            local_u32SystemClock = HAL_RCC_CFG_HSE_VALUE;
+        }
+        else if (local_pProfile_t->SYSClkClockSource == HAL_RCC_SYSCLK_CLK_SRC_PLL)
+        {
+            local_u32SystemClock = local_pProfile_t->PLLOutputValue;
+        }
+        else
+        {
+            local_errState = HAL_RCC_ERR_INVALID_CONFIG;
+        }
+
+        // prescalers are powers of 2 (AHB skips 32) and buses are within their limits
+        if (local_errState == HAL_RCC_OK &&
+            (local_pProfile_t->SYSCLK_to_AHB_Prescalar == 0 || local_pProfile_t->SYSCLK_to_AHB_Prescalar > 512 || local_pProfile_t->SYSCLK_to_AHB_Prescalar == 32 || (local_pProfile_t->SYSCLK_to_AHB_Prescalar & (local_pProfile_t->SYSCLK_to_AHB_Prescalar - 1)) != 0 ||
+             local_pProfile_t->AHB_to_APB1_Prescalar == 0 || local_pProfile_t->AHB_to_APB1_Prescalar > 16 || (local_pProfile_t->AHB_to_APB1_Prescalar & (local_pProfile_t->AHB_to_APB1_Prescalar - 1)) != 0 ||
+             local_pProfile_t->AHB_to_APB2_Prescalar == 0 || local_pProfile_t->AHB_to_APB2_Prescalar > 16 || (local_pProfile_t->AHB_to_APB2_Prescalar & (local_pProfile_t->AHB_to_APB2_Prescalar - 1)) != 0 ||
+             (local_pProfile_t->SYSClkClockSource == HAL_RCC_SYSCLK_CLK_SRC_PLL && (local_u32SystemClock < 25000000 || local_u32SystemClock > HAL_RCC_SYSCLK_MAX_SPEED)) ||
+             local_u32SystemClock / local_pProfile_t->SYSCLK_to_AHB_Prescalar / local_pProfile_t->AHB_to_APB1_Prescalar > HAL_RCC_APB1_MAX_SPEED ||
+             local_u32SystemClock / local_pProfile_t->SYSCLK_to_AHB_Prescalar / local_pProfile_t->AHB_to_APB2_Prescalar > HAL_RCC_APB2_MAX_SPEED ||
+             (HAL_RCC_IsClockEnabled(HAL_RCC_PERIPHERAL_ETHERNET) == 1 && local_u32SystemClock / local_pProfile_t->SYSCLK_to_AHB_Prescalar < HAL_RCC_ETH_MIN_HCLK_SPEED)))
+        {
+            local_errState = HAL_RCC_ERR_INVALID_CONFIG;
+        }
+        else if (local_errState == HAL_RCC_OK && local_pProfile_t->SYSClkClockSource == HAL_RCC_SYSCLK_CLK_SRC_PLL)
+        {
+            local_errState = HAL_RCC_SolvePLL(HAL_RCC_CT_SOURCE_SPEED, local_u32SystemClock, HAL_RCC_CFG_PLL48_ENABLE, HAL_RCC_CFG_PLLI2S_ENABLE ? HAL_RCC_CFG_PLLI2S_OUTPUT : 0, &local_PLLDividers_t);
+        }
+        else
+        {
+            // do nothing
+        }
+
+        // HSE must be running before anything is changed, profiles needing it are refused while running from the backup clock
+        if (local_errState == HAL_RCC_OK &&
+            (local_pProfile_t->SYSClkClockSource == HAL_RCC_SYSCLK_CLK_SRC_HSE || (local_pProfile_t->SYSClkClockSource == HAL_RCC_SYSCLK_CLK_SRC_PLL && HAL_RCC_CFG_PLL_SOURCE == HAL_RCC_PLL_CLK_SRC_HSE)))
+        {
+            local_u8HSEUsed = LIB_CONSTANTS_SUCCESS;
+        }
+        else
+        {
+            // do nothing
+        }
 
-        case HAL_RCC_PERIPHERAL_TIM10:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2RSTR, HAL_RCC_APB2RSTR_TIM10RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_TIM10EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
+        if (local_u8HSEUsed == LIB_CONSTANTS_SUCCESS && global_u8HSEFailed == LIB_CONSTANTS_SUCCESS)
+        {
+            local_errState = HAL_RCC_ERR_HSE_NOT_READY;
+        }
+        else if (local_u8HSEUsed == LIB_CONSTANTS_SUCCESS && LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_HSERDY) == 0)
+        {
+            LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_HSEON);
+            while (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_HSERDY) == 0 && local_u32Timeout > 0)
             {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_TIM10EN);
+                local_u32Timeout--;
             }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
+            if (local_u32Timeout == 0)
             {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_TIM10LPEN);
+                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_HSEON);
+                local_errState = HAL_RCC_ERR_HSE_NOT_READY;
             }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
+            else
             {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_TIM10LPEN);
+                // do nothing
             }
-            break;
+        }
+        else
+        {
+            // do nothing
+        }
+    }
 
-        case HAL_RCC_PERIPHERAL_TIM11:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2RSTR, HAL_RCC_APB2RSTR_TIM11RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_TIM11EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_TIM11EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_TIM11LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_TIM11LPEN);
-            }
-            break;
+    // main function
+    if (local_errState == HAL_RCC_OK)
+    {
+        local_u32NewHCLK = local_u32SystemClock / local_pProfile_t->SYSCLK_to_AHB_Prescalar;
+        local_u8WaitStates = (uint8_t)((local_u32NewHCLK - 1) / HAL_RCC_CFG_FLASH_WAIT_STATE_STEP);
 
-        case HAL_RCC_PERIPHERAL_TIM12:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_TIM12RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM12EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM12EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM12LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM12LPEN);
-            }
-            break;
+        // let drivers stop what depends on the current clock
+        HAL_RCC_NotifyRateChange(globalArr_RCC_PreRateNotifiers_t);
 
-        case HAL_RCC_PERIPHERAL_TIM13:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_TIM13RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM13EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM13EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM13LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM13LPEN);
-            }
-            break;
+        // flash needs more wait states before speeding up
+        if (local_u32NewHCLK > local_u32OldHCLK)
+        {
+            HAL_FLASH_Config(HAL_FLASH_CONFIG_KEY_WAIT_STATES, local_u8WaitStates);
+        }
+        else
+        {
+            // do nothing
+        }
 
-        case HAL_RCC_PERIPHERAL_TIM14:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_TIM14RST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM14EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
+        // run from HSI during the change, it's never faster than the old and new clocks so prescalers can be changed without passing any bus limit
+        LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_HSION);
+        while (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_HSIRDY) == 0)
+        {
+            // wait till HSI is stable
+        }
+        HAL_RCC_SwitchSystemClock(HAL_RCC_SYSCLK_CLK_SRC_HSI);
+        local_u32TempReg = global_pRCCReg_t->RCC_CFGR;
+        LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, HAL_RCC_CFGR_HPRE, HAL_RCC_CT_HPRE(local_pProfile_t->SYSCLK_to_AHB_Prescalar), 4);
+        LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, HAL_RCC_CFGR_PPRE1, HAL_RCC_CT_PPRE(local_pProfile_t->AHB_to_APB1_Prescalar), 3);
+        LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, HAL_RCC_CFGR_PPRE2, HAL_RCC_CT_PPRE(local_pProfile_t->AHB_to_APB2_Prescalar), 3);
+        global_pRCCReg_t->RCC_CFGR = local_u32TempReg;
+
+        // main PLL is stopped when it's reconfigured or no more used (PLL48CLK keeps it on)
+        if (local_pProfile_t->SYSClkClockSource == HAL_RCC_SYSCLK_CLK_SRC_PLL || !HAL_RCC_CFG_PLL48_ENABLE)
+        {
+            LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLON);
+            while (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLRDY) == 1)
             {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM14EN);
+                // wait till main PLL is stopped
             }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
+
+            // regulator voltage scaling can only be changed while main PLL is off
+            HAL_RCC_HoldClock(HAL_RCC_PERIPHERAL_PWR, &global_u8PWRClockHeld);
+            HAL_PWR_Config(HAL_PWR_KEY_MAX_HCLK_FREQ, (local_u32NewHCLK > HAL_RCC_VOS_SCALE2_MAX_SPEED) ? HAL_RCC_VOS_SCALE1 : HAL_RCC_VOS_SCALE2);
+        }
+        else
+        {
+            // do nothing
+        }
+
+        if (local_pProfile_t->SYSClkClockSource == HAL_RCC_SYSCLK_CLK_SRC_PLL)
+        {
+            // PLLI2S shares the input divider M and the source so it's stopped only if one of them changes
+            if (HAL_RCC_CFG_PLLI2S_ENABLE && (((global_pRCCReg_t->RCC_PLLCFGR >> HAL_RCC_PLLCFGR_PLLM) & 0x3FUL) != local_PLLDividers_t.PLLM ||
+                                              LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_PLLCFGR, HAL_RCC_PLLCFGR_PLLSRC) != HAL_RCC_CFG_PLL_SOURCE))
             {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM14LPEN);
+                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLI2SON);
+                while (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLI2SRDY) == 1)
+                {
+                    // wait till PLLI2S is stopped
+                }
+                local_u32TempReg = global_pRCCReg_t->RCC_PLLI2SCFGR;
+                LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, HAL_RCC_PLLI2SCFGR_PLLI2SR, local_PLLDividers_t.PLLI2SR, 3);
+                LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, HAL_RCC_PLLI2SCFGR_PLLI2SN, local_PLLDividers_t.PLLI2SN, 9);
+                global_pRCCReg_t->RCC_PLLI2SCFGR = local_u32TempReg;
+                local_u8PLLI2SStopped = LIB_CONSTANTS_SUCCESS;
             }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
+            else
             {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM14LPEN);
+                // do nothing
             }
-            break;
 
-        case HAL_RCC_PERIPHERAL_SYS_CFG:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2RSTR, HAL_RCC_APB2RSTR_SYSCFGRST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
+            local_u32TempReg = global_pRCCReg_t->RCC_PLLCFGR;
+            LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, HAL_RCC_PLLCFGR_PLLQ, local_PLLDividers_t.PLLQ, 4);
+            LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, HAL_RCC_PLLCFGR_PLLP, (local_PLLDividers_t.PLLP - 2) / 2, 2);
+            LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, HAL_RCC_PLLCFGR_PLLN, local_PLLDividers_t.PLLN, 9);
+            LIB_MATH_BTT_ASSIGN_BITS(local_u32TempReg, HAL_RCC_PLLCFGR_PLLM, local_PLLDividers_t.PLLM, 6);
+            LIB_MATH_BTT_ASSIGN_BIT(local_u32TempReg, HAL_RCC_PLLCFGR_PLLSRC, HAL_RCC_CFG_PLL_SOURCE);
+            global_pRCCReg_t->RCC_PLLCFGR = local_u32TempReg;
+
+            LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLON);
+            while (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLRDY) == 0)
             {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_SYSCFGEN);
+                // wait till main PLL is locked
             }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
+            while (LIB_MATH_BTT_GET_BIT(global_pPWRReg_t->PWR_CSR, HAL_PWR_CSR_VOSRDY) == 0)
             {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_SYSCFGEN);
+                // wait till regulator output reaches the new scale
             }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
+            if (local_u8PLLI2SStopped == LIB_CONSTANTS_SUCCESS)
             {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_SYSCFGLPEN);
+                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLI2SON);
+                while (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLI2SRDY) == 0)
+                {
+                    // wait till PLLI2S is locked
+                }
             }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
+            else
             {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_SYSCFGLPEN);
+                // do nothing
             }
-            break;
+        }
+        else
+        {
+            // do nothing
+        }
+        HAL_RCC_SwitchSystemClock(local_pProfile_t->SYSClkClockSource);
 
-        case HAL_RCC_PERIPHERAL_SDIO:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2RSTR, HAL_RCC_APB2RSTR_SDIORST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_SDIOEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
+        // flash wait states are decreased only after slowing down
+        if (local_u32NewHCLK <= local_u32OldHCLK)
+        {
+            HAL_FLASH_Config(HAL_FLASH_CONFIG_KEY_WAIT_STATES, local_u8WaitStates);
+        }
+        else
+        {
+            // do nothing
+        }
+
+        // HSI is turned off by hardware only if it's not the system clock
+        LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_HSION, globalConstArr_RCC_ClocksEnable_t[0].HSI_ClkEnable);
+
+        // save the new clocks
+        global_u32SystemClock = local_u32SystemClock;
+        global_u16AHBPrescaler = local_pProfile_t->SYSCLK_to_AHB_Prescalar;
+        global_u8APB1Prescaler = local_pProfile_t->AHB_to_APB1_Prescalar;
+        global_u8APB2Prescaler = local_pProfile_t->AHB_to_APB2_Prescalar;
+        HAL_RCC_UpdatePeripheralClocks();
+
+        // HAL_RCC_RetryHSE() brings back the last applied profile and not the one running when HSE failed
+        global_u8HSESystemClockSource = local_pProfile_t->SYSClkClockSource;
+        global_u32HSESystemClock = local_u32SystemClock;
+        global_u32HSEPLLConfig = global_pRCCReg_t->RCC_PLLCFGR;
+        global_u32HSEPLLI2SConfig = global_pRCCReg_t->RCC_PLLI2SCFGR;
+
+        // let drivers recompute what depends on the new clock
+        HAL_RCC_NotifyRateChange(globalArr_RCC_PostRateNotifiers_t);
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ *
+ */
+HAL_RCC_ErrStates_t HAL_RCC_RegisterRateNotifier(const functionCallBack_t argConst_pPreChange, const functionCallBack_t argConst_pPostChange)
+{
+    // local used variables
+    HAL_RCC_ErrStates_t local_errState = HAL_RCC_OK;
+
+    // check for errors
+    if (argConst_pPreChange == NULL && argConst_pPostChange == NULL)
+    {
+        local_errState = HAL_RCC_ERR_INVALID_PARAMS;
+    }
+    else if (global_u8RateNotifiersCount >= HAL_RCC_CFG_MAX_RATE_NOTIFIERS)
+    {
+        local_errState = HAL_RCC_ERR_NOTIFIERS_FULL;
+    }
+    else
+    {
+        // do nothing
+    }
+
+    // main function
+    if (local_errState == HAL_RCC_OK)
+    {
+        globalArr_RCC_PreRateNotifiers_t[global_u8RateNotifiersCount] = argConst_pPreChange;
+        globalArr_RCC_PostRateNotifiers_t[global_u8RateNotifiersCount] = argConst_pPostChange;
+        global_u8RateNotifiersCount++;
+    }
+    else
+    {
+        // do nothing
+    }
+
+    return local_errState;
+}
+
+/**
+ * @brief: used as a helpful function
+ */
+static HAL_RCC_ErrStates_t HAL_RCC_SolvePLL(const uint32_t argConst_u32SourceSpeed, const uint32_t argConst_u32PLLOutput, const uint8_t argConst_u8PLL48Enable, const uint32_t argConst_u32PLLI2SOutput, HAL_RCC_PLLDividers_t *const arg_constpDividers)
+{
+    // local used variables
+    HAL_RCC_ErrStates_t local_errState = HAL_RCC_ERR_INVALID_CLK_VAL;
+    uint64_t local_u64Numerator = 0;
+    uint32_t local_u32VCO = 0;
+    uint8_t local_u8PLLM = 0;
+    uint8_t local_u8PLLM_max = 0;
+    uint8_t local_u8Divider = 0;
+    uint8_t local_u8PLLFound = LIB_CONSTANTS_FAIL;
+    uint8_t local_u8PLLI2SFound = LIB_CONSTANTS_FAIL;
+
+    // reset values of the dividers are kept for the PLLs that aren't used
+    arg_constpDividers->PLLM = HAL_RCC_PLLM_RESET_VAL;
+    arg_constpDividers->PLLN = HAL_RCC_PLLN_RESET_VAL;
+    arg_constpDividers->PLLP = HAL_RCC_PLLP_MIN;
+    arg_constpDividers->PLLQ = HAL_RCC_PLLQ_RESET_VAL;
+    arg_constpDividers->PLLI2SN = HAL_RCC_PLLI2SN_RESET_VAL;
+    arg_constpDividers->PLLI2SR = HAL_RCC_PLLI2SR_RESET_VAL;
+
+    if (argConst_u32PLLOutput == 0 && argConst_u8PLL48Enable != LIB_CONSTANTS_ENABLED && argConst_u32PLLI2SOutput == 0)
+    {
+        local_errState = HAL_RCC_OK;
+    }
+    else
+    {
+        // only M values that put VCO input in range (1 MHZ to 2 MHZ), the smallest M gives the highest input which has the lowest jitter
+        local_u8PLLM = (uint8_t)((argConst_u32SourceSpeed + HAL_RCC_PLL_INPUT_MAX_SPEED - 1) / HAL_RCC_PLL_INPUT_MAX_SPEED);
+        local_u8PLLM = (local_u8PLLM < HAL_RCC_PLLM_MIN) ? HAL_RCC_PLLM_MIN : local_u8PLLM;
+        local_u8PLLM_max = (uint8_t)(argConst_u32SourceSpeed / HAL_RCC_PLL_INPUT_MIN_SPEED);
+        local_u8PLLM_max = (local_u8PLLM_max > HAL_RCC_PLLM_MAX) ? HAL_RCC_PLLM_MAX : local_u8PLLM_max;
+    }
+
+    // with VCO input in range every VCO in range gives N in range (50 to 432) so N is never checked
+    for (; local_errState != HAL_RCC_OK && local_u8PLLM <= local_u8PLLM_max; local_u8PLLM++)
+    {
+        local_u8PLLFound = (argConst_u32PLLOutput == 0 && argConst_u8PLL48Enable != LIB_CONSTANTS_ENABLED) ? LIB_CONSTANTS_SUCCESS : LIB_CONSTANTS_FAIL;
+        local_u8PLLI2SFound = (argConst_u32PLLI2SOutput == 0) ? LIB_CONSTANTS_SUCCESS : LIB_CONSTANTS_FAIL;
+
+        // main PLL: VCO = output * P and N = VCO * M / source has to be an integer
+        for (local_u8Divider = HAL_RCC_PLLP_MIN; argConst_u32PLLOutput != 0 && local_u8PLLFound == LIB_CONSTANTS_FAIL && local_u8Divider <= HAL_RCC_PLLP_MAX; local_u8Divider += 2)
+        {
+            local_u32VCO = argConst_u32PLLOutput * local_u8Divider;
+            local_u64Numerator = (uint64_t)local_u32VCO * local_u8PLLM;
+            if (local_u32VCO >= HAL_RCC_VCO_MIN_SPEED && local_u32VCO <= HAL_RCC_VCO_MAX_SPEED && (local_u64Numerator % argConst_u32SourceSpeed) == 0 &&
+                (argConst_u8PLL48Enable != LIB_CONSTANTS_ENABLED || (local_u32VCO % HAL_RCC_PLL48CLK_SPEED == 0 && local_u32VCO / HAL_RCC_PLL48CLK_SPEED >= HAL_RCC_PLLQ_MIN && local_u32VCO / HAL_RCC_PLL48CLK_SPEED <= HAL_RCC_PLLQ_MAX)))
             {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_SDIOEN);
+                arg_constpDividers->PLLN = (uint16_t)(local_u64Numerator / argConst_u32SourceSpeed);
+                arg_constpDividers->PLLP = local_u8Divider;
+                local_u8PLLFound = LIB_CONSTANTS_SUCCESS;
             }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
+        }
+
+        // main PLL used for 48 MHZ domain only: VCO = 48 MHZ * Q
+        for (local_u8Divider = HAL_RCC_PLLQ_MIN; argConst_u32PLLOutput == 0 && local_u8PLLFound == LIB_CONSTANTS_FAIL && local_u8Divider <= HAL_RCC_PLLQ_MAX; local_u8Divider++)
+        {
+            local_u32VCO = HAL_RCC_PLL48CLK_SPEED * local_u8Divider;
+            local_u64Numerator = (uint64_t)local_u32VCO * local_u8PLLM;
+            if (local_u32VCO >= HAL_RCC_VCO_MIN_SPEED && local_u32VCO <= HAL_RCC_VCO_MAX_SPEED && (local_u64Numerator % argConst_u32SourceSpeed) == 0)
             {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_SDIOLPEN);
+                arg_constpDividers->PLLN = (uint16_t)(local_u64Numerator / argConst_u32SourceSpeed);
+                local_u8PLLFound = LIB_CONSTANTS_SUCCESS;
             }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
+        }
+
+        // Q keeps 48 MHZ domain at or below 48 MHZ even when it's not used
+        if (local_u8PLLFound == LIB_CONSTANTS_SUCCESS && (argConst_u32PLLOutput != 0 || argConst_u8PLL48Enable == LIB_CONSTANTS_ENABLED))
+        {
+            local_u32VCO = (uint32_t)(((uint64_t)argConst_u32SourceSpeed * arg_constpDividers->PLLN) / local_u8PLLM);
+            arg_constpDividers->PLLQ = (uint8_t)((local_u32VCO + HAL_RCC_PLL48CLK_SPEED - 1) / HAL_RCC_PLL48CLK_SPEED);
+            arg_constpDividers->PLLQ = (arg_constpDividers->PLLQ < HAL_RCC_PLLQ_MIN) ? HAL_RCC_PLLQ_MIN : arg_constpDividers->PLLQ;
+        }
+
+        // PLLI2S shares M: VCO = output * R and N = VCO * M / source has to be an integer
+        for (local_u8Divider = HAL_RCC_PLLI2SR_MIN; local_u8PLLI2SFound == LIB_CONSTANTS_FAIL && local_u8Divider <= HAL_RCC_PLLI2SR_MAX; local_u8Divider++)
+        {
+            local_u32VCO = argConst_u32PLLI2SOutput * local_u8Divider;
+            local_u64Numerator = (uint64_t)local_u32VCO * local_u8PLLM;
+            if (local_u32VCO >= HAL_RCC_VCO_MIN_SPEED && local_u32VCO <= HAL_RCC_VCO_MAX_SPEED && (local_u64Numerator % argConst_u32SourceSpeed) == 0)
             {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_SDIOLPEN);
+                arg_constpDividers->PLLI2SN = (uint16_t)(local_u64Numerator / argConst_u32SourceSpeed);
+                arg_constpDividers->PLLI2SR = local_u8Divider;
+                local_u8PLLI2SFound = LIB_CONSTANTS_SUCCESS;
             }
-            break;
+        }
+
+        if (local_u8PLLFound == LIB_CONSTANTS_SUCCESS && local_u8PLLI2SFound == LIB_CONSTANTS_SUCCESS)
+        {
+            arg_constpDividers->PLLM = local_u8PLLM;
+            local_errState = HAL_RCC_OK;
+        }
+    }
+
+    return local_errState;
+}
+
+/**
+ * @brief: used as a helpful function
+ */
+static void HAL_RCC_SwitchSystemClock(const uint8_t argConst_u8ClockSource)
+{
+    LIB_MATH_BTT_ASSIGN_BITS(global_pRCCReg_t->RCC_CFGR, HAL_RCC_CFGR_SW, argConst_u8ClockSource, 2);
+    while (((global_pRCCReg_t->RCC_CFGR >> HAL_RCC_CFGR_SWS) & HAL_RCC_CFGR_SW_MASK) != argConst_u8ClockSource)
+    {
+        // wait till the new system clock is used
+    }
+    global_u8SystemClockSource = argConst_u8ClockSource;
+}
+
+/**
+ * @brief: used as a helpful function
+ */
+static void HAL_RCC_UpdatePeripheralClocks(void)
+{
+    uint32_t local_u32HCLK = global_u32SystemClock / global_u16AHBPrescaler;
+
+    globalArr_RCC_PeripheralClocks_u32[HAL_RCC_PERI_CLK_AHB] = local_u32HCLK;
+    globalArr_RCC_PeripheralClocks_u32[HAL_RCC_PERI_CLK_APB1] = local_u32HCLK / global_u8APB1Prescaler;
+    globalArr_RCC_PeripheralClocks_u32[HAL_RCC_PERI_CLK_APB1_TIMER] = (global_u8APB1Prescaler == 1) ? local_u32HCLK : ((local_u32HCLK / global_u8APB1Prescaler) * 2);
+    globalArr_RCC_PeripheralClocks_u32[HAL_RCC_PERI_CLK_APB2] = local_u32HCLK / global_u8APB2Prescaler;
+    globalArr_RCC_PeripheralClocks_u32[HAL_RCC_PERI_CLK_APB2_TIMER] = (global_u8APB2Prescaler == 1) ? local_u32HCLK : ((local_u32HCLK / global_u8APB2Prescaler) * 2);
+
+    if (globalConstArr_RCC_RTC_ClockConfig_t[0].RTCClockSource == HAL_RCC_RTC_CLK_SRC_LSI)
+    {
+        globalArr_RCC_PeripheralClocks_u32[HAL_RCC_PERI_CLK_RTC] = HAL_RCC_LSI_SPEED;
+    }
+    else if (globalConstArr_RCC_RTC_ClockConfig_t[0].RTCClockSource == HAL_RCC_RTC_CLK_SRC_LSE)
+    {
+        globalArr_RCC_PeripheralClocks_u32[HAL_RCC_PERI_CLK_RTC] = HAL_RCC_LSE_SPEED;
+    }
+    else if (globalConstArr_RCC_RTC_ClockConfig_t[0].RTCClockSource == HAL_RCC_RTC_CLK_SRC_HSE)
+    {
+        globalArr_RCC_PeripheralClocks_u32[HAL_RCC_PERI_CLK_RTC] = global_u32HSEtoRTCClk;
+    }
+    else
+    {
+        globalArr_RCC_PeripheralClocks_u32[HAL_RCC_PERI_CLK_RTC] = 0;
+    }
+}
+
+/**
+ * @brief: used as a helpful function
+ */
+static void HAL_RCC_AddPeripheralMask(const uint8_t argConst_u8PeripheralName, const uint8_t argConst_u8Operation, uint32_t *const arg_constpu32Masks)
+{
+    const HAL_RCC_PeripheralBits_t *local_pBits_t = &globalConstArr_RCC_PeripheralBits_t[argConst_u8PeripheralName];
+
+    if (argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_RTC)
+    {
+        if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
+        {
+            LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_BDCR, HAL_RCC_BDCR_RTCEN);
+        }
+        else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
+        {
+            LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_BDCR, HAL_RCC_BDCR_RTCEN);
+        }
+        else
+        {
+            // do nothing
+        }
+    }
+    else if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
+    {
+        arg_constpu32Masks[local_pBits_t->Bus] |= local_pBits_t->ResetMask;
+    }
+    else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE || argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
+    {
+        arg_constpu32Masks[local_pBits_t->Bus] |= local_pBits_t->EnableMask;
+    }
+    else
+    {
+        arg_constpu32Masks[local_pBits_t->Bus] |= local_pBits_t->LowPowerMask;
+    }
+}
+
+/**
+ * @brief: used as a helpful function
+ */
+static void HAL_RCC_ApplyPeripheralMasks(const uint32_t *const argConst_pu32Masks, const uint8_t argConst_u8Operation)
+{
+    __io uint32_t *local_pu32ResetReg = &global_pRCCReg_t->RCC_AHB1RSTR;
+    uint8_t local_u8Bus = 0;
+
+    for (local_u8Bus = 0; local_u8Bus < HAL_RCC_MAX_BUS; local_u8Bus++)
+    {
+        if (argConst_pu32Masks[local_u8Bus] == 0)
+        {
+            // do nothing
+        }
+        else if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
+        {
+            local_pu32ResetReg[local_u8Bus] |= argConst_pu32Masks[local_u8Bus];
+            local_pu32ResetReg[local_u8Bus] &= ~argConst_pu32Masks[local_u8Bus];
+        }
+        else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
+        {
+            local_pu32ResetReg[local_u8Bus + HAL_RCC_ENR_OFFSET] |= argConst_pu32Masks[local_u8Bus];
+        }
+        else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
+        {
+            local_pu32ResetReg[local_u8Bus + HAL_RCC_ENR_OFFSET] &= ~argConst_pu32Masks[local_u8Bus];
+        }
+        else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
+        {
+            local_pu32ResetReg[local_u8Bus + HAL_RCC_LPENR_OFFSET] |= argConst_pu32Masks[local_u8Bus];
+        }
+        else
+        {
+            local_pu32ResetReg[local_u8Bus + HAL_RCC_LPENR_OFFSET] &= ~argConst_pu32Masks[local_u8Bus];
+        }
+    }
+}
+
+/**
+ * @brief: used as a helpful function
+ */
+static uint8_t HAL_RCC_IsClockEnabled(const uint8_t argConst_u8PeripheralName)
+{
+    __io uint32_t *local_pu32EnableReg = &global_pRCCReg_t->RCC_AHB1ENR;
+    const HAL_RCC_PeripheralBits_t *local_pBits_t = &globalConstArr_RCC_PeripheralBits_t[argConst_u8PeripheralName];
+    uint8_t local_u8Enabled = 0;
+
+    if (argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_RTC)
+    {
+        local_u8Enabled = (uint8_t)LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_BDCR, HAL_RCC_BDCR_RTCEN);
+    }
+    else if ((local_pu32EnableReg[local_pBits_t->Bus] & local_pBits_t->EnableMask) != 0)
+    {
+        local_u8Enabled = 1;
+    }
+    else
+    {
+        // do nothing
+    }
 
-        case HAL_RCC_PERIPHERAL_ADC1:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2RSTR, HAL_RCC_APB2RSTR_ADCRST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_ADC1EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_ADC1EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_ADC1LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_ADC1LPEN);
-            }
-            break;
+    return local_u8Enabled;
+}
 
-        case HAL_RCC_PERIPHERAL_ADC2:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2RSTR, HAL_RCC_APB2RSTR_ADCRST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_ADC2EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_ADC2EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_ADC2LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_ADC2LPEN);
-            }
-            break;
+/**
+ * @brief: used as a helpful function
+ */
+static HAL_RCC_ErrStates_t HAL_RCC_UpdateClockUsers(const uint8_t argConst_u8PeripheralName, const uint8_t argConst_u8Operation, uint32_t *const arg_constpu32EnableMasks, uint32_t *const arg_constpu32LowPowerMasks)
+{
+    HAL_RCC_ErrStates_t local_errState = HAL_RCC_OK;
 
-        case HAL_RCC_PERIPHERAL_ADC3:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2RSTR, HAL_RCC_APB2RSTR_ADCRST);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_ADC3EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_ADC3EN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_ADC3LPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
-            {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_ADC3LPEN);
-            }
-            break;
+    // a clock turned on without the counters (debugger, bootloader or direct register access) belongs to one existing user
+    if (globalArr_RCC_ClockUsers_u8[argConst_u8PeripheralName] == 0 && HAL_RCC_IsClockEnabled(argConst_u8PeripheralName) == 1)
+    {
+        globalArr_RCC_ClockUsers_u8[argConst_u8PeripheralName] = 1;
+    }
+    else
+    {
+        // do nothing
+    }
 
-        case HAL_RCC_PERIPHERAL_FLASH_MEM:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
-            {
-                // do nothing
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                // do nothing
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                // do nothing
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_FLITFLPEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
+    if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
+    {
+        if (globalArr_RCC_ClockUsers_u8[argConst_u8PeripheralName] == 0xFF)
+        {
+            local_errState = HAL_RCC_ERR_CLOCK_USERS_FULL;
+        }
+        else
+        {
+            if (globalArr_RCC_ClockUsers_u8[argConst_u8PeripheralName] == 0)
             {
-                LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_FLITFLPEN);
+                HAL_RCC_AddPeripheralMask(argConst_u8PeripheralName, HAL_RCC_PERI_OP_ENABLE, arg_constpu32EnableMasks);
+                HAL_RCC_AddPeripheralMask(argConst_u8PeripheralName, HAL_RCC_PERI_OP_LOW_PWR_ENABLE, arg_constpu32LowPowerMasks);
             }
-            break;
-
-        case HAL_RCC_PERIPHERAL_RTC:
-            if (argConst_u8Operation == HAL_RCC_PERI_OP_RESET)
+            else
             {
                 // do nothing
             }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_ENABLE)
-            {
-                LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_BDCR, HAL_RCC_BDCR_RTCEN);
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_DISABLE)
-            {
-                // do nothing (TODO: edit this line)
-            }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_ENABLE)
+            globalArr_RCC_ClockUsers_u8[argConst_u8PeripheralName]++;
+        }
+    }
+    else
+    {
+        if (globalArr_RCC_ClockUsers_u8[argConst_u8PeripheralName] == 0)
+        {
+            local_errState = HAL_RCC_ERR_CLOCK_NOT_ACQUIRED;
+        }
+        else
+        {
+            globalArr_RCC_ClockUsers_u8[argConst_u8PeripheralName]--;
+            if (globalArr_RCC_ClockUsers_u8[argConst_u8PeripheralName] == 0)
             {
-                // do nothing
+                HAL_RCC_AddPeripheralMask(argConst_u8PeripheralName, HAL_RCC_PERI_OP_LOW_PWR_DISABLE, arg_constpu32LowPowerMasks);
+                HAL_RCC_AddPeripheralMask(argConst_u8PeripheralName, HAL_RCC_PERI_OP_DISABLE, arg_constpu32EnableMasks);
             }
-            else if (argConst_u8Operation == HAL_RCC_PERI_OP_LOW_PWR_DISABLE)
+            else
             {
                 // do nothing
             }
-            break;
-
-        default:
-            break;
         }
     }
 
@@ -2077,208 +1746,344 @@ HAL_RCC_ErrStates_t HAL_RCC_PeripheralModify(const uint8_t argConst_u8Peripheral
 }
 
 /**
- *
+ * @brief: used as a helpful function
  */
-HAL_RCC_ErrStates_t HAL_RCC_GetSystemResetType(uint8_t *const arg_Constpu8Value)
+static void HAL_RCC_HoldClock(const uint8_t argConst_u8PeripheralName, uint8_t *const arg_constpu8Held)
 {
-    // local used variables
-    HAL_RCC_ErrStates_t local_errState = HAL_RCC_OK;
+    if (*arg_constpu8Held == LIB_CONSTANTS_FAIL && HAL_RCC_ClockAcquire(argConst_u8PeripheralName) == HAL_RCC_OK)
+    {
+        *arg_constpu8Held = LIB_CONSTANTS_SUCCESS;
+    }
+    else
+    {
+        // do nothing
+    }
+}
 
-    // check for errors
-    if (arg_Constpu8Value == NULL)
+/**
+ * @brief: used as a helpful function
+ */
+static void HAL_RCC_RestartPLL(const uint32_t argConst_u32PLLConfig, const uint32_t argConst_u32PLLI2SConfig)
+{
+    // hardware may have stopped the PLLs with HSE so the running state is taken from the saved clock tree and configurations
+    uint8_t local_u8PLLOn = (global_u8HSESystemClockSource == HAL_RCC_SYSCLK_CLK_SRC_PLL || HAL_RCC_CFG_PLL48_ENABLE) ? 1 : 0;
+    uint8_t local_u8PLLI2SOn = HAL_RCC_CFG_PLLI2S_ENABLE ? 1 : 0;
+
+    LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLON);
+    LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLI2SON);
+    while (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLRDY) == 1 || LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLI2SRDY) == 1)
     {
-        local_errState = HAL_RCC_ERR_INVALID_PARAMS;
+        // wait till both PLLs are stopped
     }
 
-    // main function
-    if (local_errState == HAL_RCC_OK)
+    global_pRCCReg_t->RCC_PLLCFGR = (global_pRCCReg_t->RCC_PLLCFGR & ~HAL_RCC_CT_PLLCFGR_MASK) | (argConst_u32PLLConfig & HAL_RCC_CT_PLLCFGR_MASK);
+    global_pRCCReg_t->RCC_PLLI2SCFGR = (global_pRCCReg_t->RCC_PLLI2SCFGR & ~HAL_RCC_CT_PLLI2SCFGR_MASK) | (argConst_u32PLLI2SConfig & HAL_RCC_CT_PLLI2SCFGR_MASK);
+
+    if (local_u8PLLOn == 1)
     {
-        if (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CSR, HAL_RCC_CSR_LPWRRSTF) == 1)
+        LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLON);
+        while (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLRDY) == 0)
         {
-            *arg_Constpu8Value = HAL_RCC_RESET_CAUSE_LOW_POWER;
+            // wait till main PLL is locked
         }
-        else if (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CSR, HAL_RCC_CSR_WWDGRSTF) == 1)
+    }
+    else
+    {
+        // do nothing
+    }
+
+    if (local_u8PLLI2SOn == 1)
+    {
+        LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLI2SON);
+        while (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_PLLI2SRDY) == 0)
         {
-            *arg_Constpu8Value = HAL_RCC_RESET_CAUSE_WINDOW_WATCHDOG;
+            // wait till PLLI2S is locked
+        }
+    }
+    else
+    {
+        // do nothing
+    }
+}
+
+/**
+ * @brief: used as a helpful function
+ */
+static void HAL_RCC_FailoverToHSI(void)
+{
+    HAL_RCC_PLLDividers_t local_PLLDividers_t;
+    uint32_t local_u32PLLConfig = global_pRCCReg_t->RCC_PLLCFGR;
+    uint32_t local_u32PLLI2SConfig = global_pRCCReg_t->RCC_PLLI2SCFGR;
+    uint32_t local_u32PLLOutput = 0;
+    uint8_t local_u8PLLM = (uint8_t)((local_u32PLLConfig >> HAL_RCC_PLLCFGR_PLLM) & 0x3FUL);
+    uint16_t local_u16PLLN = (uint16_t)((local_u32PLLConfig >> HAL_RCC_PLLCFGR_PLLN) & 0x1FFUL);
+    uint8_t local_u8PLLP = (uint8_t)((((local_u32PLLConfig >> HAL_RCC_PLLCFGR_PLLP) & 0x3UL) * 2) + 2);
+
+    // save the clock tree running from HSE so HAL_RCC_RetryHSE() can bring it back
+    if (global_u8HSEFailed == LIB_CONSTANTS_FAIL)
+    {
+        global_u8HSEFailed = LIB_CONSTANTS_SUCCESS;
+        global_u8HSESystemClockSource = global_u8SystemClockSource;
+        global_u32HSESystemClock = global_u32SystemClock;
+        global_u32HSEPLLConfig = local_u32PLLConfig;
+        global_u32HSEPLLI2SConfig = local_u32PLLI2SConfig;
+    }
+    else
+    {
+        // do nothing
+    }
+
+    // hardware switched the system clock to HSI, make sure it's kept on
+    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_CR, HAL_RCC_CR_HSION);
+    global_u8SystemClockSource = HAL_RCC_SYSCLK_CLK_SRC_HSI;
+    global_u32SystemClock = HAL_RCC_HSI_SPEED;
+
+    // PLLs fed from HSE lost their input, rebuild them from HSI with the same outputs
+    if (LIB_MATH_BTT_GET_BIT(local_u32PLLConfig, HAL_RCC_PLLCFGR_PLLSRC) == 1 && local_u8PLLM != 0)
+    {
+        local_u32PLLOutput = (uint32_t)(((uint64_t)HAL_RCC_CFG_HSE_VALUE * local_u16PLLN) / ((uint32_t)local_u8PLLM * local_u8PLLP));
+        if (HAL_RCC_SolvePLL(HAL_RCC_HSI_SPEED, local_u32PLLOutput, HAL_RCC_CFG_PLL48_ENABLE, HAL_RCC_CFG_PLLI2S_ENABLE ? HAL_RCC_CFG_PLLI2S_OUTPUT : 0, &local_PLLDividers_t) == HAL_RCC_OK)
+        {
+            LIB_MATH_BTT_CLR_BIT(local_u32PLLConfig, HAL_RCC_PLLCFGR_PLLSRC);
+            LIB_MATH_BTT_ASSIGN_BITS(local_u32PLLConfig, HAL_RCC_PLLCFGR_PLLQ, local_PLLDividers_t.PLLQ, 4);
+            LIB_MATH_BTT_ASSIGN_BITS(local_u32PLLConfig, HAL_RCC_PLLCFGR_PLLP, (local_PLLDividers_t.PLLP - 2) / 2, 2);
+            LIB_MATH_BTT_ASSIGN_BITS(local_u32PLLConfig, HAL_RCC_PLLCFGR_PLLN, local_PLLDividers_t.PLLN, 9);
+            LIB_MATH_BTT_ASSIGN_BITS(local_u32PLLConfig, HAL_RCC_PLLCFGR_PLLM, local_PLLDividers_t.PLLM, 6);
+            LIB_MATH_BTT_ASSIGN_BITS(local_u32PLLI2SConfig, HAL_RCC_PLLI2SCFGR_PLLI2SR, local_PLLDividers_t.PLLI2SR, 3);
+            LIB_MATH_BTT_ASSIGN_BITS(local_u32PLLI2SConfig, HAL_RCC_PLLI2SCFGR_PLLI2SN, local_PLLDividers_t.PLLI2SN, 9);
+            HAL_RCC_RestartPLL(local_u32PLLConfig, local_u32PLLI2SConfig);
+
+            if (global_u8HSESystemClockSource == HAL_RCC_SYSCLK_CLK_SRC_PLL)
+            {
+                HAL_RCC_SwitchSystemClock(HAL_RCC_SYSCLK_CLK_SRC_PLL);
+                global_u32SystemClock = local_u32PLLOutput;
+            }
+            else
+            {
+                // do nothing
+            }
         }
-        else if (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CSR, HAL_RCC_CSR_IWDGRSTF) == 1)
+        else
         {
-            *arg_Constpu8Value = HAL_RCC_RESET_CAUSE_INDEPENDEDNT_WATCHDOG;
+            // output can't be reached from HSI, keep running from HSI
         }
-        else if (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CSR, HAL_RCC_CSR_IWDGRSTF) == 1)
+    }
+    else
+    {
+        // do nothing
+    }
+
+    HAL_RCC_UpdatePeripheralClocks();
+
+    // let drivers recompute what depends on the new clock
+    HAL_RCC_NotifyRateChange(globalArr_RCC_PostRateNotifiers_t);
+}
+
+/**
+ * @brief: used as a helpful function
+ */
+static void HAL_RCC_NotifyRateChange(const functionCallBack_t *const argConst_pNotifiers)
+{
+    uint8_t local_u8Iterator = 0;
+
+    for (local_u8Iterator = 0; local_u8Iterator < global_u8RateNotifiersCount; local_u8Iterator++)
+    {
+        if (argConst_pNotifiers[local_u8Iterator] != NULL)
         {
-            *arg_Constpu8Value = HAL_RCC_RESET_CAUSE_SOFTWARE;
+            argConst_pNotifiers[local_u8Iterator]();
         }
-        else if (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CSR, HAL_RCC_CSR_PORRSTF) == 1)
+        else
         {
-            *arg_Constpu8Value = HAL_RCC_RESET_CAUSE_POR_PDR;
+            // do nothing
         }
-        else if (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CSR, HAL_RCC_CSR_PINRSTF) == 1)
+    }
+}
+
+/**
+ * @brief: used as a helpful function
+ */
+static HAL_RCC_ErrStates_t HAL_RCC_MeasureHSI(uint32_t *const arg_Constpu32Ticks)
+{
+    HAL_RCC_ErrStates_t local_errState = HAL_RCC_OK;
+    uint32_t local_u32Timeout = 0;
+    uint32_t local_u32FirstCapture = 0;
+    uint32_t local_u32LastCapture = 0;
+    uint8_t local_u8Capture = 0;
+    uint8_t local_u8Restarts = HAL_RCC_TIM5_MEASURE_RESTARTS;
+
+    // the first capture is only a start point, status flags are cleared by writing 0 so the other flags are written with 1 to keep them
+    HAL_RCC_TIM5_REG(HAL_RCC_TIM5_SR) = ~((1UL << HAL_RCC_TIM5_SR_CC4IF) | (1UL << HAL_RCC_TIM5_SR_CC4OF));
+    for (local_u8Capture = 0; local_u8Capture <= HAL_RCC_CFG_HSI_TRIM_CAPTURES && local_errState == HAL_RCC_OK; local_u8Capture++)
+    {
+        local_u32Timeout = HAL_RCC_CFG_LSE_CAPTURE_TIMEOUT;
+        while (LIB_MATH_BTT_GET_BIT(HAL_RCC_TIM5_REG(HAL_RCC_TIM5_SR), HAL_RCC_TIM5_SR_CC4IF) == 0 && local_u32Timeout > 0)
         {
-            *arg_Constpu8Value = HAL_RCC_RESET_CAUSE_PIN;
+            local_u32Timeout--;
         }
-        else if (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CSR, HAL_RCC_CSR_BORRSTF) == 1)
+
+        if (local_u32Timeout == 0)
         {
-            *arg_Constpu8Value = HAL_RCC_RESET_CAUSE_BOR;
+            local_errState = HAL_RCC_ERR_LSE_NOT_READY;
         }
         else
         {
-            *arg_Constpu8Value = HAL_RCC_NO_RESET_HAPPENED;
+            // reading CCR4 clears the capture flag
+            local_u32LastCapture = HAL_RCC_TIM5_REG(HAL_RCC_TIM5_CCR4);
+            if (LIB_MATH_BTT_GET_BIT(HAL_RCC_TIM5_REG(HAL_RCC_TIM5_SR), HAL_RCC_TIM5_SR_CC4OF) == 1)
+            {
+                // a capture was overwritten before being read so the interval is longer than counted, the latest capture becomes the new start point
+                HAL_RCC_TIM5_REG(HAL_RCC_TIM5_SR) = ~(1UL << HAL_RCC_TIM5_SR_CC4OF);
+                if (local_u8Restarts == 0)
+                {
+                    local_errState = HAL_RCC_ERR_CAPTURE_OVERRUN;
+                }
+                else
+                {
+                    local_u8Restarts--;
+                    local_u32FirstCapture = local_u32LastCapture;
+                    local_u8Capture = 0;
+                }
+            }
+            else if (local_u8Capture == 0)
+            {
+                local_u32FirstCapture = local_u32LastCapture;
+            }
+            else
+            {
+                // do nothing
+            }
         }
-
-        LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_CSR, HAL_RCC_CSR_RMVF);
     }
 
+    // counter is 32 bits so the subtraction is right even if it wraps
+    *arg_Constpu32Ticks = local_u32LastCapture - local_u32FirstCapture;
+
     return local_errState;
 }
 
 /**
- *
+ * @brief: used as a helpful function
  */
-HAL_RCC_ErrStates_t HAL_RCC_GetPeripheralInputFrequency(const uint8_t argConst_u8PeripheralName, uint32_t *const arg_Constpu32Value)
+static void HAL_RCC_ReadResetFlags(void)
 {
-    // local used variables
-    HAL_RCC_ErrStates_t local_errState = HAL_RCC_OK;
-
-    // check for errors
-    if (arg_Constpu32Value == NULL || argConst_u8PeripheralName >= HAL_RCC_MAX_PERIPHERAL)
+    if (global_u8ResetFlagsRead == LIB_CONSTANTS_FAIL)
     {
-        local_errState = HAL_RCC_ERR_INVALID_PARAMS;
+        global_u8ResetFlags = (uint8_t)((global_pRCCReg_t->RCC_CSR >> HAL_RCC_CSR_BORRSTF) & HAL_RCC_RESET_FLAGS_MASK);
+
+        // clear the flags so that the next reset reports its own cause only
+        LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_CSR, HAL_RCC_CSR_RMVF);
+        global_u8ResetFlagsRead = LIB_CONSTANTS_SUCCESS;
     }
     else
     {
         // do nothing
     }
+}
 
-    // main function
-    if (local_errState == HAL_RCC_OK)
+/**
+ * @brief: used as a helpful function
+ */
+static void HAL_RCC_EnableBackupSRAM(void)
+{
+    HAL_RCC_HoldClock(HAL_RCC_PERIPHERAL_PWR, &global_u8PWRClockHeld);
+    LIB_MATH_BTT_SET_BIT(global_pPWRReg_t->PWR_CR, HAL_PWR_CR_DBP);
+    HAL_RCC_HoldClock(HAL_RCC_PERIPHERAL_BKP_SRAM, &global_u8BackupSRAMClockHeld);
+}
+
+/**
+ * @brief: used as a helpful function
+ */
+static void HAL_RCC_LogReset(void)
+{
+    // local used variables
+    uint32_t local_u32Head = 0;
+    uint32_t local_u32Timeout = 0;
+
+    if (global_u8ResetLogged == LIB_CONSTANTS_FAIL)
     {
-        // TODO: add support for ethernet
-
-        // AHB
-        if (argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_FSMC ||
-            argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_RNG ||
-            argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_HASH ||
-            argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_CRYPTO ||
-            argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_CAMERA ||
-            argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_USB_OTG ||
-            argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_DMA1 ||
-            argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_DMA2 ||
-            argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_BKP_SRAM ||
-            argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_CRC ||
-            argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_GPIOA ||
-            argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_GPIOB ||
-            argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_GPIOC ||
-            argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_GPIOD ||
-            argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_GPIOE ||
-            argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_GPIOF ||
-            argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_GPIOG ||
-            argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_GPIOI ||
-            argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_CCM ||
-            argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_FLASH_MEM ||
-            argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_SRAM1 ||
-            argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_SRAM2)
-        {
-            *arg_Constpu32Value = global_u32SystemClock / globalConstArr_RCC_SYSCLK_ClockConfig_t[0].SYSCLK_to_AHB_Prescalar;
-        }
-
-        // APB2
-        else if (argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_TIM11 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_TIM10 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_TIM9 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_SYS_CFG ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_SPI1 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_SDIO ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_ADC1 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_ADC2 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_ADC3 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_USART6 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_USART1 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_TIM8 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_TIM1)
-        {
-            *arg_Constpu32Value = global_u32SystemClock / (globalConstArr_RCC_SYSCLK_ClockConfig_t[0].SYSCLK_to_AHB_Prescalar * globalConstArr_RCC_SYSCLK_ClockConfig_t[0].AHB_to_APB2_Prescalar);
-        }
-
-        // APB1
-        else if (argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_DAC ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_PWR ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_CAN1 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_CAN2 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_I2C1 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_I2C2 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_I2C3 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_UART5 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_UART4 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_USART3 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_USART2 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_SPI2 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_SPI3 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_WWDG ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_TIM14 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_TIM13 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_TIM12 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_TIM7 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_TIM6 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_TIM5 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_TIM4 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_TIM3 ||
-                 argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_TIM2)
-        {
-            *arg_Constpu32Value = global_u32SystemClock / (globalConstArr_RCC_SYSCLK_ClockConfig_t[0].SYSCLK_to_AHB_Prescalar * globalConstArr_RCC_SYSCLK_ClockConfig_t[0].AHB_to_APB1_Prescalar);
-        }
-        else if (argConst_u8PeripheralName == HAL_RCC_PERIPHERAL_RTC)
-        {
-            if (globalConstArr_RCC_RTC_ClockConfig_t[0].RTCClockSource == HAL_RCC_RTC_CLK_SRC_LSI)
+        HAL_RCC_ReadResetFlags();
+        HAL_RCC_EnableBackupSRAM();
+
+        // start a new ring if backup SRAM lost its content (first power up or VBAT removed) or holds garbage
+        if (global_pRCCResetHistory_t->Magic != HAL_RCC_RESET_HISTORY_MAGIC ||
+            global_pRCCResetHistory_t->Count > HAL_RCC_CFG_RESET_HISTORY_DEPTH ||
+            global_pRCCResetHistory_t->Head >= HAL_RCC_CFG_RESET_HISTORY_DEPTH)
+        {
+            global_pRCCResetHistory_t->BootCount = 0;
+            global_pRCCResetHistory_t->Count = 0;
+            global_pRCCResetHistory_t->Head = 0;
+            global_pRCCResetHistory_t->FaultValid = LIB_CONSTANTS_FAIL;
+            global_pRCCResetHistory_t->Magic = HAL_RCC_RESET_HISTORY_MAGIC;
+        }
+        else
+        {
+            // do nothing
+        }
+
+        local_u32Head = global_pRCCResetHistory_t->Head;
+        global_pRCCResetHistory_t->BootCount++;
+        global_pRCCResetHistory_t->Records[local_u32Head].BootNumber = global_pRCCResetHistory_t->BootCount;
+        global_pRCCResetHistory_t->Records[local_u32Head].Flags = global_u8ResetFlags;
+
+        // time stamp the record with the calendar if RTC kept running through the reset
+        global_pRCCResetHistory_t->Records[local_u32Head].RTCTime = 0;
+        global_pRCCResetHistory_t->Records[local_u32Head].RTCDate = 0;
+        if (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_BDCR, HAL_RCC_BDCR_RTCEN) == 1)
+        {
+            while (LIB_MATH_BTT_GET_BIT(HAL_RCC_RTC_REG(HAL_RCC_RTC_ISR), HAL_RCC_RTC_ISR_RSF) == 0 && local_u32Timeout < HAL_RCC_RTC_SYNC_TIMEOUT)
             {
-                *arg_Constpu32Value = HAL_RCC_LSI_SPEED;
+                local_u32Timeout++;
             }
-            else if (globalConstArr_RCC_RTC_ClockConfig_t[0].RTCClockSource == HAL_RCC_RTC_CLK_SRC_LSE)
+            if (local_u32Timeout < HAL_RCC_RTC_SYNC_TIMEOUT)
             {
-                *arg_Constpu32Value = HAL_RCC_LSE_SPEED;
+                // reading TR locks the shadow registers till DR is read
+                global_pRCCResetHistory_t->Records[local_u32Head].RTCTime = HAL_RCC_RTC_REG(HAL_RCC_RTC_TR);
+                global_pRCCResetHistory_t->Records[local_u32Head].RTCDate = HAL_RCC_RTC_REG(HAL_RCC_RTC_DR);
             }
-            else if (globalConstArr_RCC_RTC_ClockConfig_t[0].RTCClockSource == HAL_RCC_RTC_CLK_SRC_HSE)
+            else
             {
-                *arg_Constpu32Value = global_u32HSEtoRTCClk;
+                // do nothing
             }
         }
         else
         {
             // do nothing
         }
-    }
-
-    return local_errState;
-}
-
-/**
- *
- */
-HAL_RCC_ErrStates_t HAL_RCC_RegisterCallback(const uint8_t argConst_u8CallBackType, const functionCallBack_t argConst_pFunctionCallBack)
-{
-    // local used variables
-    HAL_RCC_ErrStates_t local_errState = HAL_RCC_OK;
 
-    // check for errors
-    if (argConst_u8CallBackType >= HAL_RCC_MAX_CALLBACK_TYPE || argConst_pFunctionCallBack == NULL)
-    {
-        local_errState = HAL_RCC_ERR_INVALID_PARAMS;
-    }
+        // move the context saved before the reset (if any) to its record
+        if (global_pRCCResetHistory_t->FaultValid == LIB_CONSTANTS_SUCCESS)
+        {
+            global_pRCCResetHistory_t->Records[local_u32Head].FaultPC = global_pRCCResetHistory_t->FaultPC;
+            global_pRCCResetHistory_t->Records[local_u32Head].FaultCFSR = global_pRCCResetHistory_t->FaultCFSR;
+            global_pRCCResetHistory_t->Records[local_u32Head].FaultHFSR = global_pRCCResetHistory_t->FaultHFSR;
+            global_pRCCResetHistory_t->Records[local_u32Head].FaultValid = LIB_CONSTANTS_SUCCESS;
+            global_pRCCResetHistory_t->FaultValid = LIB_CONSTANTS_FAIL;
+        }
+        else
+        {
+            global_pRCCResetHistory_t->Records[local_u32Head].FaultPC = 0;
+            global_pRCCResetHistory_t->Records[local_u32Head].FaultCFSR = 0;
+            global_pRCCResetHistory_t->Records[local_u32Head].FaultHFSR = 0;
+            global_pRCCResetHistory_t->Records[local_u32Head].FaultValid = LIB_CONSTANTS_FAIL;
+        }
 
-    // main function
-    if (local_errState == HAL_RCC_OK)
-    {
-        if (argConst_u8CallBackType == HAL_RCC_CALLBACK_CLOCK_SECURITY)
+        // record is complete so publish it
+        global_pRCCResetHistory_t->Head = (local_u32Head + 1) % HAL_RCC_CFG_RESET_HISTORY_DEPTH;
+        if (global_pRCCResetHistory_t->Count < HAL_RCC_CFG_RESET_HISTORY_DEPTH)
         {
-            global_pClockUnstableCallBack_t = argConst_pFunctionCallBack;
+            global_pRCCResetHistory_t->Count++;
         }
         else
         {
             // do nothing
         }
-    }
 
-    return local_errState;
+        global_u8ResetLogged = LIB_CONSTANTS_SUCCESS;
+    }
+    else
+    {
+        // do nothing
+    }
 }
 
 /**
@@ -2289,7 +2094,8 @@ void RCC_IRQHandler(void)
     // check if interrupt due to unstable clock
     if (LIB_MATH_BTT_GET_BIT(global_pRCCReg_t->RCC_CIR, HAL_RCC_CIR_CSSF) == 1)
     {
-        LIB_MATH_BTT_CLR_BIT(global_pRCCReg_t->RCC_CIR, HAL_RCC_CIR_CSSC);
+        LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_CIR, HAL_RCC_CIR_CSSC);
+        HAL_RCC_FailoverToHSI();
         if (global_pClockUnstableCallBack_t != NULL)
         {
             global_pClockUnstableCallBack_t();
@@ -68,10 +68,69 @@
  * Preprocessor Constants
  *******************************************************************************/
 
+/**
+ * @brief: clocks that can be chosen by the clock tree targets (refer to @HAL_RCC_CLOCK_TREE_TARGETS), they hold the same values as
+ *         @HAL_RCC_SYSCLK_ClockSource_t and @HAL_RCC_PLL_ClockSource_t but unlike the enums they can be evaluated by the preprocessor
+ */
+#define HAL_RCC_CLOCK_HSI 0 /**< High Speed Internal clock (16 MHZ)*/
+#define HAL_RCC_CLOCK_HSE 1 /**< High Speed External clock*/
+#define HAL_RCC_CLOCK_PLL 2 /**< output of the main PLL (only valid as a system clock source)*/
+
 /******************************************************************************
  * Configuration Constants
  *******************************************************************************/
 
+/**
+ * @user_todo: user must edit these targets with his needed clock tree.
+ * @brief: @HAL_RCC_CLOCK_TREE_TARGETS they are the targets of the clock tree, PLL and PLLI2S dividers (M, N, P, Q and R) together with the final values of
+ *         RCC_PLLCFGR, RCC_PLLI2SCFGR and the prescalers of RCC_CFGR are solved by the preprocessor out of them, so an unreachable target is a build error
+ *         and HAL_RCC_Init() only writes the solved values and waits for the clocks to lock.
+ * @note: enables are either 0 (disabled) or 1 (enabled), prescalers must be a power of 2 (AHB: 1 to 512 except 32, APB1/APB2: 1 to 16).
+ */
+#define HAL_RCC_CFG_HSE_VALUE 4000000                  /**< speed of the external crystal/oscillator connected to OSC_IN (4 MHZ to 26 MHZ)*/
+#define HAL_RCC_CFG_SYSCLK_SOURCE HAL_RCC_CLOCK_HSI    /**< HAL_RCC_CLOCK_HSI or HAL_RCC_CLOCK_HSE or HAL_RCC_CLOCK_PLL*/
+#define HAL_RCC_CFG_PLL_SOURCE HAL_RCC_CLOCK_HSI       /**< source of both PLL and PLLI2S, HAL_RCC_CLOCK_HSI or HAL_RCC_CLOCK_HSE*/
+#define HAL_RCC_CFG_PLL_ENABLE 0                       /**< enable the main PLL output (PLLCLK)*/
+#define HAL_RCC_CFG_PLL_OUTPUT 168000000               /**< speed of PLLCLK (25 MHZ to 168 MHZ)*/
+#define HAL_RCC_CFG_PLL48_ENABLE 0                     /**< enable the 48 MHZ output (PLL48CLK) used by USB OTG FS, SDIO and RNG*/
+#define HAL_RCC_CFG_PLLI2S_ENABLE 0                    /**< enable the PLLI2S output (PLLI2SCLK)*/
+#define HAL_RCC_CFG_PLLI2S_OUTPUT 25000000             /**< speed of PLLI2SCLK (25 MHZ to 192 MHZ)*/
+#define HAL_RCC_CFG_AHB_PRESCALER 1                    /**< SYSCLK to HCLK division factor*/
+#define HAL_RCC_CFG_APB1_PRESCALER 4                   /**< HCLK to PCLK1 division factor*/
+#define HAL_RCC_CFG_APB2_PRESCALER 4                   /**< HCLK to PCLK2 division factor*/
+
+/**
+ * @user_todo: user shall edit these configurations if he is switching clock profiles during runtime (refer to @HAL_RCC_ClockProfile_t).
+ * @brief: HAL_RCC_CFG_MAX_RATE_NOTIFIERS is the maximum number of drivers that can be notified before/after the clock profile changes, HAL_RCC_CFG_FLASH_WAIT_STATE_STEP is the HCLK step
+ *         that needs one more flash wait state, refer to @HAL_FLASH_TABLE_WAIT_STATES in "flash_config.h" (30 MHZ for 2.7 V - 3.6 V, 24 MHZ for 2.4 V - 2.7 V, 22 MHZ for 2.1 V - 2.4 V).
+ */
+#define HAL_RCC_CFG_MAX_RATE_NOTIFIERS 8
+#define HAL_RCC_CFG_FLASH_WAIT_STATE_STEP 30000000
+
+/**
+ * @user_todo: user shall edit this configuration if clock security system is enabled.
+ * @brief: number of polls of HSERDY before HAL_RCC_RetryHSE() gives up on the crystal, HSE startup takes up to 2 ms (refer to HAL_RCC_RetryHSE() in "RCC_header.h").
+ */
+#define HAL_RCC_CFG_HSE_STARTUP_TIMEOUT 100000
+
+/**
+ * @user_todo: user shall edit these configurations if HSI is calibrated against LSE (refer to HAL_RCC_CalibrateHSI() in "RCC_header.h").
+ * @brief: HAL_RCC_CFG_HSI_TRIM_CAPTURES is the number of TIM5 captures per measurement where every capture is 8 LSE periods (32 -> 7.8 ms, 64 at most),
+ *         HAL_RCC_CFG_LSE_CAPTURE_TIMEOUT is the number of polls of the capture flag before LSE is considered not running.
+ */
+#define HAL_RCC_CFG_HSI_TRIM_CAPTURES 32
+#define HAL_RCC_CFG_LSE_CAPTURE_TIMEOUT 100000
+
+/**
+ * @user_todo: user shall edit these configurations if reset causes have to be kept across resets (refer to HAL_RCC_GetResetHistory() in "RCC_header.h").
+ * @brief: HAL_RCC_CFG_RESET_HISTORY_ENABLE is 1 to let HAL_RCC_Init() add a record for every reset to a ring in backup SRAM,
+ *         HAL_RCC_CFG_RESET_HISTORY_DEPTH is the number of kept resets (1 to 32), the ring takes 32 + 28 * depth bytes,
+ *         HAL_RCC_CFG_RESET_HISTORY_OFFSET is the byte offset of the ring inside backup SRAM (4 KB), it has to be a multiple of 4.
+ */
+#define HAL_RCC_CFG_RESET_HISTORY_ENABLE 0
+#define HAL_RCC_CFG_RESET_HISTORY_DEPTH 8
+#define HAL_RCC_CFG_RESET_HISTORY_OFFSET 0
+
 /******************************************************************************
  * Macros
  *******************************************************************************/
@@ -463,6 +522,20 @@ typedef struct
     uint32_t PLLI2SOutputValue; /**< possible values are values that are multiple of 1000000 which is 1 MHZ and higher than 25 MHZ but less than 192 MHZ,, so 1500 isn't possible value but 150000000 which is 150 MHZ is possible, this PLLI2S is used to be source clock of I2S module that require high speed */
 } HAL_RCC_PLL_ClockConfig_t;
 
+/**
+ * @struct: HAL_RCC_ClockProfile_t
+ * @brief: a clock profile that the system can switch to during runtime using HAL_RCC_SetClockProfile(), PLL source, PLL48CLK and PLLI2SCLK stay as configured by
+ *         @HAL_RCC_CLOCK_TREE_TARGETS, only the main PLL output, system clock source and bus prescalers change.
+ */
+typedef struct
+{
+    uint32_t PLLOutputValue;          /**< speed of the main PLL output (25 MHZ to 168 MHZ), only used when SYSClkClockSource is HAL_RCC_SYSCLK_CLK_SRC_PLL*/
+    uint16_t SYSCLK_to_AHB_Prescalar; /**< possible values are 1, 2, 4, 8, 16, 64, 128, 256, 512, Max AHB BUS FREQUENCY IS 168 MHZ.*/
+    uint8_t SYSClkClockSource;        /**< for possible values refer to @HAL_RCC_SYSCLK_ClockSource_t in "RCC_config.h"*/
+    uint8_t AHB_to_APB1_Prescalar;    /**< possible values are 1, 2, 4, 8, 16, Max APB1 BUS FREQUENCY IS 42 MHZ.*/
+    uint8_t AHB_to_APB2_Prescalar;    /**< possible values are 1, 2, 4, 8, 16, Max APB2 BUS FREQUENCY IS 84 MHZ.*/
+} HAL_RCC_ClockProfile_t;
+
 /**
  * @struct: HAL_RCC_Miscellaneous_t
  * @brief: used to configure other Miscellaneous peripherals clock sources.
@@ -507,15 +580,15 @@ typedef struct
  *******************************************************************************/
 
 /**
- * @user_todo: user must edit this array with his needed configurations.
  * @brief: it represents clock configurations related to the whole system.
+ * @note: it's filled from the clock tree targets, refer to @HAL_RCC_CLOCK_TREE_TARGETS.
  */
 const HAL_RCC_SYSCLK_ClockConfig_t globalConstArr_RCC_SYSCLK_ClockConfig_t[] = {
     {
-        .SYSClkClockSource = HAL_RCC_SYSCLK_CLK_SRC_HSI,
-        .SYSCLK_to_AHB_Prescalar = 1,
-        .AHB_to_APB1_Prescalar = 4,
-        .AHB_to_APB2_Prescalar = 4,
+        .SYSClkClockSource = HAL_RCC_CFG_SYSCLK_SOURCE,
+        .SYSCLK_to_AHB_Prescalar = HAL_RCC_CFG_AHB_PRESCALER,
+        .AHB_to_APB1_Prescalar = HAL_RCC_CFG_APB1_PRESCALER,
+        .AHB_to_APB2_Prescalar = HAL_RCC_CFG_APB2_PRESCALER,
     }
 
 };
@@ -527,7 +600,7 @@ const HAL_RCC_SYSCLK_ClockConfig_t globalConstArr_RCC_SYSCLK_ClockConfig_t[] = {
 const HAL_RCC_Miscellaneous_t globalConstArr_RCC_MiscellaneousConfig_t[] = {{
     .I2SClockSource = HAL_RCC_I2S_CLK_SRC_EXT_I2S,
     .EthernetMACPrescalar = 1,
-    .HSEVal = 4000000,
+    .HSEVal = HAL_RCC_CFG_HSE_VALUE,
     .ClockSecurityEnable = LIB_CONSTANTS_DISABLED,
 }
 
@@ -539,9 +612,9 @@ const HAL_RCC_Miscellaneous_t globalConstArr_RCC_MiscellaneousConfig_t[] = {{
  */
 const HAL_RCC_ClocksEnablement_t globalConstArr_RCC_ClocksEnable_t[] = {
     {
-        .PLL_ClkEnable = LIB_CONSTANTS_DISABLED,
-        .PLLI2S_ClkEnable = LIB_CONSTANTS_DISABLED,
-        .PLL48_ClkEnable = LIB_CONSTANTS_DISABLED,
+        .PLL_ClkEnable = HAL_RCC_CFG_PLL_ENABLE,
+        .PLLI2S_ClkEnable = HAL_RCC_CFG_PLLI2S_ENABLE,
+        .PLL48_ClkEnable = HAL_RCC_CFG_PLL48_ENABLE,
         .HSI_ClkEnable = LIB_CONSTANTS_ENABLED,
         .HSE_ClkEnable = LIB_CONSTANTS_DISABLED,
         .LSI_ClkEnable = LIB_CONSTANTS_DISABLED,
@@ -551,14 +624,14 @@ const HAL_RCC_ClocksEnablement_t globalConstArr_RCC_ClocksEnable_t[] = {
 };
 
 /**
- * @user_todo: user shall edit this array with his needed configurations (only modify it if you are configuring PLL and/or PLLI2S)
  * @brief: it represents the configurations for PLL
+ * @note: it's filled from the clock tree targets, refer to @HAL_RCC_CLOCK_TREE_TARGETS.
  */
 const HAL_RCC_PLL_ClockConfig_t globalConstArr_RCC_PLL_ClockConfig_t[] = {
     {
-        .PLLClockSource = HAL_RCC_PLL_CLK_SRC_HSI,
-        .PLLOutputValue = 168000000,   /**< 168 MHZ*/
-        .PLLI2SOutputValue = 25000000, /**< 25 MHZ*/
+        .PLLClockSource = HAL_RCC_CFG_PLL_SOURCE,
+        .PLLOutputValue = HAL_RCC_CFG_PLL_OUTPUT,
+        .PLLI2SOutputValue = HAL_RCC_CFG_PLLI2S_OUTPUT,
     }
 
 };
@@ -590,6 +663,34 @@ const HAL_RCC_RTC_ClockConfig_t globalConstArr_RCC_RTC_ClockConfig_t[] = {
 
 };
 
+/**
+ * @user_todo: user shall edit this array with his needed profiles (only used if he is switching clock profiles during runtime)
+ * @brief: it represents the clock profiles selected by their index using HAL_RCC_SetClockProfile()
+ */
+const HAL_RCC_ClockProfile_t globalConstArr_RCC_ClockProfiles_t[] = {
+    {
+        .SYSClkClockSource = HAL_RCC_SYSCLK_CLK_SRC_PLL, /**< full speed*/
+        .PLLOutputValue = 168000000,
+        .SYSCLK_to_AHB_Prescalar = 1,
+        .AHB_to_APB1_Prescalar = 4,
+        .AHB_to_APB2_Prescalar = 2,
+    },
+    {
+        .SYSClkClockSource = HAL_RCC_SYSCLK_CLK_SRC_PLL, /**< half speed*/
+        .PLLOutputValue = 84000000,
+        .SYSCLK_to_AHB_Prescalar = 1,
+        .AHB_to_APB1_Prescalar = 2,
+        .AHB_to_APB2_Prescalar = 1,
+    },
+    {
+        .SYSClkClockSource = HAL_RCC_SYSCLK_CLK_SRC_HSI, /**< idle*/
+        .PLLOutputValue = 0,
+        .SYSCLK_to_AHB_Prescalar = 1,
+        .AHB_to_APB1_Prescalar = 1,
+        .AHB_to_APB2_Prescalar = 1,
+    },
+};
+
 /**
  * @user_todo: user shall edit this array with his needed configurations
  * @brief: it represents the configurations for enabling peripherals in run and sleep modes.
@@ -83,10 +83,18 @@
  */
 typedef enum
 {
-    HAL_RCC_OK,                  /**< it means everything has gone as intended so no errors*/
-    HAL_RCC_ERR_INVALID_PARAMS,  /**< it means that the supplied parameters of the function are invalid*/
-    HAL_RCC_ERR_INVALID_CONFIG,  /**< it means that the supplied configurations in the "RCC_config.h" file are incorrect*/
-    HAL_RCC_ERR_INVALID_CLK_VAL, /**< it means that the entered clock value couldn't be configured (mostly it's due to PLL,PLLI2S vals)*/
+    HAL_RCC_OK,                     /**< it means everything has gone as intended so no errors*/
+    HAL_RCC_ERR_INVALID_PARAMS,     /**< it means that the supplied parameters of the function are invalid*/
+    HAL_RCC_ERR_INVALID_CONFIG,     /**< it means that the supplied configurations in the "RCC_config.h" file are incorrect*/
+    HAL_RCC_ERR_INVALID_CLK_VAL,    /**< it means that the entered clock value couldn't be configured (mostly it's due to PLL,PLLI2S vals)*/
+    HAL_RCC_ERR_NOTIFIERS_FULL,     /**< it means that all the rate notifiers are used (refer to HAL_RCC_CFG_MAX_RATE_NOTIFIERS in "RCC_config.h")*/
+    HAL_RCC_ERR_CLOCK_USERS_FULL,   /**< it means that the peripheral clock is acquired by 255 users and can't be acquired again*/
+    HAL_RCC_ERR_CLOCK_NOT_ACQUIRED, /**< it means that the peripheral clock is released while no one acquired it*/
+    HAL_RCC_ERR_HSE_NOT_READY,      /**< it means that HSE didn't start within HAL_RCC_CFG_HSE_STARTUP_TIMEOUT polls (refer to "RCC_config.h")*/
+    HAL_RCC_ERR_LSE_NOT_READY,      /**< it means that LSE isn't running so it can't be used as a reference*/
+    HAL_RCC_ERR_HSI_NOT_TRIMMED,    /**< it means that no HSITRIM value brings HSI error within the requested limit*/
+    HAL_RCC_ERR_NO_RESET_RECORD,    /**< it means that the reset history doesn't hold a record at the requested index*/
+    HAL_RCC_ERR_CAPTURE_OVERRUN,    /**< it means that LSE captures kept being lost (TIM5 overcapture) so HSI couldn't be measured*/
 } HAL_RCC_ErrStates_t;
 
 /**
@@ -200,6 +208,61 @@ typedef enum
     HAL_RCC_MAX_RESET_CAUSE_TYPE,              /**< that value should never be used and it's only used by the implementation code for verifying the input*/
 } HAL_RCC_ResetCause_t;
 
+/**
+ * @enum: HAL_RCC_ResetFlag_t
+ * @brief: it holds the bits of the reset flags mask, more than one flag can be set for the same reset (e.g. every reset drives NRST so PIN is set with the others)
+ */
+typedef enum
+{
+    HAL_RCC_RESET_FLAG_BOR = 0x01,                   /**< a BOR reset occurred.*/
+    HAL_RCC_RESET_FLAG_PIN = 0x02,                   /**< a reset from the NRST pin occurred.*/
+    HAL_RCC_RESET_FLAG_POR_PDR = 0x04,               /**< a POR/PDR reset occurred.*/
+    HAL_RCC_RESET_FLAG_SOFTWARE = 0x08,              /**< a software reset occurred.*/
+    HAL_RCC_RESET_FLAG_INDEPENDEDNT_WATCHDOG = 0x10, /**< an independent watchdog reset occurred.*/
+    HAL_RCC_RESET_FLAG_WINDOW_WATCHDOG = 0x20,       /**< a window watchdog reset occurred.*/
+    HAL_RCC_RESET_FLAG_LOW_POWER = 0x40,             /**< a Low-power management reset occurred.*/
+} HAL_RCC_ResetFlag_t;
+
+/**
+ * @struct: HAL_RCC_ResetRecord_t
+ * @brief: contains what is known about one reset in the reset history (refer to HAL_RCC_GetResetHistory()).
+ */
+typedef struct
+{
+    uint32_t BootNumber; /**< number of the boot since the history was initialized, it orders the records when RTC isn't running*/
+    uint32_t RTCTime;    /**< RTC_TR (BCD hours, minutes and seconds) at boot, 0 if RTC isn't running*/
+    uint32_t RTCDate;    /**< RTC_DR (BCD year, month and day) at boot, 0 if RTC isn't running*/
+    uint32_t FaultPC;    /**< program counter saved by HAL_RCC_SaveFaultContext() before the reset*/
+    uint32_t FaultCFSR;  /**< SCB configurable fault status register saved by HAL_RCC_SaveFaultContext() before the reset*/
+    uint32_t FaultHFSR;  /**< SCB hard fault status register saved by HAL_RCC_SaveFaultContext() before the reset*/
+    uint8_t Flags;       /**< mask of the reset flags, refer to @HAL_RCC_ResetFlag_t in "RCC_header.h"*/
+    uint8_t FaultValid;  /**< LIB_CONSTANTS_SUCCESS if the fault context members are saved for this reset*/
+} HAL_RCC_ResetRecord_t;
+
+/**
+ * @enum: HAL_RCC_I2SFrame_t
+ * @brief: it holds the I2S frame formats, used when master clock output is disabled as the bit clock depends on the frame length
+ */
+typedef enum
+{
+    HAL_RCC_I2S_FRAME_16BIT, /**< 16 bit data in 16 bit channel (bit clock = 32 * Fs)*/
+    HAL_RCC_I2S_FRAME_32BIT, /**< 16/24/32 bit data in 32 bit channel (bit clock = 64 * Fs)*/
+    HAL_RCC_MAX_I2S_FRAME,   /**< that value should never be used and it's only used by the implementation code for verifying the input*/
+} HAL_RCC_I2SFrame_t;
+
+/**
+ * @struct: HAL_RCC_I2SClock_t
+ * @brief: contains the PLLI2S dividers and the I2S prescaler found by HAL_RCC_SolveI2SClock() for a sample rate.
+ */
+typedef struct
+{
+    uint16_t PLLI2SN; /**< PLLI2S multiplication factor for VCO (50 to 432)*/
+    uint8_t PLLI2SR;  /**< PLLI2S division factor for I2S clocks (2 to 7)*/
+    uint8_t I2SDIV;   /**< linear prescaler of the I2S peripheral (SPI_I2SPR.I2SDIV), from 2 to 255*/
+    uint8_t I2SODD;   /**< odd factor of the I2S prescaler (SPI_I2SPR.ODD), the I2S clock is divided by (2 * I2SDIV + I2SODD)*/
+    int32_t ErrorPPM; /**< error of the generated sample rate in ppm, positive means faster than the requested sample rate*/
+} HAL_RCC_I2SClock_t;
+
 /******************************************************************************
  * Variables
  *******************************************************************************/
@@ -215,7 +278,8 @@ typedef enum
  *  @note                           :       This shall be the first function to be called before using any other function in this interface, also it's a blocking function
  *                                          IT IS ADVISED TO CALL HAL_RCC_Init() BEFORE CALLING ANY OTHER FUNCTION
  *  \b PRE-CONDITION                :       make sure to edit all configurations in file "RCC_config.h" (any array labeled with @user_todo shall be edited)
- *  \b POST-CONDITION               :       it configures the Clock sources.
+ *  \b POST-CONDITION               :       it configures the Clock sources, PLL/PLLI2S dividers and bus prescalers are solved at build time from @HAL_RCC_CLOCK_TREE_TARGETS in "RCC_config.h"
+ *                                          so only their register values are written, then it waits for HSE, PLL and PLLI2S to be ready and for the system clock switch.
  *                                          it configures all peripherals enablement of RCC clock during sleep and run mode.
  *  @return                         :       it return one of error states indicating whether a failure or success happened during initialization (refer to @HAL_RCC_ErrStates_t in "RCC_header.h")
  *  @see                            :       HAL_RCC_PeripheralModify(const uint8_t argConst_u8PeripheralName, const uint8_t argConst_u8Operation)
@@ -240,6 +304,8 @@ typedef enum
  * <table align="left" style="width:800px">
  * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
  * <tr><td> 26/08/2023 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.1            </td><td> AMS      </td><td> clock tree solved at build time </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.2            </td><td> AMS      </td><td> enable registers built from the peripheral bits </td></tr>
  * </table><br><br>
  * <hr>
  */
@@ -250,7 +316,8 @@ HAL_RCC_ErrStates_t HAL_RCC_Init();
  *  \b Description                              :       this functions is used to modify peripheral during runtime like enable\reset\disable\low_power_enable\low_power_disable\etc...
  *  @param  argConst_u8PeripheralName [IN]      :       for possible values refer to @HAL_RCC_Peripherals_t in "RCC_header.h", this is input parameter which indicates which peripheral to modify.
  *  @param  argConst_u8Operation [IN]           :       for possible values refer to @HAL_RCC_PeripheralOperation_t in "RCC_header.h", this is input parameter which indicates which operation to perform on the peripheral.
- *  @note                                       :       None.
+ *  @note                                       :       HAL_RCC_PERI_OP_ENABLE and HAL_RCC_PERI_OP_DISABLE add and remove one user like HAL_RCC_ClockAcquire() and HAL_RCC_ClockRelease(),
+ *                                                  so disabling gates the clock only when no driver uses it anymore and disabling a clock without users returns HAL_RCC_ERR_CLOCK_NOT_ACQUIRED.
  *  \b PRE-CONDITION                            :       make sure to call HAL_RCC_Init().
  *  \b POST-CONDITION                           :       MCU peripheral status changes according to the desired operation.
  *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_RCC_ErrStates_t in "RCC_header.h")
@@ -277,18 +344,382 @@ HAL_RCC_ErrStates_t HAL_RCC_Init();
  * <table align="left" style="width:800px">
  * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
  * <tr><td> 27/08/2023 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.1            </td><td> AMS      </td><td> table driven, reset is released after being asserted </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.2            </td><td> AMS      </td><td> enable and disable counted with the clock users </td></tr>
  * </table><br><br>
  * <hr>
  */
 HAL_RCC_ErrStates_t HAL_RCC_PeripheralModify(const uint8_t argConst_u8PeripheralName, const uint8_t argConst_u8Operation);
 
+/**
+ *  \b function                                 :       HAL_RCC_ErrStates_t HAL_RCC_PeripheralModifyGroup(const uint8_t *const argConst_pu8Peripherals, const uint8_t argConst_u8Count, const uint8_t argConst_u8Operation)
+ *  \b Description                              :       this functions is used to apply the same operation to a group of peripherals with one read-modify-write per register.
+ *  @param  argConst_pu8Peripherals [IN]        :       array of peripherals to modify, for possible values of every element refer to @HAL_RCC_Peripherals_t in "RCC_header.h".
+ *  @param  argConst_u8Count [IN]               :       number of elements in argConst_pu8Peripherals, it can't be 0.
+ *  @param  argConst_u8Operation [IN]           :       for possible values refer to @HAL_RCC_PeripheralOperation_t in "RCC_header.h", this is input parameter which indicates which operation to perform on the peripherals.
+ *  @note                                       :       nothing is modified if any element of argConst_pu8Peripherals is invalid, enabling and disabling are counted for every element
+ *                                                  as in HAL_RCC_PeripheralModify() and the error of a failing element is returned after the others are applied.
+ *  \b PRE-CONDITION                            :       make sure to call HAL_RCC_Init().
+ *  \b POST-CONDITION                           :       MCU peripherals status changes according to the desired operation.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_RCC_ErrStates_t in "RCC_header.h")
+ *  @see                                        :       HAL_RCC_PeripheralModify(const uint8_t argConst_u8PeripheralName, const uint8_t argConst_u8Operation)
+ *
+ *  \b Example:
+ * @code
+ * #include "RCC_header.h"
+ * int main() {
+ * HAL_RCC_Init();    // make sure that you edited any array in "RCC_config.h" labeled with @user_todo so that RCC can be initialized correctly
+ * const uint8_t local_u8Peripherals[] = {HAL_RCC_PERIPHERAL_GPIOA, HAL_RCC_PERIPHERAL_GPIOB, HAL_RCC_PERIPHERAL_USART2, HAL_RCC_PERIPHERAL_TIM2};
+ * HAL_RCC_ErrStates_t local_errState_t = HAL_RCC_PeripheralModifyGroup(local_u8Peripherals, 4, HAL_RCC_PERI_OP_ENABLE);
+ * if (local_errState_t == HAL_RCC_OK)
+ * {
+ *  // RCC_AHB1ENR and RCC_APB1ENR are written once each
+ * }
+ * return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.1            </td><td> AMS      </td><td> enable and disable counted with the clock users </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_RCC_ErrStates_t HAL_RCC_PeripheralModifyGroup(const uint8_t *const argConst_pu8Peripherals, const uint8_t argConst_u8Count, const uint8_t argConst_u8Operation);
+
+/**
+ *  \b function                                 :       HAL_RCC_ErrStates_t HAL_RCC_ClockAcquire(const uint8_t argConst_u8PeripheralName)
+ *  \b Description                              :       this functions is used by a driver to state that it uses the clock of a peripheral, the clock is enabled in run and sleep modes when the first user acquires it.
+ *  @param  argConst_u8PeripheralName [IN]      :       for possible values refer to @HAL_RCC_Peripherals_t in "RCC_header.h", this is input parameter which indicates the peripheral whose clock is used.
+ *  @note                                       :       every call has to be matched with a call to HAL_RCC_ClockRelease(), it's safe to be called from interrupts,
+ *                                                  a clock found enabled without users (turned on outside this interface) is counted as one existing user.
+ *  \b PRE-CONDITION                            :       make sure to call HAL_RCC_Init().
+ *  \b POST-CONDITION                           :       peripheral clock is enabled in run and sleep modes.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_RCC_ErrStates_t in "RCC_header.h")
+ *  @see                                        :       HAL_RCC_ClockRelease(const uint8_t argConst_u8PeripheralName)
+ *
+ *  \b Example:
+ * @code
+ * #include "RCC_header.h"
+ * int main() {
+ * HAL_RCC_Init();    // make sure that you edited any array in "RCC_config.h" labeled with @user_todo so that RCC can be initialized correctly
+ * HAL_RCC_ErrStates_t local_errState_t = HAL_RCC_ClockAcquire(HAL_RCC_PERIPHERAL_SPI1);
+ * if (local_errState_t == HAL_RCC_OK)
+ * {
+ *  // SPI1 is clocked till its last user releases it
+ * }
+ * return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.1            </td><td> AMS      </td><td> running clock without users counted as one user </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_RCC_ErrStates_t HAL_RCC_ClockAcquire(const uint8_t argConst_u8PeripheralName);
+
+/**
+ *  \b function                                 :       HAL_RCC_ErrStates_t HAL_RCC_ClockRelease(const uint8_t argConst_u8PeripheralName)
+ *  \b Description                              :       this functions is used by a driver to state that it no more uses the clock of a peripheral, the clock is disabled in run and sleep modes when the last user releases it.
+ *  @param  argConst_u8PeripheralName [IN]      :       for possible values refer to @HAL_RCC_Peripherals_t in "RCC_header.h", this is input parameter which indicates the peripheral whose clock isn't used anymore.
+ *  @note                                       :       HAL_RCC_Init() counts every peripheral enabled in run mode by globalConstArr_RCCEnablementConfig_t as one user,
+ *                                                  so drivers acquiring and releasing it never gate it.
+ *  \b PRE-CONDITION                            :       the clock is acquired using HAL_RCC_ClockAcquire().
+ *  \b POST-CONDITION                           :       peripheral clock is disabled in run and sleep modes if no one else uses it.
+ *  @return                                     :       it return one of error states indicating whether a failure or success happened (refer to @HAL_RCC_ErrStates_t in "RCC_header.h")
+ *  @see                                        :       HAL_RCC_ClockAcquire(const uint8_t argConst_u8PeripheralName)
+ *
+ *  \b Example:
+ * @code
+ * #include "RCC_header.h"
+ * int main() {
+ * HAL_RCC_Init();    // make sure that you edited any array in "RCC_config.h" labeled with @user_todo so that RCC can be initialized correctly
+ * HAL_RCC_ClockAcquire(HAL_RCC_PERIPHERAL_SPI1);
+ * // use SPI1
+ * HAL_RCC_ErrStates_t local_errState_t = HAL_RCC_ClockRelease(HAL_RCC_PERIPHERAL_SPI1);
+ * if (local_errState_t == HAL_RCC_OK)
+ * {
+ *  // SPI1 clock is gated
+ * }
+ * return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.1            </td><td> AMS      </td><td> clocks enabled at boot are counted as one user </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_RCC_ErrStates_t HAL_RCC_ClockRelease(const uint8_t argConst_u8PeripheralName);
+
+/**
+ *  \b function                             :       HAL_RCC_ErrStates_t HAL_RCC_RetryHSE(void)
+ *  \b Description                          :       this functions is used to bring the clock tree back to HSE after clock security system switched it to HSI, it's meant to be called periodically (from a timer or the main loop).
+ *  @note                                   :       when HSE fails, RCC_IRQHandler() rebuilds main PLL and PLLI2S from HSI with the same outputs if possible (otherwise the system runs from HSI at 16 MHZ),
+ *                                                  updates the peripheral frequencies and calls the post change rate notifiers then the HAL_RCC_CALLBACK_CLOCK_SECURITY callback.
+ *                                                  clock security interrupt is connected to NMI so NMI handler has to call RCC_IRQHandler().
+ *                                                  it does nothing and returns HAL_RCC_OK if HSE didn't fail, every failed retry busy waits HAL_RCC_CFG_HSE_STARTUP_TIMEOUT polls.
+ *  \b PRE-CONDITION                        :       clock security system is enabled in "RCC_config.h".
+ *  \b POST-CONDITION                       :       if HSE is stable again, PLLs, system clock and clock security system are restored as they were before the failure and rate notifiers are called.
+ *  @return                                 :       it return one of error states indicating whether a failure or success happened (refer to @HAL_RCC_ErrStates_t in "RCC_header.h")
+ *  @see                                    :       HAL_RCC_RegisterRateNotifier(const functionCallBack_t argConst_pPreChange, const functionCallBack_t argConst_pPostChange)
+ *  @see                                    :       HAL_RCC_RegisterCallback(const uint8_t argConst_u8CallBackType, const functionCallBack_t argConst_pFunctionCallBack)
+ *
+ *  \b Example:
+ * @code
+ * #include "RCC_header.h"
+ * void SysTick_Handler(void) {
+ *  // every second
+ *  if (HAL_RCC_RetryHSE() == HAL_RCC_ERR_HSE_NOT_READY)
+ *  {
+ *      // still running from the backup clock
+ *  }
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_RCC_ErrStates_t HAL_RCC_RetryHSE(void);
+
+/**
+ *  \b function                             :       HAL_RCC_ErrStates_t HAL_RCC_CalibrateHSI(const uint32_t argConst_u32MaxErrorPPM, int32_t *const arg_Constps32ErrorPPM)
+ *  \b Description                          :       this functions is used to trim HSI (RCC_CR.HSITRIM) against LSE, TIM5 channel 4 captures LSE while being clocked from HSI,
+ *                                                  HSITRIM is moved one step at a time till the error is within the limit or crosses zero, then the best value is kept.
+ *  @param  argConst_u32MaxErrorPPM [IN]    :       this is input parameter which is the accepted HSI error in ppm (HSITRIM step is about 5000 ppm).
+ *  @param  arg_Constps32ErrorPPM [OUT]     :       this is output parameter which is the HSI error in ppm (100 ppm resolution) with the kept HSITRIM, positive means HSI is faster than 16 MHZ.
+ *  @note                                   :       temperature and voltage change HSI so it's meant to be called periodically or when temperature changes,
+ *                                                  every step takes HAL_RCC_CFG_HSI_TRIM_CAPTURES * 8 LSE periods (7.8 ms by default) and TIM5 registers are restored at the end,
+ *                                                  a measurement losing a capture (interrupts delaying the polling) is started again and HAL_RCC_ERR_CAPTURE_OVERRUN is returned if it keeps happening.
+ *  \b PRE-CONDITION                        :       LSE is running, system clock is HSI or main PLL fed from HSI and TIM5 isn't used while calibrating.
+ *  \b POST-CONDITION                       :       HSITRIM holds the value with the lowest measured error.
+ *  @return                                 :       it return one of error states indicating whether a failure or success happened (refer to @HAL_RCC_ErrStates_t in "RCC_header.h")
+ *  @see                                    :       HAL_RCC_GetPeripheralInputFrequency(const uint8_t argConst_u8PeripheralName, uint32_t *const arg_Constpu32Value)
+ *
+ *  \b Example:
+ * @code
+ * #include "RCC_header.h"
+ * int main() {
+ * HAL_RCC_Init();    // make sure that you edited any array in "RCC_config.h" labeled with @user_todo so that RCC can be initialized correctly
+ * int32_t local_s32ErrorPPM = 0;
+ * HAL_RCC_ErrStates_t local_errState_t = HAL_RCC_CalibrateHSI(5000, &local_s32ErrorPPM);
+ * if (local_errState_t == HAL_RCC_OK)
+ * {
+ *  // HSI is within 0.5 % so UARTs can run from it
+ * }
+ * return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.1            </td><td> AMS      </td><td> lost captures restart the measurement </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_RCC_ErrStates_t HAL_RCC_CalibrateHSI(const uint32_t argConst_u32MaxErrorPPM, int32_t *const arg_Constps32ErrorPPM);
+
+/**
+ *  \b function                             :       HAL_RCC_ErrStates_t HAL_RCC_SolveI2SClock(const uint32_t argConst_u32SampleRate, const uint8_t argConst_u8Frame, const uint8_t argConst_u8MCLKEnable, HAL_RCC_I2SClock_t *const arg_constpI2SClock)
+ *  \b Description                          :       this functions is used to find PLLI2SN, PLLI2SR and the I2S prescaler giving the closest sample rate to the requested one,
+ *                                                  all the dividers are tried with the input divider M and the source of the running main PLL, it doesn't touch any register.
+ *  @param  argConst_u32SampleRate [IN]     :       this is input parameter which is the audio sample rate in HZ (8000 to 192000, 44.1 KHZ and 48 KHZ families)
+ *  @param  argConst_u8Frame [IN]           :       this is input parameter which is the frame format (refer to @HAL_RCC_I2SFrame_t in "RCC_header.h")
+ *  @param  argConst_u8MCLKEnable [IN]      :       this is input parameter which tells whether the master clock output (256 * Fs) is used (refer to @LIB_CONSTANTS_DriverStates_t in "constants.h")
+ *  @param  arg_constpI2SClock [OUT]        :       this is output parameter which holds the dividers and the error in ppm of the generated sample rate
+ *  @note                                   :       it takes few milliseconds as every PLLI2SN and PLLI2SR is tried, the I2S clock source has to be PLLI2S (I2SSRC = 0).
+ *  \b PRE-CONDITION                        :       RCC is initialized.
+ *  \b POST-CONDITION                       :       arg_constpI2SClock holds the dividers with the lowest error.
+ *  @return                                 :       it return one of error states indicating whether a failure or success happened (refer to @HAL_RCC_ErrStates_t in "RCC_header.h")
+ *  @see                                    :       HAL_RCC_SetI2SClock(const HAL_RCC_I2SClock_t *const argConst_pI2SClock)
+ *
+ *  \b Example:
+ * @code
+ * #include "RCC_header.h"
+ * int main() {
+ * HAL_RCC_Init();    // make sure that you edited any array in "RCC_config.h" labeled with @user_todo so that RCC can be initialized correctly
+ * HAL_RCC_I2SClock_t local_I2SClock_t;
+ * HAL_RCC_ErrStates_t local_errState_t = HAL_RCC_SolveI2SClock(44100, HAL_RCC_I2S_FRAME_16BIT, LIB_CONSTANTS_ENABLED, &local_I2SClock_t);
+ * if (local_errState_t == HAL_RCC_OK && local_I2SClock_t.ErrorPPM < 100 && local_I2SClock_t.ErrorPPM > -100)
+ * {
+ *  HAL_RCC_SetI2SClock(&local_I2SClock_t);
+ *  // write local_I2SClock_t.I2SDIV and local_I2SClock_t.I2SODD in SPI_I2SPR of the used I2S
+ * }
+ * return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_RCC_ErrStates_t HAL_RCC_SolveI2SClock(const uint32_t argConst_u32SampleRate, const uint8_t argConst_u8Frame, const uint8_t argConst_u8MCLKEnable, HAL_RCC_I2SClock_t *const arg_constpI2SClock);
+
+/**
+ *  \b function                             :       HAL_RCC_ErrStates_t HAL_RCC_SetI2SClock(const HAL_RCC_I2SClock_t *const argConst_pI2SClock)
+ *  \b Description                          :       this functions is used to program PLLI2SN and PLLI2SR found by HAL_RCC_SolveI2SClock(), PLLI2S is stopped, reprogrammed
+ *                                                  and selected as the I2S clock source then it waits till PLLI2S is locked.
+ *  @param  argConst_pI2SClock [IN]         :       this is input parameter which holds the dividers found by HAL_RCC_SolveI2SClock()
+ *  @note                                   :       the I2S prescaler (I2SDIV and I2SODD) belongs to the SPI/I2S peripheral so it has to be written by its driver,
+ *                                                  clock profile switching and clock security system failover bring PLLI2S back to HAL_RCC_CFG_PLLI2S_OUTPUT in "RCC_config.h".
+ *                                                  dividers putting the PLLI2S VCO (from the running source and M) outside 100 MHz to 432 MHz or the output above 192 MHz return HAL_RCC_ERR_INVALID_CLK_VAL.
+ *  \b PRE-CONDITION                        :       RCC is initialized and no I2S is running.
+ *  \b POST-CONDITION                       :       PLLI2S is running with the new dividers.
+ *  @return                                 :       it return one of error states indicating whether a failure or success happened (refer to @HAL_RCC_ErrStates_t in "RCC_header.h")
+ *  @see                                    :       HAL_RCC_SolveI2SClock(const uint32_t argConst_u32SampleRate, const uint8_t argConst_u8Frame, const uint8_t argConst_u8MCLKEnable, HAL_RCC_I2SClock_t *const arg_constpI2SClock)
+ *
+ *  \b Example:
+ * @code
+ * #include "RCC_header.h"
+ * int main() {
+ * HAL_RCC_Init();    // make sure that you edited any array in "RCC_config.h" labeled with @user_todo so that RCC can be initialized correctly
+ * HAL_RCC_I2SClock_t local_I2SClock_t;
+ * HAL_RCC_SolveI2SClock(48000, HAL_RCC_I2S_FRAME_32BIT, LIB_CONSTANTS_DISABLED, &local_I2SClock_t);
+ * HAL_RCC_ErrStates_t local_errState_t = HAL_RCC_SetI2SClock(&local_I2SClock_t);
+ * return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.1            </td><td> AMS      </td><td> PLLI2S VCO and output ranges are checked </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_RCC_ErrStates_t HAL_RCC_SetI2SClock(const HAL_RCC_I2SClock_t *const argConst_pI2SClock);
+
+/**
+ *  \b function                             :       HAL_RCC_ErrStates_t HAL_RCC_GetResetFlags(uint8_t *const arg_Constpu8Flags)
+ *  \b Description                          :       this functions is used to return all the reset flags of the last reset.
+ *  @param  arg_Constpu8Flags [OUT]         :       this is output parameter which is a mask of @HAL_RCC_ResetFlag_t in "RCC_header.h"
+ *  @note                                   :       flags are latched once per boot (refer to HAL_RCC_GetSystemResetType()).
+ *  \b PRE-CONDITION                        :       None.
+ *  \b POST-CONDITION                       :       reset flags of RCC_CSR are cleared.
+ *  @return                                 :       it return one of error states indicating whether a failure or success happened (refer to @HAL_RCC_ErrStates_t in "RCC_header.h")
+ *  @see                                    :       HAL_RCC_GetSystemResetType(uint8_t *const arg_Constpu8Value)
+ *
+ *  \b Example:
+ * @code
+ * #include "RCC_header.h"
+ * int main() {
+ * uint8_t local_u8Flags = 0;
+ * HAL_RCC_ErrStates_t local_errState_t = HAL_RCC_GetResetFlags(&local_u8Flags);
+ * if (local_errState_t == HAL_RCC_OK && (local_u8Flags & HAL_RCC_RESET_FLAG_INDEPENDEDNT_WATCHDOG))
+ * {
+ *  // independent watchdog expired
+ * }
+ * return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_RCC_ErrStates_t HAL_RCC_GetResetFlags(uint8_t *const arg_Constpu8Flags);
+
+/**
+ *  \b function                             :       HAL_RCC_ErrStates_t HAL_RCC_SaveFaultContext(const uint32_t argConst_u32PC)
+ *  \b Description                          :       this functions is used to save the fault context (program counter, SCB CFSR and HFSR) in backup SRAM before a reset,
+ *                                                  the next HAL_RCC_Init() adds it to the record of that reset in the reset history.
+ *  @param  argConst_u32PC [IN]             :       this is input parameter which is the program counter of the faulting code (stacked PC in a fault handler or the
+ *                                                  interrupted PC in the window watchdog early wakeup interrupt)
+ *  @note                                   :       it doesn't reset the MCU, it's meant to be called from fault handlers and watchdog early wakeup interrupt.
+ *  \b PRE-CONDITION                        :       HAL_RCC_CFG_RESET_HISTORY_ENABLE is 1 in "RCC_config.h".
+ *  \b POST-CONDITION                       :       the context is kept in backup SRAM till the next HAL_RCC_Init().
+ *  @return                                 :       it return one of error states indicating whether a failure or success happened (refer to @HAL_RCC_ErrStates_t in "RCC_header.h")
+ *  @see                                    :       HAL_RCC_GetResetHistory(const uint8_t argConst_u8Index, HAL_RCC_ResetRecord_t *const arg_constpRecord)
+ *
+ *  \b Example:
+ * @code
+ * #include "RCC_header.h"
+ * void HardFault_Handler(void) {
+ * uint32_t *local_pu32Stack;
+ * __asm__ volatile("MRS %0, MSP" : "=r"(local_pu32Stack));
+ * HAL_RCC_SaveFaultContext(local_pu32Stack[6]);    // stacked PC
+ * // reset the MCU
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_RCC_ErrStates_t HAL_RCC_SaveFaultContext(const uint32_t argConst_u32PC);
+
+/**
+ *  \b function                             :       HAL_RCC_ErrStates_t HAL_RCC_GetResetHistory(const uint8_t argConst_u8Index, HAL_RCC_ResetRecord_t *const arg_constpRecord)
+ *  \b Description                          :       this functions is used to read a record of the reset history kept in backup SRAM, HAL_RCC_Init() adds a record
+ *                                                  for every reset holding its flags, boot number, RTC calendar and the fault context saved before it.
+ *  @param  argConst_u8Index [IN]           :       this is input parameter which is the index of the record, 0 is the current boot, 1 the one before it and so on
+ *  @param  arg_constpRecord [OUT]          :       this is output parameter which holds the record (refer to @HAL_RCC_ResetRecord_t in "RCC_header.h")
+ *  @note                                   :       backup SRAM keeps the history across resets while VDD is present, set BackUpEnable in "PWR_config.h" to keep it
+ *                                                  in Standby and VBAT modes too.
+ *  \b PRE-CONDITION                        :       HAL_RCC_CFG_RESET_HISTORY_ENABLE is 1 in "RCC_config.h" and HAL_RCC_Init() is called.
+ *  \b POST-CONDITION                       :       None.
+ *  @return                                 :       it return one of error states indicating whether a failure or success happened (refer to @HAL_RCC_ErrStates_t in "RCC_header.h")
+ *  @see                                    :       HAL_RCC_SaveFaultContext(const uint32_t argConst_u32PC)
+ *
+ *  \b Example:
+ * @code
+ * #include "RCC_header.h"
+ * int main() {
+ * HAL_RCC_Init();    // make sure that you edited any array in "RCC_config.h" labeled with @user_todo so that RCC can be initialized correctly
+ * HAL_RCC_ResetRecord_t local_Record_t;
+ * uint8_t local_u8Index = 0;
+ * while (HAL_RCC_GetResetHistory(local_u8Index, &local_Record_t) == HAL_RCC_OK)
+ * {
+ *  // report local_Record_t.Flags and local_Record_t.FaultPC
+ *  local_u8Index++;
+ * }
+ * return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_RCC_ErrStates_t HAL_RCC_GetResetHistory(const uint8_t argConst_u8Index, HAL_RCC_ResetRecord_t *const arg_constpRecord);
+
 /**
  *  \b function                             :       HAL_RCC_GetSystemResetType(const uint8_t *argConst_pu8Value)
  *  \b Description                          :       this functions is used to return what caused the last system reset.
  *  @param  argConst_pu8Value [OUT]         :       this is output parameter indicates what cased the last system reset, it will hold one of the value mentioned in  @HAL_RCC_ResetCause_t in "RCC_header.h"
- *  @note                                   :       this function once called, it will clear all the reset flags so it can't be called again.
+ *  @note                                   :       the reset flags are latched once per boot then cleared in RCC_CSR so the function gives the same cause every time it's called,
+ *                                                  when more than one flag is set the most specific one is returned (NRST pin is the last as every reset drives it),
+ *                                                  use HAL_RCC_GetResetFlags() to get all the flags.
  *  \b PRE-CONDITION                        :       None.
- *  \b POST-CONDITION                       :       it clears the reset flags.
+ *  \b POST-CONDITION                       :       reset flags of RCC_CSR are cleared.
  *  @return                                 :       it return one of error states indicating whether a failure or success regarding function operation
  *  @see                                    :       HAL_RCC_Init()
  *  @see                                    :       HAL_RCC_PeripheralModify(const uint8_t argConst_u8PeripheralName, const uint8_t argConst_u8Operation)
@@ -318,6 +749,7 @@ HAL_RCC_ErrStates_t HAL_RCC_PeripheralModify(const uint8_t argConst_u8Peripheral
  * <table align="left" style="width:800px">
  * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
  * <tr><td> 31/08/2023 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.1            </td><td> AMS      </td><td> software reset is detected, flags are latched once per boot instead of being cleared on the first call </td></tr>
  * </table><br><br>
  * <hr>
  */
@@ -328,7 +760,7 @@ HAL_RCC_ErrStates_t HAL_RCC_GetSystemResetType(uint8_t *const arg_Constpu8Value)
  *  \b Description                          :       this functions is used to return clock input frequency to a specific peripheral.
  *  @param  argConst_u8PeripheralName [IN]  :       this is input parameter which is the peripheral that you want to know what's the input clock frequency to it. for possible values refer to @HAL_RCC_Peripherals_t in "RCC_header.h".
  *  @param  argConst_pu8Value [OUT]         :       this is output parameter which is the input clock frequency in HZ to that peripheral.
- *  @note                                   :       None.
+ *  @note                                   :       timers get twice the APB clock when the APB prescaler isn't 1, frequencies are cached so the lookup takes the same time for every peripheral.
  *  \b PRE-CONDITION                        :       None.
  *  \b POST-CONDITION                       :       None.
  *  @return                                 :       it return one of error states indicating whether a failure or success regarding function operation
@@ -355,6 +787,7 @@ HAL_RCC_ErrStates_t HAL_RCC_GetSystemResetType(uint8_t *const arg_Constpu8Value)
  * <table align="left" style="width:800px">
  * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
  * <tr><td> 31/08/2023 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.1            </td><td> AMS      </td><td> table lookup and timer clock doubling </td></tr>
  * </table><br><br>
  * <hr>
  */
@@ -403,5 +836,82 @@ HAL_RCC_ErrStates_t HAL_RCC_GetPeripheralInputFrequency(const uint8_t argConst_u
  */
 HAL_RCC_ErrStates_t HAL_RCC_RegisterCallback(const uint8_t argConst_u8CallBackType, const functionCallBack_t argConst_pFunctionCallBack);
 
+/**
+ *  \b function                             :       HAL_RCC_ErrStates_t HAL_RCC_SetClockProfile(const uint8_t argConst_u8Profile)
+ *  \b Description                          :       this functions is used to switch the system clock to one of the clock profiles during runtime (e.g: drop to HSI during idle and go back to full speed PLL for bursts).
+ *  @param  argConst_u8Profile [IN]         :       this is input parameter which is the index of the profile inside globalConstArr_RCC_ClockProfiles_t in "RCC_config.h".
+ *  @note                                   :       it's a blocking function, the system runs from HSI while the PLL locks. flash wait states are increased before speeding up and decreased after slowing down,
+ *                                                  regulator voltage scaling (VOS) is changed while the main PLL is off. PWR clock is enabled to do so.
+ *                                                  the notifiers registered by HAL_RCC_RegisterRateNotifier() are called before and after the change.
+ *                                                  HSE is started before anything is changed, profiles running from HSE (directly or through the PLL) return HAL_RCC_ERR_HSE_NOT_READY
+ *                                                  if HSE doesn't start within HAL_RCC_CFG_HSE_STARTUP_TIMEOUT polls or while the system runs from HSI after HSE failure.
+ *                                                  profiles with HCLK below 25 MHZ return HAL_RCC_ERR_INVALID_CONFIG while the Ethernet clock is enabled (same rule as HAL_RCC_Init()).
+ *  \b PRE-CONDITION                        :       make sure to call HAL_RCC_Init() and that there is no flash memory operation going on.
+ *  \b POST-CONDITION                       :       system clock, bus prescalers, flash wait states and regulator voltage scaling follow the selected profile and HAL_RCC_GetPeripheralInputFrequency() returns the new frequencies.
+ *  @return                                 :       it return one of error states indicating whether a failure or success happened (refer to @HAL_RCC_ErrStates_t in "RCC_header.h")
+ *  @see                                    :       HAL_RCC_Init()
+ *  @see                                    :       HAL_RCC_RegisterRateNotifier(const functionCallBack_t argConst_pPreChange, const functionCallBack_t argConst_pPostChange)
+ *  @see                                    :       HAL_RCC_GetPeripheralInputFrequency(const uint8_t argConst_u8PeripheralName, uint32_t *const arg_Constpu32Value)
+ * \b Example:
+ * @code
+ * #include "RCC_header.h"
+ * int main() {
+ *  HAL_RCC_Init();                 // make sure that you edited any array in "RCC_config.h" labeled with @user_todo so that RCC can be initialized correctly
+ *  HAL_RCC_SetClockProfile(0);     // run the burst at the speed of the first profile
+ *  HAL_RCC_SetClockProfile(2);     // drop to the idle profile
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.1            </td><td> AMS      </td><td> bounded HSE startup and refused HSE profiles after HSE failure </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.2            </td><td> AMS      </td><td> HCLK of at least 25 MHZ while Ethernet is clocked </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_RCC_ErrStates_t HAL_RCC_SetClockProfile(const uint8_t argConst_u8Profile);
+
+/**
+ *  \b function                             :       HAL_RCC_ErrStates_t HAL_RCC_RegisterRateNotifier(const functionCallBack_t argConst_pPreChange, const functionCallBack_t argConst_pPostChange)
+ *  \b Description                          :       this functions is used by drivers to be notified when the clock profile changes so that they can stop their transfers before it and recompute their baud rates after it.
+ *  @param  argConst_pPreChange [IN]        :       this is the function to be called before the clock changes, it can be NULL.
+ *  @param  argConst_pPostChange [IN]       :       this is the function to be called after the clock changes, it can be NULL (new frequencies are read using HAL_RCC_GetPeripheralInputFrequency()).
+ *  @note                                   :       notifiers are called in the order they were registered, up to HAL_RCC_CFG_MAX_RATE_NOTIFIERS can be registered.
+ *  \b PRE-CONDITION                        :       make sure that at least one of the functions isn't NULL.
+ *  \b POST-CONDITION                       :       the functions are called on every call to HAL_RCC_SetClockProfile().
+ *  @return                                 :       it return one of error states indicating whether a failure or success happened (refer to @HAL_RCC_ErrStates_t in "RCC_header.h")
+ *  @see                                    :       HAL_RCC_SetClockProfile(const uint8_t argConst_u8Profile)
+ * \b Example:
+ * @code
+ * #include "RCC_header.h"
+ *
+ * void uartStop(void)      // called before the clock changes
+ * {
+ *  // wait for the current frame to be sent
+ * }
+ * void uartRecompute(void) // called after the clock changes
+ * {
+ *  // read the new APB frequency using HAL_RCC_GetPeripheralInputFrequency() and rewrite the baud rate register
+ * }
+ *
+ * int main() {
+ *  HAL_RCC_Init();
+ *  HAL_RCC_RegisterRateNotifier(uartStop, uartRecompute);
+ *  return 0;
+ * }
+ * @endcode
+ *
+ * <br><b> - HISTORY OF CHANGES - </b>
+ * <table align="left" style="width:800px">
+ * <tr><td> Date       </td><td> Software Version </td><td> Initials </td><td> Description </td></tr>
+ * <tr><td> 18/10/2026 </td><td> 1.0.0            </td><td> AMS      </td><td> Interface Created </td></tr>
+ * </table><br><br>
+ * <hr>
+ */
+HAL_RCC_ErrStates_t HAL_RCC_RegisterRateNotifier(const functionCallBack_t argConst_pPreChange, const functionCallBack_t argConst_pPostChange);
+
 /*** End of File **************************************************************/
 #endif /*HAL_RCC_HEADER_H_*/
\ No newline at end of file
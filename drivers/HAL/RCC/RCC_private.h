@@ -68,6 +68,11 @@
  */
 #include "RCC_reg.h"
 
+/**
+ * @reason: contains the clock tree targets solved by @HAL_RCC_CLOCK_TREE
+ */
+#include "RCC_config.h"
+
 /******************************************************************************
  * Preprocessor Constants
  *******************************************************************************/
@@ -94,637 +99,1115 @@
 #define HAL_RCC_VCO_MIN_SPEED 100000000    /**< 100 MHZ*/
 #define HAL_RCC_VCO_MAX_SPEED 432000000    /**< 432 MHZ*/
 #define HAL_RCC_SYSCLK_MAX_SPEED 168000000 /**< 168 MHZ*/
+#define HAL_RCC_APB1_MAX_SPEED 42000000    /**< 42 MHZ*/
+#define HAL_RCC_APB2_MAX_SPEED 84000000    /**< 84 MHZ*/
+#define HAL_RCC_ETH_MIN_HCLK_SPEED 25000000 /**< 25 MHZ, lowest HCLK while Ethernet is clocked*/
+#define HAL_RCC_VOS_SCALE2_MAX_SPEED 144000000 /**< maximum HCLK when the regulator is in scale 2 mode (HAL_PWR_HCLK_144_MHZ)*/
+#define HAL_RCC_PLLI2S_MAX_SPEED 192000000     /**< maximum I2S clock out of PLLI2S (192 MHZ)*/
 
 /**
- * @brief: USB OTG module RCC utilities
+ * @brief: values passed to HAL_PWR_Config() with HAL_PWR_KEY_MAX_HCLK_FREQ, they mirror @HAL_PWR_HCLK_MAX_FREQ_t in "PWR_config.h"
  */
-#define HAL_RCC_RST_OTGHSRST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_OTGHSRST)
-
-#define HAL_RCC_RST_OTGFSRST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB2RSTR, HAL_RCC_AHB2RSTR_OTGFSRST)
-
-#define HAL_RCC_EN_OTGHSULPIEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_OTGHSULPIEN)
-
-#define HAL_RCC_EN_OTGHSEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_OTGHSEN)
-
-#define HAL_RCC_EN_OTGFSEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB2ENR, HAL_RCC_AHB2ENR_OTGFSEN)
-
-#define HAL_RCC_LOW_PWR_OTGHSULPILPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_OTGHSULPILPEN)
-
-#define HAL_RCC_LOW_PWR_OTGHSLPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_OTGHSLPEN)
-
-#define HAL_RCC_LOW_PWR_OTGFSLPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB2LPENR, HAL_RCC_AHB2LPENR_OTGFSLPEN)
+#define HAL_RCC_VOS_SCALE2 0 /**< HAL_PWR_HCLK_144_MHZ*/
+#define HAL_RCC_VOS_SCALE1 1 /**< HAL_PWR_HCLK_168_MHZ*/
 
 /**
- * @brief: Ethernet MAC module RCC utilities
+ * @HAL_RCC_PeripheralClock_t
+ * @brief: clocks that feed the peripherals, used as index to globalArr_RCC_PeripheralClocks_u32
  */
-#define HAL_RCC_RST_ETHMACRST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_ETHMACRST)
-
-#define HAL_RCC_EN_ETHMACPTPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_ETHMACPTPEN)
-
-#define HAL_RCC_EN_ETHMACRXEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_ETHMACRXEN)
-
-#define HAL_RCC_EN_ETHMACTXEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_ETHMACTXEN)
-
-#define HAL_RCC_EN_ETHMACEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_ETHMACEN)
-
-#define HAL_RCC_LOW_PWR_ETHMACPTPLPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_OTGHSLPEN)
-
-#define HAL_RCC_LOW_PWR_ETHMACRXLPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_OTGHSLPEN)
-
-#define HAL_RCC_LOW_PWR_ETHMACTXLPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_OTGHSLPEN)
-
-#define HAL_RCC_LOW_PWR_ETHMACLPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_OTGHSLPEN)
+#define HAL_RCC_PERI_CLK_AHB 0         /**< HCLK*/
+#define HAL_RCC_PERI_CLK_APB1 1        /**< PCLK1*/
+#define HAL_RCC_PERI_CLK_APB1_TIMER 2  /**< PCLK1 multiplied by 2 if APB1 prescaler isn't 1*/
+#define HAL_RCC_PERI_CLK_APB2 3        /**< PCLK2*/
+#define HAL_RCC_PERI_CLK_APB2_TIMER 4  /**< PCLK2 multiplied by 2 if APB2 prescaler isn't 1*/
+#define HAL_RCC_PERI_CLK_RTC 5         /**< RTCCLK*/
+#define HAL_RCC_MAX_PERI_CLK 6         /**< number of peripheral clocks*/
 
 /**
- * @brief: DMA module RCC utilities
+ * @brief: buses of the peripherals, used as word offset of the reset register of the bus from RCC_AHB1RSTR
  */
-#define HAL_RCC_RST_DMA2RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_DMA2RST)
-
-#define HAL_RCC_RST_DMA1RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_DMA1RST)
-
-#define HAL_RCC_EN_DMA2EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_DMA2EN)
-
-#define HAL_RCC_EN_DMA1EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_DMA1EN)
-
-#define HAL_RCC_LOW_PWR_DMA2LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_DMA2LPEN)
-
-#define HAL_RCC_LOW_PWR_DMA1LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_DMA1LPEN)
+#define HAL_RCC_BUS_AHB1 0 /**< RCC_AHB1RSTR*/
+#define HAL_RCC_BUS_AHB2 1 /**< RCC_AHB2RSTR*/
+#define HAL_RCC_BUS_AHB3 2 /**< RCC_AHB3RSTR*/
+#define HAL_RCC_BUS_APB1 4 /**< RCC_APB1RSTR*/
+#define HAL_RCC_BUS_APB2 5 /**< RCC_APB2RSTR*/
+#define HAL_RCC_MAX_BUS 6  /**< number of reset registers including the reserved one*/
 
 /**
- * @brief:  CCM data RAM module RCC utilities
+ * @brief: word offsets of the enable registers of a bus from its reset register
  */
-#define HAL_RCC_EN_CCMDATARAMEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_CCMDATARAMEN)
+#define HAL_RCC_ENR_OFFSET 8    /**< RCC_xxxENR*/
+#define HAL_RCC_LPENR_OFFSET 16 /**< RCC_xxxLPENR*/
 
 /**
- * @brief:  Backup SRAM interface module RCC utilities
+ * @brief: TIM5 registers used to measure HSI against LSE (TIM5 channel 4 input can be remapped to LSE), offsets are from TIM5 base address
  */
-#define HAL_RCC_EN_BKPSRAMEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_BKPSRAMEN)
-
-#define HAL_RCC_LOW_PWR_BKPSRAMLPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_BKPSRAMLPEN)
+#define HAL_RCC_TIM5_OFFSET 0x0C00UL /**< offset of TIM5 from APB1 base address*/
+#define HAL_RCC_TIM5_CR1 0x00UL      /**< control register 1*/
+#define HAL_RCC_TIM5_SR 0x10UL       /**< status register*/
+#define HAL_RCC_TIM5_EGR 0x14UL      /**< event generation register*/
+#define HAL_RCC_TIM5_CCMR2 0x1CUL    /**< capture/compare mode register 2*/
+#define HAL_RCC_TIM5_CCER 0x20UL     /**< capture/compare enable register*/
+#define HAL_RCC_TIM5_PSC 0x28UL      /**< prescaler*/
+#define HAL_RCC_TIM5_ARR 0x2CUL      /**< auto-reload register*/
+#define HAL_RCC_TIM5_CCR4 0x40UL     /**< capture/compare register 4*/
+#define HAL_RCC_TIM5_OR 0x50UL       /**< option register*/
 
 /**
- * @brief:  SRAM interface module RCC utilities
+ * @brief: TIM5 values used while measuring HSI, channel 4 captures every 8th rising edge of LSE
  */
-#define HAL_RCC_LOW_PWR_SRAM2LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_SRAM2LPEN)
-
-#define HAL_RCC_LOW_PWR_SRAM1LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_SRAM1LPEN)
+#define HAL_RCC_TIM5_CR1_CEN 0x1UL         /**< counter enable*/
+#define HAL_RCC_TIM5_SR_CC4IF 4            /**< capture 4 flag bit*/
+#define HAL_RCC_TIM5_SR_CC4OF 12           /**< capture 4 overcapture flag bit (a capture was lost before CCR4 was read)*/
+#define HAL_RCC_TIM5_MEASURE_RESTARTS 3    /**< number of times a measurement is started again after an overcapture*/
+#define HAL_RCC_TIM5_EGR_UG 0x1UL          /**< update generation to load the prescaler*/
+#define HAL_RCC_TIM5_CCMR2_IC4_LSE 0x0D00UL /**< CC4S = 01 (input on TI4), IC4PSC = 11 (capture every 8 events), no filter*/
+#define HAL_RCC_TIM5_CCER_CC4E 0x1000UL    /**< capture 4 enabled on rising edge*/
+#define HAL_RCC_TIM5_OR_TI4_LSE 0x80UL     /**< TI4_RMP = 10 (LSE)*/
+#define HAL_RCC_TIM5_LSE_EDGES_PER_CAPTURE 8
 
 /**
- * @brief: CRC module RCC utilities
+ * @brief: HSITRIM field of RCC_CR (5 bits), its reset value is the middle of the range
  */
-#define HAL_RCC_RST_CRCRST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_CRCRST)
-
-#define HAL_RCC_EN_CRCEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_CRCEN)
-
-#define HAL_RCC_LOW_PWR_CRCLPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_CRCLPEN)
+#define HAL_RCC_HSITRIM_MAX 31
 
 /**
- * @brief: IO port module RCC utilities
+ * @brief: reset flags of RCC_CSR (BORRSTF to LPWRRSTF) after shifting them by HAL_RCC_CSR_BORRSTF (refer to @HAL_RCC_ResetFlag_t in "RCC_header.h")
  */
-#define HAL_RCC_RST_GPIOIRST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_GPIOIRST)
-
-#define HAL_RCC_RST_GPIOHRST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_GPIOHRST)
-
-#define HAL_RCC_RST_GPIOGRST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_GPIOGRST)
-
-#define HAL_RCC_RST_GPIOFRST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_GPIOFRST)
-
-#define HAL_RCC_RST_GPIOERST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_GPIOERST)
-
-#define HAL_RCC_RST_GPIODRST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_GPIODRST)
-
-#define HAL_RCC_RST_GPIOCRST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_GPIOCRST)
-
-#define HAL_RCC_RST_GPIOBRST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_GPIOBRST)
-
-#define HAL_RCC_RST_GPIOARST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB1RSTR, HAL_RCC_AHB1RSTR_GPIOARST)
-
-#define HAL_RCC_EN_GPIOIEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIOIEN)
-
-#define HAL_RCC_EN_GPIOHEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIOHEN)
-
-#define HAL_RCC_EN_GPIOGEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIOGEN)
-
-#define HAL_RCC_EN_GPIOFEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIOFEN)
-
-#define HAL_RCC_EN_GPIOEEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIOEEN)
-
-#define HAL_RCC_EN_GPIODEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIODEN)
-
-#define HAL_RCC_EN_GPIOCEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIOCEN)
-
-#define HAL_RCC_EN_GPIOBEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIOBEN)
-
-#define HAL_RCC_EN_GPIOAEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1ENR, HAL_RCC_AHB1ENR_GPIOAEN)
-
-#define HAL_RCC_LOW_PWR_GPIOILPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIOILPEN)
-
-#define HAL_RCC_LOW_PWR_GPIOHLPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIOHLPEN)
-
-#define HAL_RCC_LOW_PWR_GPIOGLPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIOGLPEN)
-
-#define HAL_RCC_LOW_PWR_GPIOFLPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIOFLPEN)
-
-#define HAL_RCC_LOW_PWR_GPIOELPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIOELPEN)
-
-#define HAL_RCC_LOW_PWR_GPIODLPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIODLPEN)
-
-#define HAL_RCC_LOW_PWR_GPIOCLPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIOCLPEN)
-
-#define HAL_RCC_LOW_PWR_GPIOBLPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIOBLPEN)
-
-#define HAL_RCC_LOW_PWR_GPIOALPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB1LPENR, HAL_RCC_AHB1LPENR_GPIOALPEN)
+#define HAL_RCC_RESET_FLAGS_MASK 0x7FUL
 
 /**
- * @brief: Random number generator module RCC utilities
+ * @brief: reset history ring kept in backup SRAM (refer to HAL_RCC_CFG_RESET_HISTORY_ENABLE in "RCC_config.h")
  */
-#define HAL_RCC_RST_RNGRST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB2RSTR, HAL_RCC_AHB2RSTR_RNGRST)
-
-#define HAL_RCC_EN_RNGEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB2ENR, HAL_RCC_AHB2ENR_RNGEN)
-
-#define HAL_RCC_LOW_PWR_RNGLPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB2LPENR, HAL_RCC_AHB2LPENR_RNGLPEN)
+#define HAL_RCC_BKPSRAM_OFFSET 0x4000UL          /**< offset of backup SRAM from AHB1 base address*/
+#define HAL_RCC_BKPSRAM_SIZE 4096                /**< 4 KB*/
+#define HAL_RCC_RESET_HISTORY_MAGIC 0x48545352UL /**< "RSTH" in ASCII when read as bytes, any other value means the ring was never written*/
+#define HAL_RCC_RESET_HISTORY_HEADER_SIZE 32     /**< size of the ring members before the records (refer to @HAL_RCC_ResetHistory_t)*/
+#define HAL_RCC_RESET_RECORD_SIZE 28             /**< size of one record (refer to @HAL_RCC_ResetRecord_t in "RCC_header.h")*/
 
 /**
- * @brief: Hash module RCC utilities
+ * @brief: RTC registers read to timestamp the reset records, offsets are from RTC base address
  */
-#define HAL_RCC_RST_HASHRST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB2RSTR, HAL_RCC_AHB2RSTR_HASHRST)
-
-#define HAL_RCC_EN_HASHEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB2ENR, HAL_RCC_AHB2ENR_HASHEN)
-
-#define HAL_RCC_LOW_PWR_HASHLPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB2LPENR, HAL_RCC_AHB2LPENR_HASHLPEN)
+#define HAL_RCC_RTC_OFFSET 0x2800UL    /**< offset of RTC from APB1 base address*/
+#define HAL_RCC_RTC_TR 0x00UL          /**< time register (BCD)*/
+#define HAL_RCC_RTC_DR 0x04UL          /**< date register (BCD)*/
+#define HAL_RCC_RTC_ISR 0x0CUL         /**< initialization and status register*/
+#define HAL_RCC_RTC_ISR_RSF 5          /**< registers synchronization flag, calendar shadow registers are valid when it's set*/
+#define HAL_RCC_RTC_SYNC_TIMEOUT 10000 /**< number of polls of RSF, synchronization takes 2 RTCCLK periods (61 us with LSE)*/
 
 /**
- * @brief: Cryptographic module RCC utilities
+ * @brief: PLL input (source clock divided by M) range, 2 MHZ is recommended to limit PLL jitter
  */
-#define HAL_RCC_RST_CRYPRST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB2RSTR, HAL_RCC_AHB2RSTR_CRYPRST)
-
-#define HAL_RCC_EN_CRYPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB2ENR, HAL_RCC_AHB2ENR_CRYPEN)
-
-#define HAL_RCC_LOW_PWR_CRYPLPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB2LPENR, HAL_RCC_AHB2LPENR_CRYPLPEN)
+#define HAL_RCC_PLL_INPUT_MIN_SPEED 1000000 /**< 1 MHZ*/
+#define HAL_RCC_PLL_INPUT_MAX_SPEED 2000000 /**< 2 MHZ*/
 
 /**
- * @brief: Camera interface module RCC utilities
+ * @brief: ranges of PLL and PLLI2S dividers
  */
-#define HAL_RCC_RST_DCMIRST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB2RSTR, HAL_RCC_AHB2RSTR_DCMIRST)
-
-#define HAL_RCC_EN_DCMIEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB2ENR, HAL_RCC_AHB2ENR_DCMIEN)
-
-#define HAL_RCC_LOW_PWR_DCMILPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB2LPENR, HAL_RCC_AHB2LPENR_DCMILPEN)
+#define HAL_RCC_PLLM_MIN 2      /**< minimum division factor for the main PLL and PLLI2S input clock*/
+#define HAL_RCC_PLLM_MAX 63     /**< maximum division factor for the main PLL and PLLI2S input clock*/
+#define HAL_RCC_PLLP_MIN 2      /**< minimum division factor for main system clock (P is even only)*/
+#define HAL_RCC_PLLP_MAX 8      /**< maximum division factor for main system clock (P is even only)*/
+#define HAL_RCC_PLLQ_MIN 2      /**< minimum division factor for USB OTG FS, SDIO and RNG clocks*/
+#define HAL_RCC_PLLQ_MAX 15     /**< maximum division factor for USB OTG FS, SDIO and RNG clocks*/
+#define HAL_RCC_PLLI2SR_MIN 2   /**< minimum division factor for I2S clocks*/
+#define HAL_RCC_PLLI2SR_MAX 7   /**< maximum division factor for I2S clocks*/
+#define HAL_RCC_PLLI2SN_MIN 50  /**< minimum multiplication factor for PLLI2S VCO*/
+#define HAL_RCC_PLLI2SN_MAX 432 /**< maximum multiplication factor for PLLI2S VCO*/
 
 /**
- * @brief: Flexible static memory controller module RCC utilities
+ * @brief: limits used by HAL_RCC_SolveI2SClock(), the I2S prescaler is (2 * I2SDIV + ODD) with I2SDIV from 2 to 255
  */
-#define HAL_RCC_RST_FSMCRST() \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_AHB3RSTR, HAL_RCC_AHB3RSTR_FSMCRST)
-
-#define HAL_RCC_EN_FSMCEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB3ENR, HAL_RCC_AHB3ENR_FSMCEN, ENABLEMENT_VAL)
-
-
-#define HAL_RCC_LOW_PWR_FSMCLPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_AHB3LPENR, HAL_RCC_AHB3LPENR_FSMCLPEN, ENABLEMENT_VAL)
+#define HAL_RCC_I2S_MIN_SAMPLE_RATE 8000   /**< lowest supported audio sample rate*/
+#define HAL_RCC_I2S_MAX_SAMPLE_RATE 192000 /**< highest supported audio sample rate*/
+#define HAL_RCC_I2S_PRESCALER_MIN 4        /**< I2SDIV = 2 and ODD = 0*/
+#define HAL_RCC_I2S_PRESCALER_MAX 511      /**< I2SDIV = 255 and ODD = 1*/
+#define HAL_RCC_I2S_MCLK_RATIO 256         /**< I2S clock = Fs * 256 * prescaler when master clock output is enabled*/
+#define HAL_RCC_I2S_FRAME_16BIT_RATIO 32   /**< I2S clock = Fs * 32 * prescaler with 16 bit frames and no master clock*/
+#define HAL_RCC_I2S_FRAME_32BIT_RATIO 64   /**< I2S clock = Fs * 64 * prescaler with 32 bit frames and no master clock*/
 
 /**
- * @brief: DAC module RCC utilities
+ * @brief: reset values of the dividers, used for the PLLs that aren't enabled
  */
-#define HAL_RCC_RST_DACRST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_DACRST)
-
-#define HAL_RCC_EN_DACEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_DACEN)
-
-#define HAL_RCC_LOW_PWR_DACLPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_RCC_APB1LPENR_DACLPEN)
+#define HAL_RCC_PLLM_RESET_VAL 16     /**< reset value of PLLM*/
+#define HAL_RCC_PLLN_RESET_VAL 192    /**< reset value of PLLN*/
+#define HAL_RCC_PLLQ_RESET_VAL 4      /**< reset value of PLLQ*/
+#define HAL_RCC_PLLI2SN_RESET_VAL 192 /**< reset value of PLLI2SN*/
+#define HAL_RCC_PLLI2SR_RESET_VAL 2   /**< reset value of PLLI2SR*/
 
 /**
- * @brief: Power interface RCC utilities
+ * @brief: @HAL_RCC_CLOCK_TREE the clock tree (CT) solved by the preprocessor out of the targets in "RCC_config.h" (refer to @HAL_RCC_CLOCK_TREE_TARGETS),
+ *         the search is the same one done by HAL_RCC_SolvePLL() (smallest M first, then smallest P, Q and R) so both give the same dividers for the same targets.
  */
-#define HAL_RCC_RST_PWRRST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_PWRRST)
-
-#define HAL_RCC_EN_PWREN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_PWREN)
+#if HAL_RCC_CFG_PLL_SOURCE == HAL_RCC_CLOCK_HSE
+#define HAL_RCC_CT_SOURCE_SPEED HAL_RCC_CFG_HSE_VALUE /**< speed of the clock feeding PLL and PLLI2S*/
+#else
+#define HAL_RCC_CT_SOURCE_SPEED HAL_RCC_HSI_SPEED /**< speed of the clock feeding PLL and PLLI2S*/
+#endif
 
-#define HAL_RCC_LOW_PWR_PWRLPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_PWRLPEN)
+#define HAL_RCC_CT_PLL_USED (HAL_RCC_CFG_PLL_ENABLE || HAL_RCC_CFG_PLL48_ENABLE)                                                                  /**< main PLL has to be turned on*/
+#define HAL_RCC_CT_HSE_USED (HAL_RCC_CFG_SYSCLK_SOURCE == HAL_RCC_CLOCK_HSE || (HAL_RCC_CFG_PLL_SOURCE == HAL_RCC_CLOCK_HSE && (HAL_RCC_CT_PLL_USED || HAL_RCC_CFG_PLLI2S_ENABLE))) /**< HSE has to be turned on*/
 
 /**
- * @brief: CAN module RCC utilities
+ * @brief: checks used by the search, VCO has to be in range and N = VCO * M / source has to be an integer, with the input divider M in range (source / M
+ *         from 1 MHZ to 2 MHZ) any VCO in range gives N in range so N is never checked
  */
-#define HAL_RCC_RST_CAN2RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_CAN2RST)
-
-#define HAL_RCC_RST_CAN1RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_CAN1RST)
-
-#define HAL_RCC_EN_CAN2EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_CAN2EN)
-
-#define HAL_RCC_EN_CAN1EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_CAN1EN)
-
-#define HAL_RCC_LOW_PWR_CAN2LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_CAN2LPEN)
-
-#define HAL_RCC_LOW_PWR_CAN1LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_CAN1LPEN)
+#define HAL_RCC_CT_PLLM_OK(M) ((M) * HAL_RCC_PLL_INPUT_MIN_SPEED <= HAL_RCC_CT_SOURCE_SPEED && HAL_RCC_CT_SOURCE_SPEED <= (M) * HAL_RCC_PLL_INPUT_MAX_SPEED)
+#define HAL_RCC_CT_VCO_OK(M, VCO) ((VCO) >= HAL_RCC_VCO_MIN_SPEED && (VCO) <= HAL_RCC_VCO_MAX_SPEED && ((VCO) * (M)) % HAL_RCC_CT_SOURCE_SPEED == 0)
+#define HAL_RCC_CT_PLL48_OK(VCO) (!HAL_RCC_CFG_PLL48_ENABLE || ((VCO) % HAL_RCC_PLL48CLK_SPEED == 0 && (VCO) / HAL_RCC_PLL48CLK_SPEED >= HAL_RCC_PLLQ_MIN && (VCO) / HAL_RCC_PLL48CLK_SPEED <= HAL_RCC_PLLQ_MAX))
+#define HAL_RCC_CT_PLLP_OK(M, P) (HAL_RCC_CT_VCO_OK(M, HAL_RCC_CFG_PLL_OUTPUT * (P)) && HAL_RCC_CT_PLL48_OK(HAL_RCC_CFG_PLL_OUTPUT * (P)))
+#define HAL_RCC_CT_PLLQ_OK(M, Q) HAL_RCC_CT_VCO_OK(M, HAL_RCC_PLL48CLK_SPEED * (Q))
+#define HAL_RCC_CT_PLLI2SR_OK(M, R) HAL_RCC_CT_VCO_OK(M, HAL_RCC_CFG_PLLI2S_OUTPUT * (R))
+#define HAL_RCC_CT_PLL_OK(M) (HAL_RCC_CFG_PLL_ENABLE ? (HAL_RCC_CT_PLLP_OK(M, 2) || HAL_RCC_CT_PLLP_OK(M, 4) || HAL_RCC_CT_PLLP_OK(M, 6) || HAL_RCC_CT_PLLP_OK(M, 8)) :    \
+                             HAL_RCC_CFG_PLL48_ENABLE ? (HAL_RCC_CT_PLLQ_OK(M, 2) || HAL_RCC_CT_PLLQ_OK(M, 3) || HAL_RCC_CT_PLLQ_OK(M, 4) || HAL_RCC_CT_PLLQ_OK(M, 5) || HAL_RCC_CT_PLLQ_OK(M, 6) || HAL_RCC_CT_PLLQ_OK(M, 7) || HAL_RCC_CT_PLLQ_OK(M, 8) || HAL_RCC_CT_PLLQ_OK(M, 9) || HAL_RCC_CT_PLLQ_OK(M, 10) || HAL_RCC_CT_PLLQ_OK(M, 11) || HAL_RCC_CT_PLLQ_OK(M, 12) || HAL_RCC_CT_PLLQ_OK(M, 13) || HAL_RCC_CT_PLLQ_OK(M, 14) || HAL_RCC_CT_PLLQ_OK(M, 15)) : 1)
+#define HAL_RCC_CT_PLLI2S_OK(M) (!HAL_RCC_CFG_PLLI2S_ENABLE || HAL_RCC_CT_PLLI2SR_OK(M, 2) || HAL_RCC_CT_PLLI2SR_OK(M, 3) || HAL_RCC_CT_PLLI2SR_OK(M, 4) || HAL_RCC_CT_PLLI2SR_OK(M, 5) || HAL_RCC_CT_PLLI2SR_OK(M, 6) || HAL_RCC_CT_PLLI2SR_OK(M, 7))
+#define HAL_RCC_CT_SOLVED(M) (HAL_RCC_CT_PLLM_OK(M) && HAL_RCC_CT_PLL_OK(M) && HAL_RCC_CT_PLLI2S_OK(M))
+
+// input divider shared by PLL and PLLI2S
+#if !HAL_RCC_CT_PLL_USED && !HAL_RCC_CFG_PLLI2S_ENABLE
+#define HAL_RCC_CT_PLLM HAL_RCC_PLLM_RESET_VAL
+#elif HAL_RCC_CT_SOLVED(2)
+#define HAL_RCC_CT_PLLM 2
+#elif HAL_RCC_CT_SOLVED(3)
+#define HAL_RCC_CT_PLLM 3
+#elif HAL_RCC_CT_SOLVED(4)
+#define HAL_RCC_CT_PLLM 4
+#elif HAL_RCC_CT_SOLVED(5)
+#define HAL_RCC_CT_PLLM 5
+#elif HAL_RCC_CT_SOLVED(6)
+#define HAL_RCC_CT_PLLM 6
+#elif HAL_RCC_CT_SOLVED(7)
+#define HAL_RCC_CT_PLLM 7
+#elif HAL_RCC_CT_SOLVED(8)
+#define HAL_RCC_CT_PLLM 8
+#elif HAL_RCC_CT_SOLVED(9)
+#define HAL_RCC_CT_PLLM 9
+#elif HAL_RCC_CT_SOLVED(10)
+#define HAL_RCC_CT_PLLM 10
+#elif HAL_RCC_CT_SOLVED(11)
+#define HAL_RCC_CT_PLLM 11
+#elif HAL_RCC_CT_SOLVED(12)
+#define HAL_RCC_CT_PLLM 12
+#elif HAL_RCC_CT_SOLVED(13)
+#define HAL_RCC_CT_PLLM 13
+#elif HAL_RCC_CT_SOLVED(14)
+#define HAL_RCC_CT_PLLM 14
+#elif HAL_RCC_CT_SOLVED(15)
+#define HAL_RCC_CT_PLLM 15
+#elif HAL_RCC_CT_SOLVED(16)
+#define HAL_RCC_CT_PLLM 16
+#elif HAL_RCC_CT_SOLVED(17)
+#define HAL_RCC_CT_PLLM 17
+#elif HAL_RCC_CT_SOLVED(18)
+#define HAL_RCC_CT_PLLM 18
+#elif HAL_RCC_CT_SOLVED(19)
+#define HAL_RCC_CT_PLLM 19
+#elif HAL_RCC_CT_SOLVED(20)
+#define HAL_RCC_CT_PLLM 20
+#elif HAL_RCC_CT_SOLVED(21)
+#define HAL_RCC_CT_PLLM 21
+#elif HAL_RCC_CT_SOLVED(22)
+#define HAL_RCC_CT_PLLM 22
+#elif HAL_RCC_CT_SOLVED(23)
+#define HAL_RCC_CT_PLLM 23
+#elif HAL_RCC_CT_SOLVED(24)
+#define HAL_RCC_CT_PLLM 24
+#elif HAL_RCC_CT_SOLVED(25)
+#define HAL_RCC_CT_PLLM 25
+#elif HAL_RCC_CT_SOLVED(26)
+#define HAL_RCC_CT_PLLM 26
+#elif HAL_RCC_CT_SOLVED(27)
+#define HAL_RCC_CT_PLLM 27
+#elif HAL_RCC_CT_SOLVED(28)
+#define HAL_RCC_CT_PLLM 28
+#elif HAL_RCC_CT_SOLVED(29)
+#define HAL_RCC_CT_PLLM 29
+#elif HAL_RCC_CT_SOLVED(30)
+#define HAL_RCC_CT_PLLM 30
+#elif HAL_RCC_CT_SOLVED(31)
+#define HAL_RCC_CT_PLLM 31
+#elif HAL_RCC_CT_SOLVED(32)
+#define HAL_RCC_CT_PLLM 32
+#elif HAL_RCC_CT_SOLVED(33)
+#define HAL_RCC_CT_PLLM 33
+#elif HAL_RCC_CT_SOLVED(34)
+#define HAL_RCC_CT_PLLM 34
+#elif HAL_RCC_CT_SOLVED(35)
+#define HAL_RCC_CT_PLLM 35
+#elif HAL_RCC_CT_SOLVED(36)
+#define HAL_RCC_CT_PLLM 36
+#elif HAL_RCC_CT_SOLVED(37)
+#define HAL_RCC_CT_PLLM 37
+#elif HAL_RCC_CT_SOLVED(38)
+#define HAL_RCC_CT_PLLM 38
+#elif HAL_RCC_CT_SOLVED(39)
+#define HAL_RCC_CT_PLLM 39
+#elif HAL_RCC_CT_SOLVED(40)
+#define HAL_RCC_CT_PLLM 40
+#elif HAL_RCC_CT_SOLVED(41)
+#define HAL_RCC_CT_PLLM 41
+#elif HAL_RCC_CT_SOLVED(42)
+#define HAL_RCC_CT_PLLM 42
+#elif HAL_RCC_CT_SOLVED(43)
+#define HAL_RCC_CT_PLLM 43
+#elif HAL_RCC_CT_SOLVED(44)
+#define HAL_RCC_CT_PLLM 44
+#elif HAL_RCC_CT_SOLVED(45)
+#define HAL_RCC_CT_PLLM 45
+#elif HAL_RCC_CT_SOLVED(46)
+#define HAL_RCC_CT_PLLM 46
+#elif HAL_RCC_CT_SOLVED(47)
+#define HAL_RCC_CT_PLLM 47
+#elif HAL_RCC_CT_SOLVED(48)
+#define HAL_RCC_CT_PLLM 48
+#elif HAL_RCC_CT_SOLVED(49)
+#define HAL_RCC_CT_PLLM 49
+#elif HAL_RCC_CT_SOLVED(50)
+#define HAL_RCC_CT_PLLM 50
+#elif HAL_RCC_CT_SOLVED(51)
+#define HAL_RCC_CT_PLLM 51
+#elif HAL_RCC_CT_SOLVED(52)
+#define HAL_RCC_CT_PLLM 52
+#elif HAL_RCC_CT_SOLVED(53)
+#define HAL_RCC_CT_PLLM 53
+#elif HAL_RCC_CT_SOLVED(54)
+#define HAL_RCC_CT_PLLM 54
+#elif HAL_RCC_CT_SOLVED(55)
+#define HAL_RCC_CT_PLLM 55
+#elif HAL_RCC_CT_SOLVED(56)
+#define HAL_RCC_CT_PLLM 56
+#elif HAL_RCC_CT_SOLVED(57)
+#define HAL_RCC_CT_PLLM 57
+#elif HAL_RCC_CT_SOLVED(58)
+#define HAL_RCC_CT_PLLM 58
+#elif HAL_RCC_CT_SOLVED(59)
+#define HAL_RCC_CT_PLLM 59
+#elif HAL_RCC_CT_SOLVED(60)
+#define HAL_RCC_CT_PLLM 60
+#elif HAL_RCC_CT_SOLVED(61)
+#define HAL_RCC_CT_PLLM 61
+#elif HAL_RCC_CT_SOLVED(62)
+#define HAL_RCC_CT_PLLM 62
+#elif HAL_RCC_CT_SOLVED(63)
+#define HAL_RCC_CT_PLLM 63
+#else
+#error "RCC: enabled PLL/PLLI2S outputs can't be generated from the PLL source, refer to @HAL_RCC_CLOCK_TREE_TARGETS in RCC_config.h"
+#endif
+
+// main PLL: VCO = output * P, or VCO = 48 MHZ * Q when only the 48 MHZ domain is used
+#if HAL_RCC_CFG_PLL_ENABLE
+#if HAL_RCC_CT_PLLP_OK(HAL_RCC_CT_PLLM, 2)
+#define HAL_RCC_CT_PLLP 2
+#define HAL_RCC_CT_VCO_SPEED (HAL_RCC_CFG_PLL_OUTPUT * 2)
+#elif HAL_RCC_CT_PLLP_OK(HAL_RCC_CT_PLLM, 4)
+#define HAL_RCC_CT_PLLP 4
+#define HAL_RCC_CT_VCO_SPEED (HAL_RCC_CFG_PLL_OUTPUT * 4)
+#elif HAL_RCC_CT_PLLP_OK(HAL_RCC_CT_PLLM, 6)
+#define HAL_RCC_CT_PLLP 6
+#define HAL_RCC_CT_VCO_SPEED (HAL_RCC_CFG_PLL_OUTPUT * 6)
+#elif HAL_RCC_CT_PLLP_OK(HAL_RCC_CT_PLLM, 8)
+#define HAL_RCC_CT_PLLP 8
+#define HAL_RCC_CT_VCO_SPEED (HAL_RCC_CFG_PLL_OUTPUT * 8)
+#endif
+#elif HAL_RCC_CFG_PLL48_ENABLE
+#define HAL_RCC_CT_PLLP HAL_RCC_PLLP_MIN
+#if HAL_RCC_CT_PLLQ_OK(HAL_RCC_CT_PLLM, 2)
+#define HAL_RCC_CT_VCO_SPEED (HAL_RCC_PLL48CLK_SPEED * 2)
+#elif HAL_RCC_CT_PLLQ_OK(HAL_RCC_CT_PLLM, 3)
+#define HAL_RCC_CT_VCO_SPEED (HAL_RCC_PLL48CLK_SPEED * 3)
+#elif HAL_RCC_CT_PLLQ_OK(HAL_RCC_CT_PLLM, 4)
+#define HAL_RCC_CT_VCO_SPEED (HAL_RCC_PLL48CLK_SPEED * 4)
+#elif HAL_RCC_CT_PLLQ_OK(HAL_RCC_CT_PLLM, 5)
+#define HAL_RCC_CT_VCO_SPEED (HAL_RCC_PLL48CLK_SPEED * 5)
+#elif HAL_RCC_CT_PLLQ_OK(HAL_RCC_CT_PLLM, 6)
+#define HAL_RCC_CT_VCO_SPEED (HAL_RCC_PLL48CLK_SPEED * 6)
+#elif HAL_RCC_CT_PLLQ_OK(HAL_RCC_CT_PLLM, 7)
+#define HAL_RCC_CT_VCO_SPEED (HAL_RCC_PLL48CLK_SPEED * 7)
+#elif HAL_RCC_CT_PLLQ_OK(HAL_RCC_CT_PLLM, 8)
+#define HAL_RCC_CT_VCO_SPEED (HAL_RCC_PLL48CLK_SPEED * 8)
+#elif HAL_RCC_CT_PLLQ_OK(HAL_RCC_CT_PLLM, 9)
+#define HAL_RCC_CT_VCO_SPEED (HAL_RCC_PLL48CLK_SPEED * 9)
+#elif HAL_RCC_CT_PLLQ_OK(HAL_RCC_CT_PLLM, 10)
+#define HAL_RCC_CT_VCO_SPEED (HAL_RCC_PLL48CLK_SPEED * 10)
+#elif HAL_RCC_CT_PLLQ_OK(HAL_RCC_CT_PLLM, 11)
+#define HAL_RCC_CT_VCO_SPEED (HAL_RCC_PLL48CLK_SPEED * 11)
+#elif HAL_RCC_CT_PLLQ_OK(HAL_RCC_CT_PLLM, 12)
+#define HAL_RCC_CT_VCO_SPEED (HAL_RCC_PLL48CLK_SPEED * 12)
+#elif HAL_RCC_CT_PLLQ_OK(HAL_RCC_CT_PLLM, 13)
+#define HAL_RCC_CT_VCO_SPEED (HAL_RCC_PLL48CLK_SPEED * 13)
+#elif HAL_RCC_CT_PLLQ_OK(HAL_RCC_CT_PLLM, 14)
+#define HAL_RCC_CT_VCO_SPEED (HAL_RCC_PLL48CLK_SPEED * 14)
+#elif HAL_RCC_CT_PLLQ_OK(HAL_RCC_CT_PLLM, 15)
+#define HAL_RCC_CT_VCO_SPEED (HAL_RCC_PLL48CLK_SPEED * 15)
+#endif
+#else
+#define HAL_RCC_CT_PLLP HAL_RCC_PLLP_MIN
+#endif
+
+#if HAL_RCC_CT_PLL_USED
+#define HAL_RCC_CT_PLLN ((uint64_t)HAL_RCC_CT_VCO_SPEED * HAL_RCC_CT_PLLM / HAL_RCC_CT_SOURCE_SPEED)
+#define HAL_RCC_CT_PLLQ (((HAL_RCC_CT_VCO_SPEED + HAL_RCC_PLL48CLK_SPEED - 1) / HAL_RCC_PLL48CLK_SPEED < HAL_RCC_PLLQ_MIN) ? HAL_RCC_PLLQ_MIN : ((HAL_RCC_CT_VCO_SPEED + HAL_RCC_PLL48CLK_SPEED - 1) / HAL_RCC_PLL48CLK_SPEED)) /**< keeps 48 MHZ domain at or below 48 MHZ even when it's not used*/
+#else
+#define HAL_RCC_CT_PLLN HAL_RCC_PLLN_RESET_VAL
+#define HAL_RCC_CT_PLLQ HAL_RCC_PLLQ_RESET_VAL
+#endif
+
+// PLLI2S: VCO = output * R
+#if HAL_RCC_CFG_PLLI2S_ENABLE
+#if HAL_RCC_CT_PLLI2SR_OK(HAL_RCC_CT_PLLM, 2)
+#define HAL_RCC_CT_PLLI2SR 2
+#elif HAL_RCC_CT_PLLI2SR_OK(HAL_RCC_CT_PLLM, 3)
+#define HAL_RCC_CT_PLLI2SR 3
+#elif HAL_RCC_CT_PLLI2SR_OK(HAL_RCC_CT_PLLM, 4)
+#define HAL_RCC_CT_PLLI2SR 4
+#elif HAL_RCC_CT_PLLI2SR_OK(HAL_RCC_CT_PLLM, 5)
+#define HAL_RCC_CT_PLLI2SR 5
+#elif HAL_RCC_CT_PLLI2SR_OK(HAL_RCC_CT_PLLM, 6)
+#define HAL_RCC_CT_PLLI2SR 6
+#elif HAL_RCC_CT_PLLI2SR_OK(HAL_RCC_CT_PLLM, 7)
+#define HAL_RCC_CT_PLLI2SR 7
+#endif
+#define HAL_RCC_CT_PLLI2SN ((uint64_t)HAL_RCC_CFG_PLLI2S_OUTPUT * HAL_RCC_CT_PLLI2SR * HAL_RCC_CT_PLLM / HAL_RCC_CT_SOURCE_SPEED)
+#else
+#define HAL_RCC_CT_PLLI2SR HAL_RCC_PLLI2SR_RESET_VAL
+#define HAL_RCC_CT_PLLI2SN HAL_RCC_PLLI2SN_RESET_VAL
+#endif
 
 /**
- * @brief: I2C module RCC utilities
+ * @brief: speeds of the clock tree outputs
  */
-#define HAL_RCC_RST_I2C3RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_I2C3RST)
-
-#define HAL_RCC_RST_I2C2RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_I2C2RST)
-
-#define HAL_RCC_RST_I2C1RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_I2C1RST)
-
-#define HAL_RCC_EN_I2C3EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_I2C3EN)
-
-#define HAL_RCC_EN_I2C2EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_I2C2EN)
-
-#define HAL_RCC_EN_I2C1EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_I2C1EN)
-
-#define HAL_RCC_LOW_PWR_I2C3LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_I2C3LPEN)
-
-#define HAL_RCC_LOW_PWR_I2C2LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_I2C2LPEN)
-
-#define HAL_RCC_LOW_PWR_I2C1LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_I2C1LPEN)
+#if HAL_RCC_CFG_SYSCLK_SOURCE == HAL_RCC_CLOCK_PLL
+#define HAL_RCC_CT_SYSCLK_SPEED HAL_RCC_CFG_PLL_OUTPUT
+#elif HAL_RCC_CFG_SYSCLK_SOURCE == HAL_RCC_CLOCK_HSE
+#define HAL_RCC_CT_SYSCLK_SPEED HAL_RCC_CFG_HSE_VALUE
+#else
+#define HAL_RCC_CT_SYSCLK_SPEED HAL_RCC_HSI_SPEED
+#endif
+#define HAL_RCC_CT_HCLK_SPEED (HAL_RCC_CT_SYSCLK_SPEED / HAL_RCC_CFG_AHB_PRESCALER)  /**< AHB bus, core and DMA clock*/
+#define HAL_RCC_CT_PCLK1_SPEED (HAL_RCC_CT_HCLK_SPEED / HAL_RCC_CFG_APB1_PRESCALER) /**< APB1 bus clock*/
+#define HAL_RCC_CT_PCLK2_SPEED (HAL_RCC_CT_HCLK_SPEED / HAL_RCC_CFG_APB2_PRESCALER) /**< APB2 bus clock*/
 
 /**
- * @brief: UART module RCC utilities
+ * @brief: the clock tree targets are validated here so that a wrong target never reaches HAL_RCC_Init()
  */
-#define HAL_RCC_RST_UART5RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_UART5RST)
-
-#define HAL_RCC_RST_UART4RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_UART4RST)
-
-#define HAL_RCC_RST_USART3RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_USART3RST)
-
-#define HAL_RCC_RST_USART2RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_USART2RST)
-
-#define HAL_RCC_RST_USART6RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2RSTR, HAL_RCC_APB2RSTR_USART6RST)
-
-#define HAL_RCC_RST_USART1RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2RSTR, HAL_RCC_APB2RSTR_USART1RST)
-
-#define HAL_RCC_EN_UART5EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_UART5EN)
-
-#define HAL_RCC_EN_UART4EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_UART4EN)
-
-#define HAL_RCC_EN_USART3EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_USART3EN)
-
-#define HAL_RCC_EN_USART2EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_USART2EN)
-
-#define HAL_RCC_EN_USART6EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_USART6EN)
-
-#define HAL_RCC_EN_USART1EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_USART1EN)
-
-#define HAL_RCC_LOW_PWR_UART5LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_UART5LPEN)
-
-#define HAL_RCC_LOW_PWR_UART4LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_UART4LPEN)
-
-#define HAL_RCC_LOW_PWR_USART3LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_USART3LPEN)
-
-#define HAL_RCC_LOW_PWR_USART2LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_USART2LPEN)
-
-#define HAL_RCC_LOW_PWR_USART6LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_USART6LPEN)
-
-#define HAL_RCC_LOW_PWR_USART1LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_USART1LPEN)
+#if HAL_RCC_CFG_HSE_VALUE < 4000000 || HAL_RCC_CFG_HSE_VALUE > 26000000
+#error "RCC: HAL_RCC_CFG_HSE_VALUE has to be from 4 MHZ to 26 MHZ"
+#endif
+#if HAL_RCC_CFG_SYSCLK_SOURCE != HAL_RCC_CLOCK_HSI && HAL_RCC_CFG_SYSCLK_SOURCE != HAL_RCC_CLOCK_HSE && HAL_RCC_CFG_SYSCLK_SOURCE != HAL_RCC_CLOCK_PLL
+#error "RCC: HAL_RCC_CFG_SYSCLK_SOURCE has to be HAL_RCC_CLOCK_HSI, HAL_RCC_CLOCK_HSE or HAL_RCC_CLOCK_PLL"
+#endif
+#if HAL_RCC_CFG_PLL_SOURCE != HAL_RCC_CLOCK_HSI && HAL_RCC_CFG_PLL_SOURCE != HAL_RCC_CLOCK_HSE
+#error "RCC: HAL_RCC_CFG_PLL_SOURCE has to be HAL_RCC_CLOCK_HSI or HAL_RCC_CLOCK_HSE"
+#endif
+#if HAL_RCC_CFG_SYSCLK_SOURCE == HAL_RCC_CLOCK_PLL && !HAL_RCC_CFG_PLL_ENABLE
+#error "RCC: PLL is the system clock source but HAL_RCC_CFG_PLL_ENABLE is 0"
+#endif
+#if HAL_RCC_CFG_PLL_ENABLE && (HAL_RCC_CFG_PLL_OUTPUT < 25000000 || HAL_RCC_CFG_PLL_OUTPUT > HAL_RCC_SYSCLK_MAX_SPEED)
+#error "RCC: HAL_RCC_CFG_PLL_OUTPUT has to be from 25 MHZ to 168 MHZ"
+#endif
+#if HAL_RCC_CFG_PLLI2S_ENABLE && (HAL_RCC_CFG_PLLI2S_OUTPUT < 25000000 || HAL_RCC_CFG_PLLI2S_OUTPUT > 192000000)
+#error "RCC: HAL_RCC_CFG_PLLI2S_OUTPUT has to be from 25 MHZ to 192 MHZ"
+#endif
+#if HAL_RCC_CFG_AHB_PRESCALER != 1 && HAL_RCC_CFG_AHB_PRESCALER != 2 && HAL_RCC_CFG_AHB_PRESCALER != 4 && HAL_RCC_CFG_AHB_PRESCALER != 8 && HAL_RCC_CFG_AHB_PRESCALER != 16 && \
+    HAL_RCC_CFG_AHB_PRESCALER != 64 && HAL_RCC_CFG_AHB_PRESCALER != 128 && HAL_RCC_CFG_AHB_PRESCALER != 256 && HAL_RCC_CFG_AHB_PRESCALER != 512
+#error "RCC: HAL_RCC_CFG_AHB_PRESCALER has to be 1, 2, 4, 8, 16, 64, 128, 256 or 512"
+#endif
+#if HAL_RCC_CFG_APB1_PRESCALER != 1 && HAL_RCC_CFG_APB1_PRESCALER != 2 && HAL_RCC_CFG_APB1_PRESCALER != 4 && HAL_RCC_CFG_APB1_PRESCALER != 8 && HAL_RCC_CFG_APB1_PRESCALER != 16
+#error "RCC: HAL_RCC_CFG_APB1_PRESCALER has to be 1, 2, 4, 8 or 16"
+#endif
+#if HAL_RCC_CFG_APB2_PRESCALER != 1 && HAL_RCC_CFG_APB2_PRESCALER != 2 && HAL_RCC_CFG_APB2_PRESCALER != 4 && HAL_RCC_CFG_APB2_PRESCALER != 8 && HAL_RCC_CFG_APB2_PRESCALER != 16
+#error "RCC: HAL_RCC_CFG_APB2_PRESCALER has to be 1, 2, 4, 8 or 16"
+#endif
+#if HAL_RCC_CT_HCLK_SPEED > 168000000 || HAL_RCC_CT_PCLK1_SPEED > 42000000 || HAL_RCC_CT_PCLK2_SPEED > 84000000
+#error "RCC: bus clock is over its limit (AHB 168 MHZ, APB1 42 MHZ, APB2 84 MHZ), increase the prescalers"
+#endif
+#if HAL_RCC_CFG_HSI_TRIM_CAPTURES < 1 || HAL_RCC_CFG_HSI_TRIM_CAPTURES > 64
+#error "RCC: HAL_RCC_CFG_HSI_TRIM_CAPTURES has to be from 1 to 64"
+#endif
+#if HAL_RCC_CFG_RESET_HISTORY_DEPTH < 1 || HAL_RCC_CFG_RESET_HISTORY_DEPTH > 32 || (HAL_RCC_CFG_RESET_HISTORY_OFFSET % 4) != 0 || \
+    (HAL_RCC_CFG_RESET_HISTORY_OFFSET + HAL_RCC_RESET_HISTORY_HEADER_SIZE + (HAL_RCC_CFG_RESET_HISTORY_DEPTH * HAL_RCC_RESET_RECORD_SIZE)) > HAL_RCC_BKPSRAM_SIZE
+#error "RCC: reset history has to be from 1 to 32 records, word aligned and inside backup SRAM"
+#endif
 
 /**
- * @brief: SPI module RCC utilities
+ * @brief: encoding of the prescalers inside RCC_CFGR (HPRE: 0xxx is not divided and 1000 to 1111 are /2 to /512 skipping /32, PPRE: 0xx is not divided and 100 to 111 are /2 to /16)
  */
-#define HAL_RCC_RST_SPI3RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_SPI3RST)
-
-#define HAL_RCC_RST_SPI2RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_SPI2RST)
-
-#define HAL_RCC_RST_SPI1RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2RSTR, HAL_RCC_APB2RSTR_SPI1RST)
-
-#define HAL_RCC_EN_SPI3EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_SPI3EN)
-
-#define HAL_RCC_EN_SPI2EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_SPI2EN)
-
-#define HAL_RCC_EN_SPI1EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_SPI1EN)
-
-#define HAL_RCC_LOW_PWR_SPI3LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_SPI3LPEN)
-
-#define HAL_RCC_LOW_PWR_SPI2LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_SPI2LPEN)
-
-#define HAL_RCC_LOW_PWR_SPI1LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_SPI1LPEN)
+#define HAL_RCC_CT_HPRE(DIV) ((DIV) == 1 ? 0 : (DIV) == 2 ? 8 : (DIV) == 4 ? 9 : (DIV) == 8 ? 10 : (DIV) == 16 ? 11 : (DIV) == 64 ? 12 : (DIV) == 128 ? 13 : (DIV) == 256 ? 14 : 15)
+#define HAL_RCC_CT_PPRE(DIV) ((DIV) == 1 ? 0 : (DIV) == 2 ? 4 : (DIV) == 4 ? 5 : (DIV) == 8 ? 6 : 7)
 
 /**
- * @brief: Window watchdog module RCC utilities
+ * @brief: final register values of the clock tree written by HAL_RCC_Init(), the masks select the bits they own inside the registers
  */
-#define HAL_RCC_EN_WWDGEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_WWDGEN)
-
-#define HAL_RCC_LOW_PWR_WWDGLPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_WWDGLPEN)
+#define HAL_RCC_CT_PLLCFGR_IMAGE (((uint32_t)HAL_RCC_CT_PLLQ << HAL_RCC_PLLCFGR_PLLQ) | ((uint32_t)HAL_RCC_CFG_PLL_SOURCE << HAL_RCC_PLLCFGR_PLLSRC) |         \
+                                  ((uint32_t)((HAL_RCC_CT_PLLP - 2) / 2) << HAL_RCC_PLLCFGR_PLLP) | ((uint32_t)HAL_RCC_CT_PLLN << HAL_RCC_PLLCFGR_PLLN) | \
+                                  ((uint32_t)HAL_RCC_CT_PLLM << HAL_RCC_PLLCFGR_PLLM))
+#define HAL_RCC_CT_PLLCFGR_MASK 0x0F437FFFUL
+#define HAL_RCC_CT_PLLI2SCFGR_IMAGE (((uint32_t)HAL_RCC_CT_PLLI2SR << HAL_RCC_PLLI2SCFGR_PLLI2SR) | ((uint32_t)HAL_RCC_CT_PLLI2SN << HAL_RCC_PLLI2SCFGR_PLLI2SN))
+#define HAL_RCC_CT_PLLI2SCFGR_MASK 0x70007FC0UL
+#define HAL_RCC_CT_CFGR_IMAGE (((uint32_t)HAL_RCC_CT_PPRE(HAL_RCC_CFG_APB2_PRESCALER) << HAL_RCC_CFGR_PPRE2) | ((uint32_t)HAL_RCC_CT_PPRE(HAL_RCC_CFG_APB1_PRESCALER) << HAL_RCC_CFGR_PPRE1) | \
+                               ((uint32_t)HAL_RCC_CT_HPRE(HAL_RCC_CFG_AHB_PRESCALER) << HAL_RCC_CFGR_HPRE) | ((uint32_t)HAL_RCC_CFG_SYSCLK_SOURCE << HAL_RCC_CFGR_SW))
+#define HAL_RCC_CT_CFGR_MASK 0x0000FCF3UL
+#define HAL_RCC_CFGR_SW_MASK 0x3UL /**< mask of SW field and of SWS field after shifting it to bit 0*/
 
 /**
- * @brief: TIM module RCC utilities
+ * @brief: used to access TIM5 register at the given offset (refer to HAL_RCC_TIM5_CR1 and the following)
  */
-#define HAL_RCC_RST_TIM14RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_TIM14RST)
-
-#define HAL_RCC_RST_TIM13RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_TIM13RST)
-
-#define HAL_RCC_RST_TIM12RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_TIM12RST)
+#define HAL_RCC_TIM5_REG(OFFSET) (*(__io uint32_t *)(HAL_CM4F_APB1_BASEADDR + HAL_RCC_TIM5_OFFSET + (OFFSET)))
 
-#define HAL_RCC_RST_TIM7RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_TIM7RST)
-
-#define HAL_RCC_RST_TIM6RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_TIM6RST)
-
-#define HAL_RCC_RST_TIM4RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_TIM4RST)
-
-#define HAL_RCC_RST_TIM3RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_TIM3RST)
-
-#define HAL_RCC_RST_TIM2RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB1RSTR, HAL_RCC_APB1RSTR_TIM2RST)
-
-#define HAL_RCC_RST_TIM11RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2RSTR, HAL_RCC_APB2RSTR_TIM11RST)
-
-#define HAL_RCC_RST_TIM10RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2RSTR, HAL_RCC_APB2RSTR_TIM10RST)
-
-#define HAL_RCC_RST_TIM9RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2RSTR, HAL_RCC_APB2RSTR_TIM9RST)
-
-#define HAL_RCC_RST_TIM8RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2RSTR, HAL_RCC_APB2RSTR_TIM8RST)
-
-#define HAL_RCC_RST_TIM1RST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2RSTR, HAL_RCC_APB2RSTR_TIM1RST)
-
-#define HAL_RCC_EN_TIM14EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM14EN)
-
-#define HAL_RCC_EN_TIM13EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM13EN)
-
-#define HAL_RCC_EN_TIM12EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM12EN)
-
-#define HAL_RCC_EN_TIM7EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM7EN)
-
-#define HAL_RCC_EN_TIM6EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM6EN)
-
-#define HAL_RCC_EN_TIM5EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM5EN)
-
-#define HAL_RCC_EN_TIM4EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM4EN)
-
-#define HAL_RCC_EN_TIM3EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM3EN)
-
-#define HAL_RCC_EN_TIM2EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1ENR, HAL_RCC_APB1ENR_TIM2EN)
-
-#define HAL_RCC_EN_TIM11EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_TIM11EN)
-
-#define HAL_RCC_EN_TIM10EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_TIM10EN)
-
-#define HAL_RCC_EN_TIM9EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_TIM9EN)
+/**
+ * @brief: used to access RTC register at the given offset (refer to HAL_RCC_RTC_TR and the following)
+ */
+#define HAL_RCC_RTC_REG(OFFSET) (*(__io uint32_t *)(HAL_CM4F_APB1_BASEADDR + HAL_RCC_RTC_OFFSET + (OFFSET)))
 
-#define HAL_RCC_EN_TIM8EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_TIM8EN)
+/******************************************************************************
+ * Tables
+ *******************************************************************************/
 
-#define HAL_RCC_EN_TIM1EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_TIM1EN)
+/**
+ * @brief: the clock feeding every peripheral (refer to @HAL_RCC_PeripheralClock_t) indexed by @HAL_RCC_Peripherals_t in "RCC_header.h"
+ */
+static const uint8_t globalConstArr_RCC_PeripheralClock_t[HAL_RCC_MAX_PERIPHERAL] = {
+    [HAL_RCC_PERIPHERAL_USB_OTG] = HAL_RCC_PERI_CLK_AHB,
+    [HAL_RCC_PERIPHERAL_ETHERNET] = HAL_RCC_PERI_CLK_AHB,
+    [HAL_RCC_PERIPHERAL_DMA1] = HAL_RCC_PERI_CLK_AHB,
+    [HAL_RCC_PERIPHERAL_DMA2] = HAL_RCC_PERI_CLK_AHB,
+    [HAL_RCC_PERIPHERAL_CCM] = HAL_RCC_PERI_CLK_AHB,
+    [HAL_RCC_PERIPHERAL_BKP_SRAM] = HAL_RCC_PERI_CLK_AHB,
+    [HAL_RCC_PERIPHERAL_SRAM1] = HAL_RCC_PERI_CLK_AHB,
+    [HAL_RCC_PERIPHERAL_SRAM2] = HAL_RCC_PERI_CLK_AHB,
+    [HAL_RCC_PERIPHERAL_CRC] = HAL_RCC_PERI_CLK_AHB,
+    [HAL_RCC_PERIPHERAL_GPIOA] = HAL_RCC_PERI_CLK_AHB,
+    [HAL_RCC_PERIPHERAL_GPIOB] = HAL_RCC_PERI_CLK_AHB,
+    [HAL_RCC_PERIPHERAL_GPIOC] = HAL_RCC_PERI_CLK_AHB,
+    [HAL_RCC_PERIPHERAL_GPIOD] = HAL_RCC_PERI_CLK_AHB,
+    [HAL_RCC_PERIPHERAL_GPIOE] = HAL_RCC_PERI_CLK_AHB,
+    [HAL_RCC_PERIPHERAL_GPIOF] = HAL_RCC_PERI_CLK_AHB,
+    [HAL_RCC_PERIPHERAL_GPIOG] = HAL_RCC_PERI_CLK_AHB,
+    [HAL_RCC_PERIPHERAL_GPIOH] = HAL_RCC_PERI_CLK_AHB,
+    [HAL_RCC_PERIPHERAL_GPIOI] = HAL_RCC_PERI_CLK_AHB,
+    [HAL_RCC_PERIPHERAL_RNG] = HAL_RCC_PERI_CLK_AHB,
+    [HAL_RCC_PERIPHERAL_HASH] = HAL_RCC_PERI_CLK_AHB,
+    [HAL_RCC_PERIPHERAL_CRYPTO] = HAL_RCC_PERI_CLK_AHB,
+    [HAL_RCC_PERIPHERAL_CAMERA] = HAL_RCC_PERI_CLK_AHB,
+    [HAL_RCC_PERIPHERAL_FSMC] = HAL_RCC_PERI_CLK_AHB,
+    [HAL_RCC_PERIPHERAL_DAC] = HAL_RCC_PERI_CLK_APB1,
+    [HAL_RCC_PERIPHERAL_PWR] = HAL_RCC_PERI_CLK_APB1,
+    [HAL_RCC_PERIPHERAL_CAN1] = HAL_RCC_PERI_CLK_APB1,
+    [HAL_RCC_PERIPHERAL_CAN2] = HAL_RCC_PERI_CLK_APB1,
+    [HAL_RCC_PERIPHERAL_I2C1] = HAL_RCC_PERI_CLK_APB1,
+    [HAL_RCC_PERIPHERAL_I2C2] = HAL_RCC_PERI_CLK_APB1,
+    [HAL_RCC_PERIPHERAL_I2C3] = HAL_RCC_PERI_CLK_APB1,
+    [HAL_RCC_PERIPHERAL_USART1] = HAL_RCC_PERI_CLK_APB2,
+    [HAL_RCC_PERIPHERAL_USART2] = HAL_RCC_PERI_CLK_APB1,
+    [HAL_RCC_PERIPHERAL_USART3] = HAL_RCC_PERI_CLK_APB1,
+    [HAL_RCC_PERIPHERAL_UART4] = HAL_RCC_PERI_CLK_APB1,
+    [HAL_RCC_PERIPHERAL_UART5] = HAL_RCC_PERI_CLK_APB1,
+    [HAL_RCC_PERIPHERAL_USART6] = HAL_RCC_PERI_CLK_APB2,
+    [HAL_RCC_PERIPHERAL_SPI1] = HAL_RCC_PERI_CLK_APB2,
+    [HAL_RCC_PERIPHERAL_SPI2] = HAL_RCC_PERI_CLK_APB1,
+    [HAL_RCC_PERIPHERAL_SPI3] = HAL_RCC_PERI_CLK_APB1,
+    [HAL_RCC_PERIPHERAL_WWDG] = HAL_RCC_PERI_CLK_APB1,
+    [HAL_RCC_PERIPHERAL_TIM1] = HAL_RCC_PERI_CLK_APB2_TIMER,
+    [HAL_RCC_PERIPHERAL_TIM2] = HAL_RCC_PERI_CLK_APB1_TIMER,
+    [HAL_RCC_PERIPHERAL_TIM3] = HAL_RCC_PERI_CLK_APB1_TIMER,
+    [HAL_RCC_PERIPHERAL_TIM4] = HAL_RCC_PERI_CLK_APB1_TIMER,
+    [HAL_RCC_PERIPHERAL_TIM5] = HAL_RCC_PERI_CLK_APB1_TIMER,
+    [HAL_RCC_PERIPHERAL_TIM6] = HAL_RCC_PERI_CLK_APB1_TIMER,
+    [HAL_RCC_PERIPHERAL_TIM7] = HAL_RCC_PERI_CLK_APB1_TIMER,
+    [HAL_RCC_PERIPHERAL_TIM8] = HAL_RCC_PERI_CLK_APB2_TIMER,
+    [HAL_RCC_PERIPHERAL_TIM9] = HAL_RCC_PERI_CLK_APB2_TIMER,
+    [HAL_RCC_PERIPHERAL_TIM10] = HAL_RCC_PERI_CLK_APB2_TIMER,
+    [HAL_RCC_PERIPHERAL_TIM11] = HAL_RCC_PERI_CLK_APB2_TIMER,
+    [HAL_RCC_PERIPHERAL_TIM12] = HAL_RCC_PERI_CLK_APB1_TIMER,
+    [HAL_RCC_PERIPHERAL_TIM13] = HAL_RCC_PERI_CLK_APB1_TIMER,
+    [HAL_RCC_PERIPHERAL_TIM14] = HAL_RCC_PERI_CLK_APB1_TIMER,
+    [HAL_RCC_PERIPHERAL_SYS_CFG] = HAL_RCC_PERI_CLK_APB2,
+    [HAL_RCC_PERIPHERAL_SDIO] = HAL_RCC_PERI_CLK_APB2,
+    [HAL_RCC_PERIPHERAL_ADC1] = HAL_RCC_PERI_CLK_APB2,
+    [HAL_RCC_PERIPHERAL_ADC2] = HAL_RCC_PERI_CLK_APB2,
+    [HAL_RCC_PERIPHERAL_ADC3] = HAL_RCC_PERI_CLK_APB2,
+    [HAL_RCC_PERIPHERAL_FLASH_MEM] = HAL_RCC_PERI_CLK_AHB,
+    [HAL_RCC_PERIPHERAL_RTC] = HAL_RCC_PERI_CLK_RTC,
+};
 
-#define HAL_RCC_LOW_PWR_TIM14LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM14LPEN)
+/******************************************************************************
+ * Typedefs
+ *******************************************************************************/
 
-#define HAL_RCC_LOW_PWR_TIM13LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM13LPEN)
+/**
+ * @struct: HAL_RCC_PLLDividers_t
+ * @brief: holds the dividers of the main PLL and PLLI2S (they share the input divider M)
+ */
+typedef struct
+{
+    uint16_t PLLN;    /**< main PLL multiplication factor for VCO*/
+    uint16_t PLLI2SN; /**< PLLI2S multiplication factor for VCO*/
+    uint8_t PLLM;     /**< division factor for the main PLL and PLLI2S input clock*/
+    uint8_t PLLP;     /**< main PLL division factor for main system clock*/
+    uint8_t PLLQ;     /**< main PLL division factor for USB OTG FS, SDIO and RNG clocks*/
+    uint8_t PLLI2SR;  /**< PLLI2S division factor for I2S clocks*/
+} HAL_RCC_PLLDividers_t;
 
-#define HAL_RCC_LOW_PWR_TIM12LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM12LPEN)
+/**
+ * @struct: HAL_RCC_PeripheralBits_t
+ * @brief: holds the bits controlling a peripheral in the reset, enable and low power enable registers of its bus
+ */
+typedef struct
+{
+    uint32_t ResetMask;    /**< bits of the peripheral in RCC_xxxRSTR*/
+    uint32_t EnableMask;   /**< bits of the peripheral in RCC_xxxENR*/
+    uint32_t LowPowerMask; /**< bits of the peripheral in RCC_xxxLPENR*/
+    uint8_t Bus;           /**< bus of the peripheral, refer to HAL_RCC_BUS_AHB1 and the following*/
+} HAL_RCC_PeripheralBits_t;
 
-#define HAL_RCC_LOW_PWR_TIM7LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM7LPEN)
+/**
+ * @struct: HAL_RCC_ResetHistory_t
+ * @brief: @HAL_RCC_ResetHistory_t the reset history ring kept in backup SRAM, the fault context is saved by HAL_RCC_SaveFaultContext()
+ *         before a reset and moved to the record of that reset by the next HAL_RCC_Init()
+ */
+typedef struct
+{
+    uint32_t Magic;                                                 /**< HAL_RCC_RESET_HISTORY_MAGIC once the ring is initialized*/
+    uint32_t BootCount;                                             /**< number of logged resets since the ring was initialized*/
+    uint32_t Count;                                                 /**< number of valid records (up to HAL_RCC_CFG_RESET_HISTORY_DEPTH)*/
+    uint32_t Head;                                                  /**< index of the record written by the next reset*/
+    uint32_t FaultValid;                                            /**< LIB_CONSTANTS_SUCCESS if the fault context below belongs to the coming reset*/
+    uint32_t FaultPC;                                               /**< program counter given to HAL_RCC_SaveFaultContext()*/
+    uint32_t FaultCFSR;                                             /**< SCB configurable fault status register when the context was saved*/
+    uint32_t FaultHFSR;                                             /**< SCB hard fault status register when the context was saved*/
+    HAL_RCC_ResetRecord_t Records[HAL_RCC_CFG_RESET_HISTORY_DEPTH]; /**< records of the last resets*/
+} HAL_RCC_ResetHistory_t;
 
-#define HAL_RCC_LOW_PWR_TIM6LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM6LPEN)
+/******************************************************************************
+ * Variables
+ *******************************************************************************/
 
-#define HAL_RCC_LOW_PWR_TIM5LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM5LPEN)
+/**
+ * @brief: these variables holds the current clock values of the system
+ */
+static uint32_t global_u32SystemClock = 0;
+static uint32_t global_u32HSEtoRTCClk = 0;
 
-#define HAL_RCC_LOW_PWR_TIM4LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM4LPEN)
+/**
+ * @brief: input frequency of every peripheral clock indexed by @HAL_RCC_PeripheralClock_t, refreshed whenever the system clock or prescalers change
+ */
+static uint32_t globalArr_RCC_PeripheralClocks_u32[HAL_RCC_MAX_PERI_CLK];
 
-#define HAL_RCC_LOW_PWR_TIM3LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM3LPEN)
+/**
+ * @brief: number of users of every peripheral clock indexed by @HAL_RCC_Peripherals_t in "RCC_header.h" (refer to HAL_RCC_ClockAcquire())
+ */
+static uint8_t globalArr_RCC_ClockUsers_u8[HAL_RCC_MAX_PERIPHERAL];
 
-#define HAL_RCC_LOW_PWR_TIM2LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB1LPENR, HAL_RCC_APB1LPENR_TIM2LPEN)
+/**
+ * @brief: reset, run mode and low power mode enable bits of every peripheral indexed by @HAL_RCC_Peripherals_t in "RCC_header.h",
+ *         RTC has no bits here as it's enabled from RCC_BDCR
+ */
+static const HAL_RCC_PeripheralBits_t globalConstArr_RCC_PeripheralBits_t[HAL_RCC_MAX_PERIPHERAL] = {
+    [HAL_RCC_PERIPHERAL_USB_OTG] = {
+        .ResetMask = (1UL << HAL_RCC_AHB1RSTR_OTGHSRST),
+        .EnableMask = (1UL << HAL_RCC_AHB1ENR_OTGHSEN),
+        .LowPowerMask = (1UL << HAL_RCC_AHB1LPENR_OTGHSLPEN),
+        .Bus = HAL_RCC_BUS_AHB1,
+    },
+    [HAL_RCC_PERIPHERAL_ETHERNET] = {
+        .ResetMask = (1UL << HAL_RCC_AHB1RSTR_ETHMACRST),
+        .EnableMask = (1UL << HAL_RCC_AHB1ENR_ETHMACPTPEN) | (1UL << HAL_RCC_AHB1ENR_ETHMACRXEN) | (1UL << HAL_RCC_AHB1ENR_ETHMACTXEN) | (1UL << HAL_RCC_AHB1ENR_ETHMACEN),
+        .LowPowerMask = (1UL << HAL_RCC_AHB1LPENR_ETHMACPTPLPEN) | (1UL << HAL_RCC_AHB1LPENR_ETHMACRXLPEN) | (1UL << HAL_RCC_AHB1LPENR_ETHMACTXLPEN) | (1UL << HAL_RCC_AHB1LPENR_ETHMACLPEN),
+        .Bus = HAL_RCC_BUS_AHB1,
+    },
+    [HAL_RCC_PERIPHERAL_DMA1] = {
+        .ResetMask = (1UL << HAL_RCC_AHB1RSTR_DMA1RST),
+        .EnableMask = (1UL << HAL_RCC_AHB1ENR_DMA1EN),
+        .LowPowerMask = (1UL << HAL_RCC_AHB1LPENR_DMA1LPEN),
+        .Bus = HAL_RCC_BUS_AHB1,
+    },
+    [HAL_RCC_PERIPHERAL_DMA2] = {
+        .ResetMask = (1UL << HAL_RCC_AHB1RSTR_DMA2RST),
+        .EnableMask = (1UL << HAL_RCC_AHB1ENR_DMA2EN),
+        .LowPowerMask = (1UL << HAL_RCC_AHB1LPENR_DMA2LPEN),
+        .Bus = HAL_RCC_BUS_AHB1,
+    },
+    [HAL_RCC_PERIPHERAL_CCM] = {
+        .ResetMask = 0,
+        .EnableMask = (1UL << HAL_RCC_AHB1ENR_CCMDATARAMEN),
+        .LowPowerMask = 0,
+        .Bus = HAL_RCC_BUS_AHB1,
+    },
+    [HAL_RCC_PERIPHERAL_BKP_SRAM] = {
+        .ResetMask = 0,
+        .EnableMask = (1UL << HAL_RCC_AHB1ENR_BKPSRAMEN),
+        .LowPowerMask = (1UL << HAL_RCC_AHB1LPENR_BKPSRAMLPEN),
+        .Bus = HAL_RCC_BUS_AHB1,
+    },
+    [HAL_RCC_PERIPHERAL_SRAM1] = {
+        .ResetMask = 0,
+        .EnableMask = 0,
+        .LowPowerMask = (1UL << HAL_RCC_AHB1LPENR_SRAM1LPEN),
+        .Bus = HAL_RCC_BUS_AHB1,
+    },
+    [HAL_RCC_PERIPHERAL_SRAM2] = {
+        .ResetMask = 0,
+        .EnableMask = 0,
+        .LowPowerMask = (1UL << HAL_RCC_AHB1LPENR_SRAM2LPEN),
+        .Bus = HAL_RCC_BUS_AHB1,
+    },
+    [HAL_RCC_PERIPHERAL_CRC] = {
+        .ResetMask = (1UL << HAL_RCC_AHB1RSTR_CRCRST),
+        .EnableMask = (1UL << HAL_RCC_AHB1ENR_CRCEN),
+        .LowPowerMask = (1UL << HAL_RCC_AHB1LPENR_CRCLPEN),
+        .Bus = HAL_RCC_BUS_AHB1,
+    },
+    [HAL_RCC_PERIPHERAL_GPIOA] = {
+        .ResetMask = (1UL << HAL_RCC_AHB1RSTR_GPIOARST),
+        .EnableMask = (1UL << HAL_RCC_AHB1ENR_GPIOAEN),
+        .LowPowerMask = (1UL << HAL_RCC_AHB1LPENR_GPIOALPEN),
+        .Bus = HAL_RCC_BUS_AHB1,
+    },
+    [HAL_RCC_PERIPHERAL_GPIOB] = {
+        .ResetMask = (1UL << HAL_RCC_AHB1RSTR_GPIOBRST),
+        .EnableMask = (1UL << HAL_RCC_AHB1ENR_GPIOBEN),
+        .LowPowerMask = (1UL << HAL_RCC_AHB1LPENR_GPIOBLPEN),
+        .Bus = HAL_RCC_BUS_AHB1,
+    },
+    [HAL_RCC_PERIPHERAL_GPIOC] = {
+        .ResetMask = (1UL << HAL_RCC_AHB1RSTR_GPIOCRST),
+        .EnableMask = (1UL << HAL_RCC_AHB1ENR_GPIOCEN),
+        .LowPowerMask = (1UL << HAL_RCC_AHB1LPENR_GPIOCLPEN),
+        .Bus = HAL_RCC_BUS_AHB1,
+    },
+    [HAL_RCC_PERIPHERAL_GPIOD] = {
+        .ResetMask = (1UL << HAL_RCC_AHB1RSTR_GPIODRST),
+        .EnableMask = (1UL << HAL_RCC_AHB1ENR_GPIODEN),
+        .LowPowerMask = (1UL << HAL_RCC_AHB1LPENR_GPIODLPEN),
+        .Bus = HAL_RCC_BUS_AHB1,
+    },
+    [HAL_RCC_PERIPHERAL_GPIOE] = {
+        .ResetMask = (1UL << HAL_RCC_AHB1RSTR_GPIOERST),
+        .EnableMask = (1UL << HAL_RCC_AHB1ENR_GPIOEEN),
+        .LowPowerMask = (1UL << HAL_RCC_AHB1LPENR_GPIOELPEN),
+        .Bus = HAL_RCC_BUS_AHB1,
+    },
+    [HAL_RCC_PERIPHERAL_GPIOF] = {
+        .ResetMask = (1UL << HAL_RCC_AHB1RSTR_GPIOFRST),
+        .EnableMask = (1UL << HAL_RCC_AHB1ENR_GPIOFEN),
+        .LowPowerMask = (1UL << HAL_RCC_AHB1LPENR_GPIOFLPEN),
+        .Bus = HAL_RCC_BUS_AHB1,
+    },
+    [HAL_RCC_PERIPHERAL_GPIOG] = {
+        .ResetMask = (1UL << HAL_RCC_AHB1RSTR_GPIOGRST),
+        .EnableMask = (1UL << HAL_RCC_AHB1ENR_GPIOGEN),
+        .LowPowerMask = (1UL << HAL_RCC_AHB1LPENR_GPIOGLPEN),
+        .Bus = HAL_RCC_BUS_AHB1,
+    },
+    [HAL_RCC_PERIPHERAL_GPIOH] = {
+        .ResetMask = (1UL << HAL_RCC_AHB1RSTR_GPIOHRST),
+        .EnableMask = (1UL << HAL_RCC_AHB1ENR_GPIOHEN),
+        .LowPowerMask = (1UL << HAL_RCC_AHB1LPENR_GPIOHLPEN),
+        .Bus = HAL_RCC_BUS_AHB1,
+    },
+    [HAL_RCC_PERIPHERAL_GPIOI] = {
+        .ResetMask = (1UL << HAL_RCC_AHB1RSTR_GPIOIRST),
+        .EnableMask = (1UL << HAL_RCC_AHB1ENR_GPIOIEN),
+        .LowPowerMask = (1UL << HAL_RCC_AHB1LPENR_GPIOILPEN),
+        .Bus = HAL_RCC_BUS_AHB1,
+    },
+    [HAL_RCC_PERIPHERAL_RNG] = {
+        .ResetMask = (1UL << HAL_RCC_AHB2RSTR_RNGRST),
+        .EnableMask = (1UL << HAL_RCC_AHB2ENR_RNGEN),
+        .LowPowerMask = (1UL << HAL_RCC_AHB2LPENR_RNGLPEN),
+        .Bus = HAL_RCC_BUS_AHB2,
+    },
+    [HAL_RCC_PERIPHERAL_HASH] = {
+        .ResetMask = (1UL << HAL_RCC_AHB2RSTR_HASHRST),
+        .EnableMask = (1UL << HAL_RCC_AHB2ENR_HASHEN),
+        .LowPowerMask = (1UL << HAL_RCC_AHB2LPENR_HASHLPEN),
+        .Bus = HAL_RCC_BUS_AHB2,
+    },
+    [HAL_RCC_PERIPHERAL_CRYPTO] = {
+        .ResetMask = (1UL << HAL_RCC_AHB2RSTR_CRYPRST),
+        .EnableMask = (1UL << HAL_RCC_AHB2ENR_CRYPEN),
+        .LowPowerMask = (1UL << HAL_RCC_AHB2LPENR_CRYPLPEN),
+        .Bus = HAL_RCC_BUS_AHB2,
+    },
+    [HAL_RCC_PERIPHERAL_CAMERA] = {
+        .ResetMask = (1UL << HAL_RCC_AHB2RSTR_DCMIRST),
+        .EnableMask = (1UL << HAL_RCC_AHB2ENR_DCMIEN),
+        .LowPowerMask = (1UL << HAL_RCC_AHB2LPENR_DCMILPEN),
+        .Bus = HAL_RCC_BUS_AHB2,
+    },
+    [HAL_RCC_PERIPHERAL_FSMC] = {
+        .ResetMask = (1UL << HAL_RCC_AHB3RSTR_FSMCRST),
+        .EnableMask = (1UL << HAL_RCC_AHB3ENR_FSMCEN),
+        .LowPowerMask = (1UL << HAL_RCC_AHB3LPENR_FSMCLPEN),
+        .Bus = HAL_RCC_BUS_AHB3,
+    },
+    [HAL_RCC_PERIPHERAL_DAC] = {
+        .ResetMask = (1UL << HAL_RCC_APB1RSTR_DACRST),
+        .EnableMask = (1UL << HAL_RCC_APB1ENR_DACEN),
+        .LowPowerMask = (1UL << HAL_RCC_APB1LPENR_DACLPEN),
+        .Bus = HAL_RCC_BUS_APB1,
+    },
+    [HAL_RCC_PERIPHERAL_PWR] = {
+        .ResetMask = (1UL << HAL_RCC_APB1RSTR_PWRRST),
+        .EnableMask = (1UL << HAL_RCC_APB1ENR_PWREN),
+        .LowPowerMask = (1UL << HAL_RCC_APB1LPENR_PWRLPEN),
+        .Bus = HAL_RCC_BUS_APB1,
+    },
+    [HAL_RCC_PERIPHERAL_CAN1] = {
+        .ResetMask = (1UL << HAL_RCC_APB1RSTR_CAN1RST),
+        .EnableMask = (1UL << HAL_RCC_APB1ENR_CAN1EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB1LPENR_CAN1LPEN),
+        .Bus = HAL_RCC_BUS_APB1,
+    },
+    [HAL_RCC_PERIPHERAL_CAN2] = {
+        .ResetMask = (1UL << HAL_RCC_APB1RSTR_CAN2RST),
+        .EnableMask = (1UL << HAL_RCC_APB1ENR_CAN2EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB1LPENR_CAN2LPEN),
+        .Bus = HAL_RCC_BUS_APB1,
+    },
+    [HAL_RCC_PERIPHERAL_I2C1] = {
+        .ResetMask = (1UL << HAL_RCC_APB1RSTR_I2C1RST),
+        .EnableMask = (1UL << HAL_RCC_APB1ENR_I2C1EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB1LPENR_I2C1LPEN),
+        .Bus = HAL_RCC_BUS_APB1,
+    },
+    [HAL_RCC_PERIPHERAL_I2C2] = {
+        .ResetMask = (1UL << HAL_RCC_APB1RSTR_I2C2RST),
+        .EnableMask = (1UL << HAL_RCC_APB1ENR_I2C2EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB1LPENR_I2C2LPEN),
+        .Bus = HAL_RCC_BUS_APB1,
+    },
+    [HAL_RCC_PERIPHERAL_I2C3] = {
+        .ResetMask = (1UL << HAL_RCC_APB1RSTR_I2C3RST),
+        .EnableMask = (1UL << HAL_RCC_APB1ENR_I2C3EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB1LPENR_I2C3LPEN),
+        .Bus = HAL_RCC_BUS_APB1,
+    },
+    [HAL_RCC_PERIPHERAL_USART1] = {
+        .ResetMask = (1UL << HAL_RCC_APB2RSTR_USART1RST),
+        .EnableMask = (1UL << HAL_RCC_APB2ENR_USART1EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB2LPENR_USART1LPEN),
+        .Bus = HAL_RCC_BUS_APB2,
+    },
+    [HAL_RCC_PERIPHERAL_USART2] = {
+        .ResetMask = (1UL << HAL_RCC_APB1RSTR_USART2RST),
+        .EnableMask = (1UL << HAL_RCC_APB1ENR_USART2EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB1LPENR_USART2LPEN),
+        .Bus = HAL_RCC_BUS_APB1,
+    },
+    [HAL_RCC_PERIPHERAL_USART3] = {
+        .ResetMask = (1UL << HAL_RCC_APB1RSTR_USART3RST),
+        .EnableMask = (1UL << HAL_RCC_APB1ENR_USART3EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB1LPENR_USART3LPEN),
+        .Bus = HAL_RCC_BUS_APB1,
+    },
+    [HAL_RCC_PERIPHERAL_UART4] = {
+        .ResetMask = (1UL << HAL_RCC_APB1RSTR_UART4RST),
+        .EnableMask = (1UL << HAL_RCC_APB1ENR_UART4EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB1LPENR_UART4LPEN),
+        .Bus = HAL_RCC_BUS_APB1,
+    },
+    [HAL_RCC_PERIPHERAL_UART5] = {
+        .ResetMask = (1UL << HAL_RCC_APB1RSTR_UART5RST),
+        .EnableMask = (1UL << HAL_RCC_APB1ENR_UART5EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB1LPENR_UART5LPEN),
+        .Bus = HAL_RCC_BUS_APB1,
+    },
+    [HAL_RCC_PERIPHERAL_USART6] = {
+        .ResetMask = (1UL << HAL_RCC_APB2RSTR_USART6RST),
+        .EnableMask = (1UL << HAL_RCC_APB2ENR_USART6EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB2LPENR_USART6LPEN),
+        .Bus = HAL_RCC_BUS_APB2,
+    },
+    [HAL_RCC_PERIPHERAL_SPI1] = {
+        .ResetMask = (1UL << HAL_RCC_APB2RSTR_SPI1RST),
+        .EnableMask = (1UL << HAL_RCC_APB2ENR_SPI1EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB2LPENR_SPI1LPEN),
+        .Bus = HAL_RCC_BUS_APB2,
+    },
+    [HAL_RCC_PERIPHERAL_SPI2] = {
+        .ResetMask = (1UL << HAL_RCC_APB1RSTR_SPI2RST),
+        .EnableMask = (1UL << HAL_RCC_APB1ENR_SPI2EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB1LPENR_SPI2LPEN),
+        .Bus = HAL_RCC_BUS_APB1,
+    },
+    [HAL_RCC_PERIPHERAL_SPI3] = {
+        .ResetMask = (1UL << HAL_RCC_APB1RSTR_SPI3RST),
+        .EnableMask = (1UL << HAL_RCC_APB1ENR_SPI3EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB1LPENR_SPI3LPEN),
+        .Bus = HAL_RCC_BUS_APB1,
+    },
+    [HAL_RCC_PERIPHERAL_WWDG] = {
+        .ResetMask = (1UL << HAL_RCC_APB1RSTR_WWDGRST),
+        .EnableMask = (1UL << HAL_RCC_APB1ENR_WWDGEN),
+        .LowPowerMask = (1UL << HAL_RCC_APB1LPENR_WWDGLPEN),
+        .Bus = HAL_RCC_BUS_APB1,
+    },
+    [HAL_RCC_PERIPHERAL_TIM1] = {
+        .ResetMask = (1UL << HAL_RCC_APB2RSTR_TIM1RST),
+        .EnableMask = (1UL << HAL_RCC_APB2ENR_TIM1EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB2LPENR_TIM1LPEN),
+        .Bus = HAL_RCC_BUS_APB2,
+    },
+    [HAL_RCC_PERIPHERAL_TIM2] = {
+        .ResetMask = (1UL << HAL_RCC_APB1RSTR_TIM2RST),
+        .EnableMask = (1UL << HAL_RCC_APB1ENR_TIM2EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB1LPENR_TIM2LPEN),
+        .Bus = HAL_RCC_BUS_APB1,
+    },
+    [HAL_RCC_PERIPHERAL_TIM3] = {
+        .ResetMask = (1UL << HAL_RCC_APB1RSTR_TIM3RST),
+        .EnableMask = (1UL << HAL_RCC_APB1ENR_TIM3EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB1LPENR_TIM3LPEN),
+        .Bus = HAL_RCC_BUS_APB1,
+    },
+    [HAL_RCC_PERIPHERAL_TIM4] = {
+        .ResetMask = (1UL << HAL_RCC_APB1RSTR_TIM4RST),
+        .EnableMask = (1UL << HAL_RCC_APB1ENR_TIM4EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB1LPENR_TIM4LPEN),
+        .Bus = HAL_RCC_BUS_APB1,
+    },
+    [HAL_RCC_PERIPHERAL_TIM5] = {
+        .ResetMask = (1UL << HAL_RCC_APB1RSTR_TIM5RST),
+        .EnableMask = (1UL << HAL_RCC_APB1ENR_TIM5EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB1LPENR_TIM5LPEN),
+        .Bus = HAL_RCC_BUS_APB1,
+    },
+    [HAL_RCC_PERIPHERAL_TIM6] = {
+        .ResetMask = (1UL << HAL_RCC_APB1RSTR_TIM6RST),
+        .EnableMask = (1UL << HAL_RCC_APB1ENR_TIM6EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB1LPENR_TIM6LPEN),
+        .Bus = HAL_RCC_BUS_APB1,
+    },
+    [HAL_RCC_PERIPHERAL_TIM7] = {
+        .ResetMask = (1UL << HAL_RCC_APB1RSTR_TIM7RST),
+        .EnableMask = (1UL << HAL_RCC_APB1ENR_TIM7EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB1LPENR_TIM7LPEN),
+        .Bus = HAL_RCC_BUS_APB1,
+    },
+    [HAL_RCC_PERIPHERAL_TIM8] = {
+        .ResetMask = (1UL << HAL_RCC_APB2RSTR_TIM8RST),
+        .EnableMask = (1UL << HAL_RCC_APB2ENR_TIM8EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB2LPENR_TIM8LPEN),
+        .Bus = HAL_RCC_BUS_APB2,
+    },
+    [HAL_RCC_PERIPHERAL_TIM9] = {
+        .ResetMask = (1UL << HAL_RCC_APB2RSTR_TIM9RST),
+        .EnableMask = (1UL << HAL_RCC_APB2ENR_TIM9EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB2LPENR_TIM9LPEN),
+        .Bus = HAL_RCC_BUS_APB2,
+    },
+    [HAL_RCC_PERIPHERAL_TIM10] = {
+        .ResetMask = (1UL << HAL_RCC_APB2RSTR_TIM10RST),
+        .EnableMask = (1UL << HAL_RCC_APB2ENR_TIM10EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB2LPENR_TIM10LPEN),
+        .Bus = HAL_RCC_BUS_APB2,
+    },
+    [HAL_RCC_PERIPHERAL_TIM11] = {
+        .ResetMask = (1UL << HAL_RCC_APB2RSTR_TIM11RST),
+        .EnableMask = (1UL << HAL_RCC_APB2ENR_TIM11EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB2LPENR_TIM11LPEN),
+        .Bus = HAL_RCC_BUS_APB2,
+    },
+    [HAL_RCC_PERIPHERAL_TIM12] = {
+        .ResetMask = (1UL << HAL_RCC_APB1RSTR_TIM12RST),
+        .EnableMask = (1UL << HAL_RCC_APB1ENR_TIM12EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB1LPENR_TIM12LPEN),
+        .Bus = HAL_RCC_BUS_APB1,
+    },
+    [HAL_RCC_PERIPHERAL_TIM13] = {
+        .ResetMask = (1UL << HAL_RCC_APB1RSTR_TIM13RST),
+        .EnableMask = (1UL << HAL_RCC_APB1ENR_TIM13EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB1LPENR_TIM13LPEN),
+        .Bus = HAL_RCC_BUS_APB1,
+    },
+    [HAL_RCC_PERIPHERAL_TIM14] = {
+        .ResetMask = (1UL << HAL_RCC_APB1RSTR_TIM14RST),
+        .EnableMask = (1UL << HAL_RCC_APB1ENR_TIM14EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB1LPENR_TIM14LPEN),
+        .Bus = HAL_RCC_BUS_APB1,
+    },
+    [HAL_RCC_PERIPHERAL_SYS_CFG] = {
+        .ResetMask = (1UL << HAL_RCC_APB2RSTR_SYSCFGRST),
+        .EnableMask = (1UL << HAL_RCC_APB2ENR_SYSCFGEN),
+        .LowPowerMask = (1UL << HAL_RCC_APB2LPENR_SYSCFGLPEN),
+        .Bus = HAL_RCC_BUS_APB2,
+    },
+    [HAL_RCC_PERIPHERAL_SDIO] = {
+        .ResetMask = (1UL << HAL_RCC_APB2RSTR_SDIORST),
+        .EnableMask = (1UL << HAL_RCC_APB2ENR_SDIOEN),
+        .LowPowerMask = (1UL << HAL_RCC_APB2LPENR_SDIOLPEN),
+        .Bus = HAL_RCC_BUS_APB2,
+    },
+    [HAL_RCC_PERIPHERAL_ADC1] = {
+        .ResetMask = (1UL << HAL_RCC_APB2RSTR_ADCRST),
+        .EnableMask = (1UL << HAL_RCC_APB2ENR_ADC1EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB2LPENR_ADC1LPEN),
+        .Bus = HAL_RCC_BUS_APB2,
+    },
+    [HAL_RCC_PERIPHERAL_ADC2] = {
+        .ResetMask = (1UL << HAL_RCC_APB2RSTR_ADCRST),
+        .EnableMask = (1UL << HAL_RCC_APB2ENR_ADC2EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB2LPENR_ADC2LPEN),
+        .Bus = HAL_RCC_BUS_APB2,
+    },
+    [HAL_RCC_PERIPHERAL_ADC3] = {
+        .ResetMask = (1UL << HAL_RCC_APB2RSTR_ADCRST),
+        .EnableMask = (1UL << HAL_RCC_APB2ENR_ADC3EN),
+        .LowPowerMask = (1UL << HAL_RCC_APB2LPENR_ADC3LPEN),
+        .Bus = HAL_RCC_BUS_APB2,
+    },
+    [HAL_RCC_PERIPHERAL_FLASH_MEM] = {
+        .ResetMask = 0,
+        .EnableMask = 0,
+        .LowPowerMask = (1UL << HAL_RCC_AHB1LPENR_FLITFLPEN),
+        .Bus = HAL_RCC_BUS_AHB1,
+    },
+    [HAL_RCC_PERIPHERAL_RTC] = {
+        .ResetMask = 0,
+        .EnableMask = 0,
+        .LowPowerMask = 0,
+        .Bus = HAL_RCC_BUS_AHB1,
+    },
+};
 
-#define HAL_RCC_LOW_PWR_TIM11LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_TIM11LPEN)
+/**
+ * @brief: these are the function to be called when special event happens
+ */
+static functionCallBack_t global_pClockUnstableCallBack_t = NULL;
 
-#define HAL_RCC_LOW_PWR_TIM10LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_TIM10LPEN)
+/**
+ * @brief: prescalers of the buses that are currently used (they change with the clock profile)
+ */
+static uint16_t global_u16AHBPrescaler = 1;
+static uint8_t global_u8APB1Prescaler = 1;
+static uint8_t global_u8APB2Prescaler = 1;
 
-#define HAL_RCC_LOW_PWR_TIM9LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_TIM9LPEN)
+/**
+ * @brief: functions called before and after the clock profile changes, only the first global_u8RateNotifiersCount entries are used
+ */
+static functionCallBack_t globalArr_RCC_PreRateNotifiers_t[HAL_RCC_CFG_MAX_RATE_NOTIFIERS];
+static functionCallBack_t globalArr_RCC_PostRateNotifiers_t[HAL_RCC_CFG_MAX_RATE_NOTIFIERS];
+static uint8_t global_u8RateNotifiersCount = 0;
 
-#define HAL_RCC_LOW_PWR_TIM8LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_TIM8LPEN)
+/**
+ * @brief: current system clock source (refer to @HAL_RCC_SYSCLK_ClockSource_t in "RCC_config.h") and the state saved when clock security system switched to HSI,
+ *         global_u8HSEFailed is LIB_CONSTANTS_SUCCESS while running from the backup clock
+ */
+static uint8_t global_u8SystemClockSource = 0;
+static uint8_t global_u8HSEFailed = LIB_CONSTANTS_FAIL;
+static uint8_t global_u8HSESystemClockSource = 0;
+static uint32_t global_u32HSESystemClock = 0;
+static uint32_t global_u32HSEPLLConfig = 0;
+static uint32_t global_u32HSEPLLI2SConfig = 0;
 
-#define HAL_RCC_LOW_PWR_TIM1LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_TIM1LPEN)
+/**
+ * @brief: reset flags latched once per boot (refer to @HAL_RCC_ResetFlag_t in "RCC_header.h") and whether this boot is already added to the reset history
+ */
+static uint8_t global_u8ResetFlags = 0;
+static uint8_t global_u8ResetFlagsRead = LIB_CONSTANTS_FAIL;
+static uint8_t global_u8ResetLogged = LIB_CONSTANTS_FAIL;
 
 /**
- * @brief: System configuration controller module RCC utilities
+ * @brief: whether RCC itself already holds one user of the PWR and backup SRAM clocks (refer to HAL_RCC_HoldClock())
  */
-#define HAL_RCC_RST_SYSCFGRST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2RSTR, HAL_RCC_APB2RSTR_SYSCFGRST)
+static uint8_t global_u8PWRClockHeld = LIB_CONSTANTS_FAIL;
+static uint8_t global_u8BackupSRAMClockHeld = LIB_CONSTANTS_FAIL;
 
-#define HAL_RCC_EN_SYSCFGEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_SYSCFGEN)
+/**
+ * @brief: reset history ring inside backup SRAM (refer to @HAL_RCC_ResetHistory_t)
+ */
+static __io HAL_RCC_ResetHistory_t *global_pRCCResetHistory_t = (HAL_RCC_ResetHistory_t *)(HAL_CM4F_AHB1_BASEADDR + HAL_RCC_BKPSRAM_OFFSET + HAL_RCC_CFG_RESET_HISTORY_OFFSET);
 
-#define HAL_RCC_LOW_PWR_SYSCFGLPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_SYSCFGLPEN)
+/******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
 
 /**
- * @brief: SDIO module RCC utilities
+ * @brief: this function finds the dividers of the main PLL and PLLI2S from their constraints, only M values that put the VCO input in range are tried,
+ *         N is computed from the output and every P, Q and R is checked with one division, so the work is bounded by 62 * (4 + 14 + 6) checks.
+ *         an output of 0 means the PLL isn't used.
  */
-#define HAL_RCC_RST_SDIORST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2RSTR, HAL_RCC_APB2RSTR_SDIORST)
+static HAL_RCC_ErrStates_t HAL_RCC_SolvePLL(const uint32_t argConst_u32SourceSpeed, const uint32_t argConst_u32PLLOutput, const uint8_t argConst_u8PLL48Enable, const uint32_t argConst_u32PLLI2SOutput, HAL_RCC_PLLDividers_t *const arg_constpDividers);
 
-#define HAL_RCC_EN_SDIOEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_SDIOEN)
-
-#define HAL_RCC_LOW_PWR_SDIOLPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_SDIOLPEN)
+/**
+ * @brief: this function switches the system clock source and waits till the switch takes place
+ */
+static void HAL_RCC_SwitchSystemClock(const uint8_t argConst_u8ClockSource);
 
 /**
- * @brief: ADC interface module RCC utilities
+ * @brief: this function recomputes the input frequency of every peripheral clock from the system clock and bus prescalers,
+ *         timers get twice the APB clock when the APB prescaler isn't 1
  */
-#define HAL_RCC_RST_ADCRST()  \
-    LIB_MATH_BTT_SET_BIT(global_pRCCReg_t->RCC_APB2RSTR, HAL_RCC_APB2RSTR_ADCRST)
+static void HAL_RCC_UpdatePeripheralClocks(void);
 
-#define HAL_RCC_EN_ADC3EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_ADC3EN)
+/**
+ * @brief: this function adds the bits of the peripheral used by the operation to the masks of the buses (indexed by bus),
+ *         RTC is handled directly as it has only the enable bit in RCC_BDCR
+ */
+static void HAL_RCC_AddPeripheralMask(const uint8_t argConst_u8PeripheralName, const uint8_t argConst_u8Operation, uint32_t *const arg_constpu32Masks);
 
-#define HAL_RCC_EN_ADC2EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_ADC2EN)
+/**
+ * @brief: this function applies the operation to the masks of the buses with one read-modify-write per register,
+ *         reset is done by setting then clearing the reset bits
+ */
+static void HAL_RCC_ApplyPeripheralMasks(const uint32_t *const argConst_pu32Masks, const uint8_t argConst_u8Operation);
 
-#define HAL_RCC_EN_ADC1EN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2ENR, HAL_RCC_APB2ENR_ADC1EN)
+/**
+ * @brief: this function returns 1 if any enable bit of the peripheral is set in its RCC_xxxENR (RCC_BDCR for RTC) and 0 otherwise
+ */
+static uint8_t HAL_RCC_IsClockEnabled(const uint8_t argConst_u8PeripheralName);
 
-#define HAL_RCC_LOW_PWR_ADC3LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_ADC3LPEN)
+/**
+ * @brief: this function adds (HAL_RCC_PERI_OP_ENABLE) or removes (HAL_RCC_PERI_OP_DISABLE) one user of the peripheral clock and adds its bits
+ *         to the masks when the clock has to be turned on or gated, a clock found running without users counts as one existing user,
+ *         it shall be called with interrupts disabled
+ */
+static HAL_RCC_ErrStates_t HAL_RCC_UpdateClockUsers(const uint8_t argConst_u8PeripheralName, const uint8_t argConst_u8Operation, uint32_t *const arg_constpu32EnableMasks, uint32_t *const arg_constpu32LowPowerMasks);
 
-#define HAL_RCC_LOW_PWR_ADC2LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_ADC2LPEN)
+/**
+ * @brief: this function acquires the peripheral clock once for RCC itself, the flag remembers that it's held so repeated calls don't add users
+ */
+static void HAL_RCC_HoldClock(const uint8_t argConst_u8PeripheralName, uint8_t *const arg_constpu8Held);
 
-#define HAL_RCC_LOW_PWR_ADC1LPEN(ENABLEMENT_VAL) \
-    LIB_MATH_BTT_ASSIGN_BIT(global_pRCCReg_t->RCC_APB2LPENR, HAL_RCC_APB2LPENR_ADC1LPEN)
+/**
+ * @brief: this function stops the main PLL and PLLI2S, writes their configuration registers and starts again the ones used by the clock tree saved when HSE failed
+ */
+static void HAL_RCC_RestartPLL(const uint32_t argConst_u32PLLConfig, const uint32_t argConst_u32PLLI2SConfig);
 
-/******************************************************************************
- * Tables
- *******************************************************************************/
+/**
+ * @brief: this function is called by RCC_IRQHandler() when HSE fails, hardware already switched the system clock to HSI,
+ *         main PLL and PLLI2S are rebuilt from HSI with the same outputs when possible so the system keeps its speed
+ */
+static void HAL_RCC_FailoverToHSI(void);
 
-/******************************************************************************
- * Typedefs
- *******************************************************************************/
+/**
+ * @brief: this function calls the registered notifiers of one stage of a clock change (globalArr_RCC_PreRateNotifiers_t or globalArr_RCC_PostRateNotifiers_t)
+ */
+static void HAL_RCC_NotifyRateChange(const functionCallBack_t *const argConst_pNotifiers);
 
-/******************************************************************************
- * Variables
- *******************************************************************************/
+/**
+ * @brief: this function counts the ticks of TIM5 (clocked from HSI) during HAL_RCC_CFG_HSI_TRIM_CAPTURES captures of LSE,
+ *         it returns HAL_RCC_ERR_LSE_NOT_READY if a capture doesn't come within HAL_RCC_CFG_LSE_CAPTURE_TIMEOUT polls
+ *         and HAL_RCC_ERR_CAPTURE_OVERRUN if captures are still lost after HAL_RCC_TIM5_MEASURE_RESTARTS restarts
+ */
+static HAL_RCC_ErrStates_t HAL_RCC_MeasureHSI(uint32_t *const arg_Constpu32Ticks);
 
 /**
- * @brief: these variables holds the current clock values of the system
+ * @brief: this function latches the reset flags of RCC_CSR once per boot then clears them so that the next reset starts with clean flags
  */
-static uint32_t global_u32SystemClock = 0;
-static uint32_t global_u32HSEtoRTCClk = 0;
+static void HAL_RCC_ReadResetFlags(void);
 
 /**
- * @brief: these are the function to be called when special event happens
+ * @brief: this function enables PWR and backup SRAM clocks and removes backup domain write protection (PWR_CR.DBP) so that backup SRAM can be written
  */
-static functionCallBack_t global_pClockUnstableCallBack_t = NULL;
+static void HAL_RCC_EnableBackupSRAM(void);
 
-/******************************************************************************
- * Function Prototypes
- *******************************************************************************/
+/**
+ * @brief: this function adds a record of the current reset to the reset history ring (flags, boot number, RTC calendar and the saved fault context),
+ *         it's done once per boot and the ring is initialized if it doesn't hold HAL_RCC_RESET_HISTORY_MAGIC
+ */
+static void HAL_RCC_LogReset(void);
 
 /*** End of File **************************************************************/
 #endif /*HAL_RCC_PRIVATE_H_*/
@@ -146,7 +146,7 @@ static __io HAL_SYSCFG_RegDef_t *const global_pSYSCFGReg_t = ((HAL_SYSCFG_RegDef
  * @brief: used to select Ethernet PHY interface
  * @param Value: possible values are HAL_SYSCFG_ETH_MII and HAL_SYSCFG_ETH_RMII_PHY
  */
-#define HAL_SYSCFG_ETH_PHY_TYPE(Value)  \   
+#define HAL_SYSCFG_ETH_PHY_TYPE(Value) \
     LIB_MATH_BTT_ASSIGN_BIT(global_pGPIOAReg_t->SYSCFG_PMC, HAL_SYSCFG_PMC_MII_RMII_SEL, Value)
 
 /**